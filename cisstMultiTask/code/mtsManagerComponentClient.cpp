@@ -725,7 +725,8 @@ bool mtsManagerComponentClient::ForwardLog(const mtsLogMessage & log) const
 }
 
 bool mtsManagerComponentClient::Connect(const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
-                                        const std::string & serverComponentName, const std::string & serverInterfaceProvidedName)
+                                        const std::string & serverComponentName, const std::string & serverInterfaceProvidedName,
+                                        bool registerInterfaces)
 {
     mtsManagerLocal * LCM = mtsManagerLocal::GetInstance();
     const std::string processName = LCM->GetProcessName();
@@ -733,7 +734,12 @@ bool mtsManagerComponentClient::Connect(const std::string & clientComponentName,
                                                    processName, serverComponentName, serverInterfaceProvidedName);
     bool result = true;
     if (!IsRunning()) {
-        InterfaceComponentCommands_ComponentConnect(connectionDescription /*, result*/);
+        if (registerInterfaces) {
+            InterfaceComponentCommands_ComponentConnect(connectionDescription /*, result*/);
+        } else {
+            // both interfaces are in this process
+            ComponentConnectLocal(connectionDescription, false);
+        }
     } else {
         if (!GeneralInterface.ComponentConnect.IsValid()) {
             CMN_LOG_CLASS_INIT_WARNING << "Connect: GeneralInterface not yet valid, initializing." << std::endl;
@@ -1127,11 +1133,10 @@ void mtsManagerComponentClient::InterfaceLCMCommands_ComponentConfigure(const mt
 void mtsManagerComponentClient::InterfaceLCMCommands_ComponentConnect(const mtsDescriptionConnection & connectionDescription /*, bool & result*/)
 {
     // Try to connect interfaces as requested
-    mtsManagerLocal * LCM = mtsManagerLocal::GetInstance();
-
     // this is a remote connection
     if (connectionDescription.Client.ProcessName != connectionDescription.Server.ProcessName) {
 #if CISST_MTS_HAS_ICE
+        mtsManagerLocal * LCM = mtsManagerLocal::GetInstance();
         // PK TODO: Need to fix this to be thread-safe
         if (!LCM->Connect(connectionDescription.Client.ProcessName,
                           connectionDescription.Client.ComponentName,
@@ -1155,8 +1160,16 @@ void mtsManagerComponentClient::InterfaceLCMCommands_ComponentConnect(const mtsD
     }
 
     // local connection
+    ComponentConnectLocal(connectionDescription, true);
+}
+
+
+void mtsManagerComponentClient::ComponentConnectLocal(const mtsDescriptionConnection & connectionDescription, bool registerInterfaces)
+{
+    mtsManagerLocal * LCM = mtsManagerLocal::GetInstance();
     int connectionId = LCM->ConnectSetup(connectionDescription.Client.ComponentName, connectionDescription.Client.InterfaceName,
-                                         connectionDescription.Server.ComponentName, connectionDescription.Server.InterfaceName);
+                                         connectionDescription.Server.ComponentName, connectionDescription.Server.InterfaceName,
+                                         registerInterfaces);
     if (connectionId < 0) {
         CMN_LOG_CLASS_RUN_ERROR << "InterfaceLCMCommands_ComponentConnect: failed to execute \"Connect Setup\": "
                                 << connectionDescription << std::endl;
@@ -352,21 +352,12 @@ mtsConnection * mtsManagerGlobal::GetConnectionInformation(const ConnectionIDTyp
 ConnectionIDType mtsManagerGlobal::GetConnectionID(const std::string & clientProcessName,
         const std::string & clientComponentName, const std::string & interfaceName) const
 {
-    ConnectionMapType::const_iterator it = ConnectionMap.begin();
-    const ConnectionMapType::const_iterator itEnd = ConnectionMap.end();
-
-    mtsDescriptionConnection description;
-    for (; it != itEnd; ++it) {
-        it->second.GetDescriptionConnection(description);
-        if ((description.Client.ProcessName == clientProcessName) &&
-            (description.Client.ComponentName == clientComponentName) &&
-            (description.Client.InterfaceName == interfaceName))
-        {
-            return description.ConnectionID;
-        }
+    const ConnectionIDMapType::const_iterator it =
+        ConnectionIDMap.find(GetInterfaceUID(clientProcessName, clientComponentName, interfaceName));
+    if (it == ConnectionIDMap.end()) {
+        return InvalidConnectionID;
     }
-
-    return InvalidConnectionID;
+    return it->second;
 }
 
 bool mtsManagerGlobal::IsAlreadyConnected(const mtsDescriptionConnection & description) const
@@ -1542,6 +1533,7 @@ ConnectionIDType mtsManagerGlobal::Connect(const std::string & requestProcessNam
     mtsConnection connection(description, requestProcessName);
 
     ConnectionMap.insert(std::make_pair(thisConnectionID, connection));
+    ConnectionIDMap[GetInterfaceUID(clientProcessName, clientComponentNameActual, clientInterfaceNameActual)] = thisConnectionID;
 
     // STEP 5. Post-processings
     //
@@ -2005,7 +1997,18 @@ void mtsManagerGlobal::DisconnectInternal(void)
         // Step 4. Clean up connection map
         ConnectionMapChange.Lock();
         ConnectionMapType::iterator itConnectionMap = ConnectionMap.find(connectionID);
-        ConnectionMap.erase(itConnectionMap);
+        if (itConnectionMap != ConnectionMap.end()) {
+            mtsDescriptionConnection description;
+            itConnectionMap->second.GetDescriptionConnection(description);
+            ConnectionIDMapType::iterator itConnectionIDMap =
+                ConnectionIDMap.find(GetInterfaceUID(description.Client.ProcessName,
+                                                     description.Client.ComponentName,
+                                                     description.Client.InterfaceName));
+            if ((itConnectionIDMap != ConnectionIDMap.end()) && (itConnectionIDMap->second == connectionID)) {
+                ConnectionIDMap.erase(itConnectionIDMap);
+            }
+            ConnectionMap.erase(itConnectionMap);
+        }
         ConnectionMapChange.Unlock();
 
         // Step 5. Enqueue the disconnected id to the disconnected queue
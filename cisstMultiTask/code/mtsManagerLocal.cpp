@@ -17,6 +17,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstMultiTask/mtsManagerLocal.h>
+#include <cisstMultiTask/mtsTaskPeriodicExecutor.h>
 
 #include <cisstCommon/cmnThrow.h>
 #include <cisstOSAbstraction/osaSleep.h>
@@ -36,6 +37,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsManagerComponentServer.h>
 #include <cisstMultiTask/mtsLODMultiplexerStreambuf.h>
 
+#include <set>
+
 #if CISST_MTS_HAS_ICE
 #include "mtsComponentProxy.h"
 #include "mtsManagerProxyClient.h"
@@ -70,16 +73,41 @@ LogQueueType   LogQueue;
 std::string    ThisProcessName;
 // }}
 
-mtsManagerLocal::mtsManagerLocal(void) : ComponentMap("ComponentMap")
+
+// Time a startup phase, from construction to destruction
+class mtsManagerLocal::StartupPhaseTimer
+{
+    const mtsManagerLocal * Manager;
+    const mtsManagerLocal::StartupPhaseType Phase;
+    const double StartTime;
+
+public:
+    StartupPhaseTimer(const mtsManagerLocal * manager, const mtsManagerLocal::StartupPhaseType phase):
+        Manager(manager),
+        Phase(phase),
+        StartTime(TimeServer.GetRelativeTime())
+    {}
+
+    ~StartupPhaseTimer() {
+        const double elapsed = TimeServer.GetRelativeTime() - StartTime;
+        Manager->StartupProfileChange.Lock();
+        Manager->StartupPhaseTimes[Phase] += elapsed;
+        Manager->StartupPhaseCounts[Phase]++;
+        Manager->StartupProfileChange.Unlock();
+    }
+};
+
+
+mtsManagerLocal::mtsManagerLocal(void) : ComponentMap("ComponentMap"), ExecutorMap("ExecutorMap")
 {
     CMN_LOG_CLASS_INIT_VERBOSE << "Local component manager: STANDALONE mode" << std::endl;
     InitializeLocal();
 }
 
 #if CISST_MTS_HAS_ICE
-mtsManagerLocal::mtsManagerLocal(mtsManagerGlobal & globalComponentManager) : ComponentMap("ComponentMap")
+mtsManagerLocal::mtsManagerLocal(mtsManagerGlobal & globalComponentManager) : ComponentMap("ComponentMap"), ExecutorMap("ExecutorMap")
 #else
-mtsManagerLocal::mtsManagerLocal(mtsManagerGlobal & CMN_UNUSED(globalComponentManager)) : ComponentMap("ComponentMap")
+mtsManagerLocal::mtsManagerLocal(mtsManagerGlobal & CMN_UNUSED(globalComponentManager)) : ComponentMap("ComponentMap"), ExecutorMap("ExecutorMap")
 #endif
 {
 #if CISST_MTS_HAS_ICE
@@ -109,7 +137,7 @@ mtsManagerLocal::mtsManagerLocal(mtsManagerGlobal & CMN_UNUSED(globalComponentMa
 mtsManagerLocal::mtsManagerLocal(const std::string & globalComponentManagerIP,
                                  const std::string & thisProcessName,
                                  const std::string & thisProcessIP)
-                                 : ComponentMap("ComponentMap"),
+                                 : ComponentMap("ComponentMap"), ExecutorMap("ExecutorMap"),
                                    ProcessName(thisProcessName),
                                    GlobalComponentManagerIP(globalComponentManagerIP),
                                    ProcessIP(thisProcessIP)
@@ -232,12 +260,20 @@ mtsManagerLocal::~mtsManagerLocal()
     }
     */
     Cleanup();
+
+    ExecutorMapType::iterator executor = ExecutorMap.begin();
+    const ExecutorMapType::iterator end = ExecutorMap.end();
+    for (; executor != end; ++executor) {
+        delete executor->second;
+    }
+    ExecutorMap.clear();
 }
 
 void mtsManagerLocal::Initialize(void)
 {
     __os_init();
     ComponentMap.SetOwner(*this);
+    ExecutorMap.SetOwner(*this);
 
     InstanceReconfiguration = 0;
     ManagerComponent.Client = 0;
@@ -245,6 +281,8 @@ void mtsManagerLocal::Initialize(void)
 
     CurrentMainTask = 0;
 
+    ResetStartupProfile();
+
     SetGCMConnected(false);
 
     TimeServer.SetTimeOrigin();
@@ -291,6 +329,13 @@ void mtsManagerLocal::Cleanup(void)
     LogThreadFinishWaiting = true;
     LogTheadFinished.Wait();
 
+    // stop all executors, tasks should have been killed by now
+    ExecutorMapType::iterator executor = ExecutorMap.begin();
+    const ExecutorMapType::iterator end = ExecutorMap.end();
+    for (; executor != end; ++executor) {
+        executor->second->Stop();
+    }
+
     if (ManagerGlobal) {
         delete ManagerGlobal;
         ManagerGlobal = 0;
@@ -998,6 +1043,8 @@ mtsComponent * mtsManagerLocal::CreateComponentDynamically(const std::string & c
 
 bool mtsManagerLocal::AddComponent(mtsComponent * component)
 {
+    StartupPhaseTimer timer(this, STARTUP_ADD_COMPONENT);
+
     if (!component) {
         CMN_LOG_CLASS_INIT_ERROR << "AddComponent: invalid component" << std::endl;
         return false;
@@ -1675,6 +1722,93 @@ bool mtsManagerLocal::FindComponent(const std::string & componentName) const
     return (GetComponent(componentName) != 0);
 }
 
+double mtsManagerLocal::GetStartupPhaseTime(const StartupPhaseType phase) const
+{
+    if (phase >= STARTUP_NUMBER_OF_PHASES) {
+        return 0.0;
+    }
+    StartupProfileChange.Lock();
+    const double result = StartupPhaseTimes[phase];
+    StartupProfileChange.Unlock();
+    return result;
+}
+
+size_t mtsManagerLocal::GetStartupPhaseCount(const StartupPhaseType phase) const
+{
+    if (phase >= STARTUP_NUMBER_OF_PHASES) {
+        return 0;
+    }
+    StartupProfileChange.Lock();
+    const size_t result = StartupPhaseCounts[phase];
+    StartupProfileChange.Unlock();
+    return result;
+}
+
+void mtsManagerLocal::ResetStartupProfile(void)
+{
+    StartupProfileChange.Lock();
+    for (size_t phase = 0; phase < STARTUP_NUMBER_OF_PHASES; ++phase) {
+        StartupPhaseTimes[phase] = 0.0;
+        StartupPhaseCounts[phase] = 0;
+    }
+    StartupProfileChange.Unlock();
+}
+
+void mtsManagerLocal::StartupProfileToStream(std::ostream & outputStream) const
+{
+    static const char * phaseNames[STARTUP_NUMBER_OF_PHASES] = {
+        "AddComponent", "Connect", "CreateAll", "StartAll", "WaitForStateAll"
+    };
+    double total = 0.0;
+    StartupProfileChange.Lock();
+    for (size_t phase = 0; phase < STARTUP_NUMBER_OF_PHASES; ++phase) {
+        outputStream << phaseNames[phase] << ": " << StartupPhaseTimes[phase] << " s ("
+                     << StartupPhaseCounts[phase] << " call(s))" << std::endl;
+        total += StartupPhaseTimes[phase];
+    }
+    StartupProfileChange.Unlock();
+    outputStream << "Total: " << total << " s" << std::endl;
+}
+
+bool mtsManagerLocal::AddExecutor(const std::string & executorName, const size_t numberOfThreads,
+                                  const bool pinThreads)
+{
+    ComponentMapChange.Lock();
+    if (ExecutorMap.FindItem(executorName)) {
+        ComponentMapChange.Unlock();
+        CMN_LOG_CLASS_INIT_ERROR << "AddExecutor: executor \"" << executorName << "\" already exists" << std::endl;
+        return false;
+    }
+    mtsTaskPeriodicExecutor * executor = new mtsTaskPeriodicExecutor(executorName, numberOfThreads, pinThreads);
+    ExecutorMap.AddItem(executorName, executor);
+    ComponentMapChange.Unlock();
+
+    CMN_LOG_CLASS_INIT_VERBOSE << "AddExecutor: added executor \"" << executorName << "\" with "
+                               << numberOfThreads << " thread(s)" << std::endl;
+    return true;
+}
+
+mtsTaskPeriodicExecutor * mtsManagerLocal::GetExecutor(const std::string & executorName) const
+{
+    return ExecutorMap.GetItem(executorName, CMN_LOG_LEVEL_NONE);
+}
+
+bool mtsManagerLocal::SetExecutor(const std::string & componentName, const std::string & executorName)
+{
+    mtsTaskPeriodicExecutor * executor = GetExecutor(executorName);
+    if (!executor) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetExecutor: executor \"" << executorName << "\" not found" << std::endl;
+        return false;
+    }
+    mtsTaskPeriodic * task = dynamic_cast<mtsTaskPeriodic *>(GetComponent(componentName));
+    if (!task) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetExecutor: component \"" << componentName
+                                 << "\" not found or not a periodic task" << std::endl;
+        return false;
+    }
+    return task->SetExecutor(executor);
+}
+
 bool mtsManagerLocal::CreateManagerComponents(void)
 {
     // Automatically add internal manager component when the LCM is initialized.
@@ -1714,6 +1848,8 @@ bool mtsManagerLocal::CreateManagerComponents(void)
 
 bool mtsManagerLocal::WaitForStateAll(mtsComponentState desiredState, double timeout) const
 {
+    StartupPhaseTimer timer(this, STARTUP_WAIT_FOR_STATE);
+
     // wait for all components to be started if timeout is positive
     bool allAtState = true;
     mtsManagerComponentBase * isManager;
@@ -1760,6 +1896,8 @@ bool mtsManagerLocal::WaitForStateAll(mtsComponentState desiredState, double tim
 
 void mtsManagerLocal::CreateAll(void)
 {
+    StartupPhaseTimer timer(this, STARTUP_CREATE);
+
     ComponentMapChange.Lock();
 
     ComponentMapType::const_iterator iterator = ComponentMap.begin();
@@ -1781,6 +1919,8 @@ bool mtsManagerLocal::CreateAllAndWait(double timeoutInSeconds)
 
 void mtsManagerLocal::StartAll(void)
 {
+    StartupPhaseTimer timer(this, STARTUP_START);
+
     // Get the current thread id in order to check if any task will use the current thread.
     // If so, start that task last.
     const osaThreadId threadId = osaGetCurrentThreadId();
@@ -1889,6 +2029,8 @@ bool mtsManagerLocal::KillAllAndWait(double timeoutInSeconds)
 bool mtsManagerLocal::Connect(const std::string & clientComponentName, const std::string & clientInterfaceName,
                               const std::string & serverComponentName, const std::string & serverInterfaceName)
 {
+    StartupPhaseTimer timer(this, STARTUP_CONNECT);
+
     if (!ManagerComponent.Client) {
         CMN_LOG_CLASS_INIT_ERROR << "Connect: MCC not yet created" << std::endl;
         return false;
@@ -1898,37 +2040,119 @@ bool mtsManagerLocal::Connect(const std::string & clientComponentName, const std
                                             serverComponentName, serverInterfaceName);
 }
 
+bool mtsManagerLocal::Connect(const mtsDescriptionConnectionVec & connections)
+{
+    StartupPhaseTimer timer(this, STARTUP_CONNECT);
+
+    if (!ManagerComponent.Client) {
+        CMN_LOG_CLASS_INIT_ERROR << "Connect: MCC not yet created" << std::endl;
+        return false;
+    }
+
+    // Validate all local connections before establishing any.  Remote
+    // connections are validated by the GCM.
+    bool valid = true;
+    std::vector<bool> isLocal(connections.size(), true);
+    std::set<std::string> componentNames;
+    size_t index;
+    for (index = 0; index < connections.size(); ++index) {
+        const mtsDescriptionConnection & connection = connections[index];
+        if (!(connection.Client.ProcessName.empty() || (connection.Client.ProcessName == ProcessName))
+            || !(connection.Server.ProcessName.empty() || (connection.Server.ProcessName == ProcessName))) {
+            isLocal[index] = false;
+            continue;
+        }
+        const mtsComponent * client = GetComponent(connection.Client.ComponentName);
+        const mtsComponent * server = GetComponent(connection.Server.ComponentName);
+        if (!client || !server) {
+            CMN_LOG_CLASS_INIT_ERROR << "Connect: invalid component name for connection "
+                                     << connection.Client.ComponentName << ":" << connection.Client.InterfaceName << " - "
+                                     << connection.Server.ComponentName << ":" << connection.Server.InterfaceName << std::endl;
+            valid = false;
+            continue;
+        }
+        // the GCM accepts swapped client and server
+        if (!(client->InterfaceRequiredOrInputExists(connection.Client.InterfaceName)
+              && server->InterfaceProvidedOrOutputExists(connection.Server.InterfaceName))
+            && !(server->InterfaceRequiredOrInputExists(connection.Server.InterfaceName)
+                 && client->InterfaceProvidedOrOutputExists(connection.Client.InterfaceName))) {
+            CMN_LOG_CLASS_INIT_ERROR << "Connect: invalid interface name for connection "
+                                     << connection.Client.ComponentName << ":" << connection.Client.InterfaceName << " - "
+                                     << connection.Server.ComponentName << ":" << connection.Server.InterfaceName << std::endl;
+            valid = false;
+            continue;
+        }
+        componentNames.insert(connection.Client.ComponentName);
+        componentNames.insert(connection.Server.ComponentName);
+    }
+    if (!valid) {
+        CMN_LOG_CLASS_INIT_ERROR << "Connect: invalid connection(s) found, no connection established" << std::endl;
+        return false;
+    }
+
+    // Register the interfaces of each component only once
+    std::set<std::string>::const_iterator componentName = componentNames.begin();
+    const std::set<std::string>::const_iterator end = componentNames.end();
+    for (; componentName != end; ++componentName) {
+        if (!RegisterInterfaces(*componentName)) {
+            CMN_LOG_CLASS_INIT_ERROR << "Connect: failed to register interfaces for component \""
+                                     << *componentName << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    // Interfaces are registered, the MCC doesn't need to register them
+    // again for each connection
+    bool result = true;
+    for (index = 0; index < connections.size(); ++index) {
+        const mtsDescriptionConnection & connection = connections[index];
+        if (isLocal[index]) {
+            result &= ManagerComponent.Client->Connect(connection.Client.ComponentName, connection.Client.InterfaceName,
+                                                       connection.Server.ComponentName, connection.Server.InterfaceName,
+                                                       false);
+        } else {
+            result &= Connect(connection.Client.ProcessName, connection.Client.ComponentName, connection.Client.InterfaceName,
+                              connection.Server.ProcessName, connection.Server.ComponentName, connection.Server.InterfaceName);
+        }
+    }
+    return result;
+}
+
 ConnectionIDType mtsManagerLocal::ConnectSetup(const std::string & clientComponentName, const std::string & clientInterfaceName,
-                                               const std::string & serverComponentName, const std::string & serverInterfaceName)
+                                               const std::string & serverComponentName, const std::string & serverInterfaceName,
+                                               bool registerInterfaces)
 {
     std::vector<std::string> options;
     std::stringstream allOptions;
     std::ostream_iterator< std::string > output(allOptions, " ");
 
-    // Make sure all interfaces created so far are registered to the GCM.
-    if (!RegisterInterfaces(clientComponentName)) {
-        GetNamesOfComponents(options);
-        if (options.size() == 0) {
-            allOptions << "there is no component available";
-        } else {
-            allOptions << "the following component(s) are available: ";
-            std::copy(options.begin(), options.end(), output);
+    // Make sure all interfaces created so far are registered to the GCM,
+    // unless the caller already did it for a list of connections.
+    if (registerInterfaces) {
+        if (!RegisterInterfaces(clientComponentName)) {
+            GetNamesOfComponents(options);
+            if (options.size() == 0) {
+                allOptions << "there is no component available";
+            } else {
+                allOptions << "the following component(s) are available: ";
+                std::copy(options.begin(), options.end(), output);
+            }
+            CMN_LOG_CLASS_INIT_ERROR << "Connect: failed to register interfaces for component \""
+                                     << clientComponentName << "\", " << allOptions.str() << std::endl;
+            return -1;
         }
-        CMN_LOG_CLASS_INIT_ERROR << "Connect: failed to register interfaces for component \""
-                                 << clientComponentName << "\", " << allOptions.str() << std::endl;
-        return -1;
-    }
-    if (!RegisterInterfaces(serverComponentName)) {
-        GetNamesOfComponents(options);
-        if (options.size() == 0) {
-            allOptions << "there is no component available";
-        } else {
-            allOptions << "the following component(s) are available: ";
-            std::copy(options.begin(), options.end(), output);
+        if (!RegisterInterfaces(serverComponentName)) {
+            GetNamesOfComponents(options);
+            if (options.size() == 0) {
+                allOptions << "there is no component available";
+            } else {
+                allOptions << "the following component(s) are available: ";
+                std::copy(options.begin(), options.end(), output);
+            }
+            CMN_LOG_CLASS_INIT_ERROR << "Connect: failed to register interfaces for component \""
+                                     << serverComponentName << "\", " << allOptions.str() << std::endl;
+            return -1;
         }
-        CMN_LOG_CLASS_INIT_ERROR << "Connect: failed to register interfaces for component \""
-                                 << serverComponentName << "\", " << allOptions.str() << std::endl;
-        return -1;
     }
 
     const ConnectionIDType connectionID =
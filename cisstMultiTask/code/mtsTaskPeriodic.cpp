@@ -19,6 +19,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstMultiTask/mtsTaskPeriodic.h>
+#include <cisstMultiTask/mtsTaskPeriodicExecutor.h>
 #include <cisstMultiTask/mtsInterfaceRequired.h>
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 #include <cisstCommon/cmnUnits.h>
@@ -121,9 +122,14 @@ void * mtsTaskPeriodic::RunInternal(void *data)
             if (StateTable.GetToc() - StateTable.GetTic() > Period) {
                 OverranPeriod = true;
             }
+            // Wait for remaining period also handles thread suspension
+            ThreadBuddy.WaitForRemainingPeriod();
+            if (ThreadBuddy.IsOverranPeriod()) {
+                OverranPeriod = true;
+            }
+        } else {
+            ThreadBuddy.WaitForRemainingPeriod();
         }
-        // Wait for remaining period also handles thread suspension
-        ThreadBuddy.WaitForRemainingPeriod();
     }
 
     CMN_LOG_CLASS_RUN_WARNING << "End of task " << Name << std::endl;
@@ -135,6 +141,15 @@ void mtsTaskPeriodic::StartupInternal(void) {
     CMN_LOG_CLASS_INIT_VERBOSE << "Starting StartupInternal (periodic) for " << Name << std::endl;
     // user defined initialization, find commands from associated resource interfaces
     ThreadBuddy.Create(GetName().c_str(), AbsoluteTimePeriod); // convert to nano seconds
+    ThreadBuddy.SetOverrunPolicy(OverrunPolicy);
+    if (CPUAffinity != OSA_CPUANY) {
+        ThreadBuddy.SetCPUAffinity(CPUAffinity);
+    }
+    if (DeadlineRuntime > 0.0) {
+        ThreadBuddy.SetDeadlineScheduling(DeadlineRuntime * 1.0e9); // convert to nano seconds
+    } else if (RealTimePriority > 0) {
+        ThreadBuddy.SetRealTimePriority(RealTimePriority);
+    }
 
     // Call base class StartupInternal, which also calls user-supplied Startup.
     // If all goes well, this changes the state to READY.
@@ -174,6 +189,29 @@ void mtsTaskPeriodic::StartInternal(void)
     ThreadBuddy.Resume();
 }
 
+bool mtsTaskPeriodic::RunFromExecutor(void)
+{
+    if (this->State == mtsComponentState::INITIALIZING) {
+        // the executor always uses the same thread for a given task
+        Thread.CreateFromCurrentThread();
+        BaseType::StartupInternal();
+        return true;
+    }
+    if (this->State == mtsComponentState::ACTIVE) {
+        DoRunInternal();
+        if (StateTable.GetToc() - StateTable.GetTic() > Period) {
+            OverranPeriod = true;
+        }
+        return true;
+    }
+    if (this->State == mtsComponentState::READY) {
+        return true;
+    }
+    CMN_LOG_CLASS_RUN_WARNING << "End of task " << Name << " (executor)" << std::endl;
+    CleanupInternal();
+    return false;
+}
+
 /********************* Task constructor and destructor *****************/
 
 mtsTaskPeriodic::mtsTaskPeriodic(const std::string & name, double periodicityInSeconds,
@@ -182,7 +220,12 @@ mtsTaskPeriodic::mtsTaskPeriodic(const std::string & name, double periodicityInS
     mtsTaskContinuous(name, sizeStateTable, newThread),
     ThreadBuddy(),
     Period(periodicityInSeconds),
-    IsHardRealTime(isHardRealTime)
+    IsHardRealTime(isHardRealTime),
+    OverrunPolicy(osaThreadBuddy::OVERRUN_SKIP),
+    CPUAffinity(OSA_CPUANY),
+    RealTimePriority(0),
+    DeadlineRuntime(0.0),
+    Executor(0)
 {
     AbsoluteTimePeriod.FromSeconds(periodicityInSeconds);
     CMN_ASSERT(GetPeriodicity() > 0);
@@ -197,7 +240,12 @@ mtsTaskPeriodic::mtsTaskPeriodic( const std::string & name,
     ThreadBuddy(),
     Period(period.ToSeconds()),
     AbsoluteTimePeriod(period),
-    IsHardRealTime(isHardRealTime)
+    IsHardRealTime(isHardRealTime),
+    OverrunPolicy(osaThreadBuddy::OVERRUN_SKIP),
+    CPUAffinity(OSA_CPUANY),
+    RealTimePriority(0),
+    DeadlineRuntime(0.0),
+    Executor(0)
 {
     CMN_ASSERT(GetPeriodicity() > 0);
 }
@@ -206,7 +254,12 @@ mtsTaskPeriodic::mtsTaskPeriodic(const mtsTaskPeriodicConstructorArg &arg):
     mtsTaskContinuous(arg.Name, arg.StateTableSize, true),
     ThreadBuddy(),
     Period(arg.Period),
-    IsHardRealTime(arg.IsHardRealTime)
+    IsHardRealTime(arg.IsHardRealTime),
+    OverrunPolicy(osaThreadBuddy::OVERRUN_SKIP),
+    CPUAffinity(OSA_CPUANY),
+    RealTimePriority(0),
+    DeadlineRuntime(0.0),
+    Executor(0)
 {
     AbsoluteTimePeriod.FromSeconds(arg.Period);
     CMN_ASSERT(GetPeriodicity() > 0);
@@ -219,6 +272,13 @@ mtsTaskPeriodic::~mtsTaskPeriodic() {
     //pending on its message queue are unblocked with an error return.
 
     Kill();
+    if (Executor) {
+        // let the executor perform the cleanup, then make sure it
+        // doesn't use this task anymore
+        WaitForState(mtsComponentState::FINISHED, 1.0 * cmn_s + 2.0 * Period);
+        Executor->RemoveTask(this);
+        Executor = 0;
+    }
     // adeguet1, is this sleep still necessary?
     // Now, wait for 2 periods to see if it was killed
     // osaSleep(2.0 * this->PeriodInSeconds); // all expressed in seconds
@@ -227,6 +287,42 @@ mtsTaskPeriodic::~mtsTaskPeriodic() {
 
 /********************* Methods to change task state ******************/
 
+void mtsTaskPeriodic::Create(void * data)
+{
+    if (!Executor) {
+        BaseType::Create(data);
+        return;
+    }
+    if (this->State != mtsComponentState::CONSTRUCTED) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Create: task " << this->GetName() << " cannot be created, state = "
+                                   << this->State << std::endl;
+        return;
+    }
+    if (ExecIn && ExecIn->GetConnectedInterface()) {
+        CMN_LOG_CLASS_INIT_ERROR << "Create: task " << this->GetName()
+                                 << " gets its thread from another component, executor \""
+                                 << Executor->GetName() << "\" ignored" << std::endl;
+        Executor = 0;
+        BaseType::Create(data);
+        return;
+    }
+    // NOTE: still need to update GCM
+    RemoveInterfaceRequired("ExecIn", true);
+    ExecIn = 0;
+    // the executor owns the thread, it should never be deleted by the task
+    NewThread = false;
+    CMN_LOG_CLASS_INIT_VERBOSE << "Create: adding task " << this->GetName() << " to executor \""
+                               << Executor->GetName() << "\"" << std::endl;
+    SaveThreadStartData(data);
+    ChangeState(mtsComponentState::INITIALIZING);
+    if (!Executor->AddTask(this)) {
+        CMN_LOG_CLASS_INIT_ERROR << "Create: failed to add task " << this->GetName() << " to executor \""
+                                 << Executor->GetName() << "\"" << std::endl;
+        Executor = 0;
+        ChangeState(mtsComponentState::FINISHED);
+    }
+}
+
 void mtsTaskPeriodic::Suspend(void)
 {
     if (this->State == mtsComponentState::ACTIVE) {
@@ -248,3 +344,44 @@ bool mtsTaskPeriodic::IsPeriodic(void) const
 {
     return Period > 0.0;
 }
+
+void mtsTaskPeriodic::SetOverrunPolicy(const osaThreadBuddy::OverrunPolicyType policy)
+{
+    OverrunPolicy = policy;
+}
+
+void mtsTaskPeriodic::SetCPUAffinity(const osaCPUMask mask)
+{
+    CPUAffinity = mask;
+}
+
+void mtsTaskPeriodic::SetRealTimePriority(const int priority)
+{
+    RealTimePriority = priority;
+}
+
+void mtsTaskPeriodic::SetDeadlineRuntime(const double runtimeInSeconds)
+{
+    DeadlineRuntime = runtimeInSeconds;
+}
+
+unsigned long mtsTaskPeriodic::GetNumberOfOverruns(void) const
+{
+    return ThreadBuddy.GetNumberOfOverruns();
+}
+
+bool mtsTaskPeriodic::SetExecutor(mtsTaskPeriodicExecutor * executor)
+{
+    if (this->State != mtsComponentState::CONSTRUCTED) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetExecutor: task " << this->GetName()
+                                 << " has already been created, state = " << this->State << std::endl;
+        return false;
+    }
+    Executor = executor;
+    return true;
+}
+
+mtsTaskPeriodicExecutor * mtsTaskPeriodic::GetExecutor(void) const
+{
+    return Executor;
+}
@@ -0,0 +1,335 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstMultiTask/mtsTaskPeriodicExecutor.h>
+#include <cisstMultiTask/mtsTaskPeriodic.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+#include <cisstOSAbstraction/osaCPUAffinity.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+
+#include <algorithm>
+#include <sstream>
+
+CMN_IMPLEMENT_SERVICES(mtsTaskPeriodicExecutor);
+
+
+class mtsTaskPeriodicExecutor::Worker
+{
+public:
+    /*! Entry in run queue, tasks are sorted by release time */
+    struct EntryType {
+        double Release;
+        double Period;
+        mtsTaskPeriodic * Task;
+    };
+
+    /*! Comparison used to keep the earliest release on top of the heap */
+    struct LaterRelease {
+        bool operator()(const EntryType & entry1, const EntryType & entry2) const {
+            return entry1.Release > entry2.Release;
+        }
+    };
+
+    typedef std::vector<EntryType> QueueType;
+
+    mtsTaskPeriodicExecutor * Executor;
+    size_t Index;
+    bool Pin;
+    std::string Name;
+    osaThread Thread;
+    osaMutex Mutex;
+    osaThreadSignal Done;
+    QueueType Queue;
+    mtsTaskPeriodic * Current;
+    bool RemoveCurrent;
+    bool StopRequested;
+    double Load;
+
+    Worker(mtsTaskPeriodicExecutor * executor, const size_t index, const bool pin):
+        Executor(executor),
+        Index(index),
+        Pin(pin),
+        Current(0),
+        RemoveCurrent(false),
+        StopRequested(false),
+        Load(0.0)
+    {
+        std::stringstream name;
+        name << executor->GetName() << index;
+        Name = name.str();
+        Thread.Create<Worker, void *>(this, &Worker::Run, 0, Name.c_str());
+    }
+
+    void * Run(void * CMN_UNUSED(data));
+
+    /*! Find task in queue, returns Queue.end() if not found */
+    QueueType::iterator Find(const mtsTaskPeriodic * task) {
+        QueueType::iterator iter = Queue.begin();
+        const QueueType::iterator end = Queue.end();
+        for (; iter != end; ++iter) {
+            if (iter->Task == task) {
+                return iter;
+            }
+        }
+        return end;
+    }
+};
+
+
+void * mtsTaskPeriodicExecutor::Worker::Run(void * CMN_UNUSED(data))
+{
+    if (Pin) {
+        const int numberOfCPUs = osaCPUGetCount();
+        if (numberOfCPUs > 0) {
+            const unsigned int cpu = static_cast<unsigned int>(Index % numberOfCPUs);
+            if (osaCPUSetAffinityIndex(cpu) != OSASUCCESS) {
+                CMN_LOG_RUN_WARNING << "mtsTaskPeriodicExecutor: failed to pin worker "
+                                    << Index << " to cpu " << cpu << std::endl;
+            }
+        }
+    }
+
+    EntryType entry;
+    double now;
+    Mutex.Lock();
+    while (!StopRequested) {
+        if (Queue.empty()) {
+            Mutex.Unlock();
+            Thread.WaitForWakeup();
+            Mutex.Lock();
+            continue;
+        }
+        // earliest release time
+        entry = Queue.front();
+        now = osaGetTime();
+        if (entry.Release > now) {
+            // woken up early if the queue is modified
+            Mutex.Unlock();
+            Thread.WaitForWakeup(entry.Release - now);
+            Mutex.Lock();
+            continue;
+        }
+        std::pop_heap(Queue.begin(), Queue.end(), LaterRelease());
+        Queue.pop_back();
+        Current = entry.Task;
+        Mutex.Unlock();
+
+        const bool keep = entry.Task->RunFromExecutor();
+
+        Mutex.Lock();
+        Current = 0;
+        if (keep && !RemoveCurrent) {
+            entry.Release += entry.Period;
+            now = osaGetTime();
+            if (entry.Release <= now) {
+                // skip missed periods and preserve phase
+                entry.Release += (static_cast<int>((now - entry.Release) / entry.Period) + 1) * entry.Period;
+                entry.Task->OverranPeriod = true;
+            }
+            Queue.push_back(entry);
+            std::push_heap(Queue.begin(), Queue.end(), LaterRelease());
+        } else {
+            Load -= 1.0 / entry.Period;
+        }
+        if (RemoveCurrent) {
+            RemoveCurrent = false;
+            Done.Raise();
+        }
+    }
+    Mutex.Unlock();
+    return 0;
+}
+
+
+mtsTaskPeriodicExecutor::mtsTaskPeriodicExecutor(const std::string & name,
+                                                 const size_t numberOfThreads,
+                                                 const bool pinThreads):
+    Name(name),
+    Stopped(false)
+{
+    const size_t numberOfWorkers = (numberOfThreads > 0) ? numberOfThreads : 1;
+    Workers.resize(numberOfWorkers);
+    for (size_t index = 0; index < numberOfWorkers; ++index) {
+        Workers[index] = new Worker(this, index, pinThreads);
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "constructor: created executor \"" << Name << "\" with "
+                               << numberOfWorkers << " thread(s)" << std::endl;
+}
+
+
+mtsTaskPeriodicExecutor::~mtsTaskPeriodicExecutor()
+{
+    Stop();
+    for (size_t index = 0; index < Workers.size(); ++index) {
+        delete Workers[index];
+    }
+    Workers.clear();
+}
+
+
+const std::string & mtsTaskPeriodicExecutor::GetName(void) const
+{
+    return Name;
+}
+
+
+size_t mtsTaskPeriodicExecutor::GetNumberOfThreads(void) const
+{
+    return Workers.size();
+}
+
+
+size_t mtsTaskPeriodicExecutor::GetNumberOfTasks(void) const
+{
+    TaskMapMutex.Lock();
+    const size_t result = TaskMap.size();
+    TaskMapMutex.Unlock();
+    return result;
+}
+
+
+bool mtsTaskPeriodicExecutor::AddTask(mtsTaskPeriodic * task)
+{
+    if (!task) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddTask: null pointer for executor \"" << Name << "\"" << std::endl;
+        return false;
+    }
+    const double period = task->GetPeriodicity();
+    if (period <= 0.0) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddTask: task \"" << task->GetName() << "\" is not periodic" << std::endl;
+        return false;
+    }
+
+    TaskMapMutex.Lock();
+    if (Stopped) {
+        TaskMapMutex.Unlock();
+        CMN_LOG_CLASS_INIT_ERROR << "AddTask: executor \"" << Name << "\" is stopped, can't add task \""
+                                 << task->GetName() << "\"" << std::endl;
+        return false;
+    }
+    if (TaskMap.find(task) != TaskMap.end()) {
+        TaskMapMutex.Unlock();
+        CMN_LOG_CLASS_INIT_ERROR << "AddTask: task \"" << task->GetName() << "\" already added to executor \""
+                                 << Name << "\"" << std::endl;
+        return false;
+    }
+    // find least loaded worker
+    size_t workerIndex = 0;
+    double minLoad = Workers[0]->Load;
+    for (size_t index = 1; index < Workers.size(); ++index) {
+        if (Workers[index]->Load < minLoad) {
+            minLoad = Workers[index]->Load;
+            workerIndex = index;
+        }
+    }
+    TaskMap[task] = workerIndex;
+    TaskMapMutex.Unlock();
+
+    Worker * worker = Workers[workerIndex];
+    Worker::EntryType entry;
+    entry.Release = osaGetTime();
+    entry.Period = period;
+    entry.Task = task;
+    worker->Mutex.Lock();
+    worker->Load += 1.0 / period;
+    worker->Queue.push_back(entry);
+    std::push_heap(worker->Queue.begin(), worker->Queue.end(), Worker::LaterRelease());
+    worker->Mutex.Unlock();
+    worker->Thread.Wakeup();
+
+    CMN_LOG_CLASS_INIT_VERBOSE << "AddTask: added task \"" << task->GetName() << "\" to thread \""
+                               << worker->Name << "\"" << std::endl;
+    return true;
+}
+
+
+bool mtsTaskPeriodicExecutor::RemoveTask(mtsTaskPeriodic * task)
+{
+    TaskMapMutex.Lock();
+    TaskMapType::iterator found = TaskMap.find(task);
+    if (found == TaskMap.end()) {
+        TaskMapMutex.Unlock();
+        CMN_LOG_CLASS_RUN_VERBOSE << "RemoveTask: task not found in executor \"" << Name << "\"" << std::endl;
+        return false;
+    }
+    const size_t workerIndex = found->second;
+    TaskMap.erase(found);
+    TaskMapMutex.Unlock();
+
+    Worker * worker = Workers[workerIndex];
+    worker->Mutex.Lock();
+    if (worker->Current == task) {
+        // wait for worker to be done with this task
+        worker->RemoveCurrent = true;
+        bool running = true;
+        while (running) {
+            worker->Mutex.Unlock();
+            worker->Done.Wait(0.1 * cmn_s);
+            worker->Mutex.Lock();
+            running = (worker->Current == task);
+        }
+    } else {
+        Worker::QueueType::iterator entry = worker->Find(task);
+        if (entry != worker->Queue.end()) {
+            worker->Load -= 1.0 / entry->Period;
+            worker->Queue.erase(entry);
+            std::make_heap(worker->Queue.begin(), worker->Queue.end(), Worker::LaterRelease());
+        }
+    }
+    worker->Mutex.Unlock();
+    worker->Thread.Wakeup();
+    return true;
+}
+
+
+void mtsTaskPeriodicExecutor::Stop(void)
+{
+    TaskMapMutex.Lock();
+    const bool alreadyStopped = Stopped;
+    Stopped = true;
+    TaskMapMutex.Unlock();
+    if (alreadyStopped) {
+        return;
+    }
+    size_t index;
+    for (index = 0; index < Workers.size(); ++index) {
+        Workers[index]->Mutex.Lock();
+        Workers[index]->StopRequested = true;
+        Workers[index]->Mutex.Unlock();
+        Workers[index]->Thread.Wakeup();
+    }
+    for (index = 0; index < Workers.size(); ++index) {
+        Workers[index]->Thread.Wait();
+    }
+}
+
+
+void mtsTaskPeriodicExecutor::ToStream(std::ostream & outputStream) const
+{
+    outputStream << "Executor \"" << Name << "\":";
+    for (size_t index = 0; index < Workers.size(); ++index) {
+        Workers[index]->Mutex.Lock();
+        outputStream << " [" << Workers[index]->Name
+                     << ", tasks: " << Workers[index]->Queue.size()
+                     << ", load: " << Workers[index]->Load << " Hz]";
+        Workers[index]->Mutex.Unlock();
+    }
+}
@@ -126,6 +126,7 @@ typedef mtsComponent mtsDevice; // for backward compatibility
 class mtsTask;
 class mtsTaskContinuous;
 class mtsTaskPeriodic;
+class mtsTaskPeriodicExecutor;
 class mtsTaskFromCallback;
 class mtsTaskFromSignal;
 
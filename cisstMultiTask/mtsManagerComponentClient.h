@@ -153,9 +153,13 @@ protected:
     /*! Support for system-wide thread-safe logging. Forward logs to MCS. */
     bool ForwardLog(const mtsLogMessage & log) const;
 
-    // Called from LCM
+    // Called from LCM.  If registerInterfaces is false, the LCM has
+    // already registered the interfaces of both components to the GCM.
+    // This is only used if the connection is processed immediately,
+    // i.e. this component is not running yet.
     bool Connect(const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
-                 const std::string & serverComponentName, const std::string & serverInterfaceProvidedName);
+                 const std::string & serverComponentName, const std::string & serverInterfaceProvidedName,
+                 bool registerInterfaces = true);
 
     bool IsLocalProcess(const std::string &procName) const;
 
@@ -163,6 +167,8 @@ protected:
     void InterfaceLCMCommands_ComponentCreate(const mtsDescriptionComponent & componentDescription, bool & result);
     void InterfaceLCMCommands_ComponentConfigure(const mtsDescriptionComponent & arg);
     void InterfaceLCMCommands_ComponentConnect(const mtsDescriptionConnection & connectionDescription /*, bool & result*/);
+    /*! Local part of InterfaceLCMCommands_ComponentConnect */
+    void ComponentConnectLocal(const mtsDescriptionConnection & connectionDescription, bool registerInterfaces);
     void InterfaceLCMCommands_ComponentDisconnect(const mtsDescriptionConnection & arg);
     void InterfaceLCMCommands_ComponentStart(const mtsComponentStatusControl & arg);
     void InterfaceLCMCommands_ComponentStop(const mtsComponentStatusControl & arg);
@@ -115,6 +115,13 @@ protected:
     typedef std::map<ConnectionIDType, mtsConnection> ConnectionMapType;
     ConnectionMapType ConnectionMap;
 
+    /*! Index of ConnectionMap using the required interface UID (see
+        GetInterfaceUID) as key.  Since a required interface has only one
+        connection, this avoids a linear search of all connections in
+        GetConnectionID.  Updated along with ConnectionMap. */
+    typedef std::map<std::string, ConnectionIDType> ConnectionIDMapType;
+    ConnectionIDMapType ConnectionIDMap;
+
     /*! Instance of connected local component manager. Note that the global
         component manager communicates with the only one instance of
         mtsManagerLocalInterface regardless of connection type (standalone
@@ -114,6 +114,17 @@ public:
         LCM_CONFIG_NETWORKED_WITH_GCM
     };
 
+    /*! Phases of the system startup timed by the local component
+        manager, see GetStartupPhaseTime and StartupProfileToStream */
+    enum StartupPhaseType {
+        STARTUP_ADD_COMPONENT = 0,
+        STARTUP_CONNECT,
+        STARTUP_CREATE,
+        STARTUP_START,
+        STARTUP_WAIT_FOR_STATE,
+        STARTUP_NUMBER_OF_PHASES
+    };
+
 
 private:
     /*! Singleton object */
@@ -147,6 +158,11 @@ private:
     typedef cmnNamedMap<mtsComponent> ComponentMapType;
     ComponentMapType ComponentMap;
 
+    /*! Typedef for executor map: key is executor name, value is
+        executor object (owned by the local component manager) */
+    typedef cmnNamedMap<mtsTaskPeriodicExecutor> ExecutorMapType;
+    ExecutorMapType ExecutorMap;
+
     /*! Time server used by all tasks. */
     // MJ: Move this to mtsManagerLocal.cpp (for system-wide logging)
     //osaTimeServer TimeServer;
@@ -167,6 +183,16 @@ private:
     /*! Mutex to use ComponentMap safely */
     osaMutex ComponentMapChange;
 
+    /*! Time spent (in seconds) and number of calls for each startup
+        phase.  Protected by StartupProfileChange. */
+    mutable double StartupPhaseTimes[STARTUP_NUMBER_OF_PHASES];
+    mutable size_t StartupPhaseCounts[STARTUP_NUMBER_OF_PHASES];
+    mutable osaMutex StartupProfileChange;
+
+    /*! Helper to time a startup phase, defined in implementation */
+    class StartupPhaseTimer;
+    friend class StartupPhaseTimer;
+
     /*! Mutex for thread-safe transition of configuration from standalone mode to
         networked mode */
     static osaMutex ConfigurationChange;
@@ -274,8 +300,12 @@ protected:
     bool RegisterInterfaces(const std::string & componentName);
 
     // PK: following two methods were part of Connect method
+    /*! Get a connection id from the GCM.  Unless registerInterfaces is
+        false, i.e. the caller already registered them, the interfaces
+        of both components are registered to the GCM first. */
     ConnectionIDType ConnectSetup(const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
-                                  const std::string & serverComponentName, const std::string & serverInterfaceProvidedName);
+                                  const std::string & serverComponentName, const std::string & serverInterfaceProvidedName,
+                                  bool registerInterfaces = true);
 
     bool ConnectNotify(ConnectionIDType connectionId,
                        const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
@@ -384,6 +414,51 @@ public:
     /*! \brief Check if a component exists by its name */
     bool FindComponent(const std::string & componentName) const;
 
+    //-------------------------------------------------------------------------
+    //  Executors
+    //-------------------------------------------------------------------------
+    /*! \brief Create an executor used to run multiple periodic tasks
+               on a fixed set of threads, see mtsTaskPeriodicExecutor.
+               The executor is owned by the local component manager.
+        \param executorName Name of the executor
+        \param numberOfThreads Number of worker threads
+        \param pinThreads Pin each worker thread to a CPU
+        \return False if an executor with the same name already exists */
+    bool AddExecutor(const std::string & executorName, const size_t numberOfThreads,
+                     const bool pinThreads = true);
+
+    /*! \brief Retrieve an executor by name, null if not found */
+    mtsTaskPeriodicExecutor * GetExecutor(const std::string & executorName) const;
+
+    /*! \brief Run a periodic task using an existing executor instead
+               of a dedicated thread.  This must be called after the
+               component has been added and before it is created
+               (e.g. before CreateAll).
+        \return False if the executor or component can't be found, if
+                the component is not an mtsTaskPeriodic or if it has
+                already been created. */
+    bool SetExecutor(const std::string & componentName, const std::string & executorName);
+
+    //-------------------------------------------------------------------------
+    //  Startup Profiler
+    //-------------------------------------------------------------------------
+    // The local component manager measures the time spent adding components,
+    // connecting interfaces, creating and starting the components as well as
+    // waiting for their state changes to find which phase dominates the
+    // startup time of a large system.
+
+    /*! Total time spent in a phase, in seconds */
+    double GetStartupPhaseTime(const StartupPhaseType phase) const;
+
+    /*! Number of calls timed for a phase */
+    size_t GetStartupPhaseCount(const StartupPhaseType phase) const;
+
+    /*! Reset all times and counters */
+    void ResetStartupProfile(void);
+
+    /*! Print time spent and number of calls for each phase */
+    void StartupProfileToStream(std::ostream & outputStream) const;
+
     /*! Wait until all components reach a certain state.  If all
       components have reach the given state within the time alloted,
       the method returns true. */
@@ -432,6 +507,18 @@ public:
     bool Connect(const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
                  const std::string & serverComponentName, const std::string & serverInterfaceProvidedName);
 
+    /*! \brief Connect a list of interfaces
+        \param connections List of connections, the connection ids are ignored
+        \return True if all connections have been established, false otherwise
+        \note All connections are validated before any is established, i.e.
+              all components and interfaces must exist.  Errors are logged
+              for every invalid connection and nothing is connected if any
+              is invalid.  The interfaces of each component involved are
+              registered to the global component manager only once for the
+              whole list.  This is significantly faster than calling
+              Connect for each connection when starting large systems. */
+    bool Connect(const mtsDescriptionConnectionVec & connections);
+
     /*! \brief Connect two remote interfaces
         \param clientProcessName Name of client process
         \param clientComponentName Name of client component
@@ -82,6 +82,7 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
     CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
 
     friend class mtsTaskManager;
+    friend class mtsTaskPeriodicExecutor;
 
  public:
     typedef mtsTaskContinuous BaseType;
@@ -101,6 +102,18 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
 	  time systems. */
 	bool IsHardRealTime;
 
+    /*! Scheduling options applied to the thread buddy when the task
+      starts, see SetOverrunPolicy, SetCPUAffinity,
+      SetRealTimePriority and SetDeadlineRuntime. */
+    osaThreadBuddy::OverrunPolicyType OverrunPolicy;
+    osaCPUMask CPUAffinity;
+    int RealTimePriority;
+    double DeadlineRuntime;
+
+    /*! Executor used to run this task instead of a dedicated thread,
+      null by default. */
+    mtsTaskPeriodicExecutor * Executor;
+
     /********************* Methods that call user methods *****************/
 
 	/*! The member function that is passed as 'start routine' argument for
@@ -119,6 +132,11 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
     /*! Called from Start */
     void StartInternal(void);
 
+    /*! Method called by the executor at every release time, performs
+      startup, run or cleanup based on the task state.  Returns false
+      once the task is finished. */
+    bool RunFromExecutor(void);
+
  public:
     /********************* Task constructor and destructor *****************/
 
@@ -153,7 +171,11 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
 	virtual ~mtsTaskPeriodic();
 
     /********************* Methods to change task status *****************/
-    /* (use Start, Create and Kill methods from base classes)            */
+    /* (use Start and Kill methods from base classes)                    */
+
+    /*! Create the task.  If an executor has been set, the task is
+      added to the executor instead of creating a new thread. */
+    void Create(void * data = 0);
 
 	/*! Suspend the execution of the task */
 	void Suspend(void);
@@ -167,6 +189,41 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
       the thread was created with a period > 0. */
     bool IsPeriodic(void) const;
 
+    /*! Set the policy used by the thread buddy when the task overruns
+      its period (skip, catch up or resync).  The default is to skip
+      missed periods and preserve the phase.  In all cases,
+      IsOverranPeriod will return true after an overrun.  Must be
+      called before the task is created. */
+    void SetOverrunPolicy(const osaThreadBuddy::OverrunPolicyType policy);
+
+    /*! Pin the task's thread to a set of CPUs.  Must be called before
+      the task is created. */
+    void SetCPUAffinity(const osaCPUMask mask);
+
+    /*! Run the task's thread with the SCHED_FIFO policy and the given
+      priority (Linux only, 0 to leave the default policy).  Must be
+      called before the task is created. */
+    void SetRealTimePriority(const int priority);
+
+    /*! Run the task's thread with the SCHED_DEADLINE policy (Linux
+      only).  The runtime is the CPU time reserved per period, in
+      seconds (0 to disable).  This overrides SetRealTimePriority.
+      Must be called before the task is created. */
+    void SetDeadlineRuntime(const double runtimeInSeconds);
+
+    /*! Total number of overruns detected by the thread buddy. */
+    unsigned long GetNumberOfOverruns(void) const;
+
+    /*! Run this task on a shared executor instead of a dedicated
+      thread.  Must be called before the task is created; returns
+      false otherwise.  Use a null pointer to use a dedicated thread
+      again. */
+    bool SetExecutor(mtsTaskPeriodicExecutor * executor);
+
+    /*! Executor used to run this task, null if the task uses its own
+      thread. */
+    mtsTaskPeriodicExecutor * GetExecutor(void) const;
+
 };
 
 
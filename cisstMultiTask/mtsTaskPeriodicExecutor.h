@@ -0,0 +1,125 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+/*!
+  \file
+  \brief Defines an executor for periodic tasks.
+*/
+
+#ifndef _mtsTaskPeriodicExecutor_h
+#define _mtsTaskPeriodicExecutor_h
+
+#include <cisstCommon/cmnGenericObject.h>
+#include <cisstCommon/cmnClassRegisterMacros.h>
+#include <cisstOSAbstraction/osaMutex.h>
+#include <cisstMultiTask/mtsForwardDeclarations.h>
+
+#include <map>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Executor running many periodic tasks on a fixed set of worker
+  threads.  By default, each mtsTaskPeriodic creates its own thread.
+  When a large number of small periodic tasks are used, most threads
+  are sleeping and the context switches become expensive.  Periodic
+  tasks can instead be assigned to an executor (see
+  mtsTaskPeriodic::SetExecutor or mtsManagerLocal::AddExecutor and
+  mtsManagerLocal::SetExecutor) before they are created.
+
+  Each worker thread owns a run queue sorted by release time
+  (earliest deadline first) and can be pinned to a CPU.  A task is
+  assigned to the least loaded worker (based on the sum of task
+  rates) when it is created and remains on the same worker, so its
+  thread id doesn't change.  The worker performs the task startup,
+  runs the task (including its mailboxes and state tables) at every
+  release time and performs the cleanup once the task is killed.
+
+  Since tasks assigned to the same worker share a thread, a task
+  should never block (e.g. blocking commands) waiting for another
+  task on the same worker.  The IsHardRealTime flag and the thread
+  buddy options of mtsTaskPeriodic are not used by the executor.
+*/
+class CISST_EXPORT mtsTaskPeriodicExecutor: public cmnGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+ public:
+    /*! Constructor.  The worker threads are created immediately.
+
+      \param name Name of the executor, used for logs and thread names
+      \param numberOfThreads Number of worker threads (at least 1)
+      \param pinThreads Pin each worker thread to a CPU (round-robin) */
+    mtsTaskPeriodicExecutor(const std::string & name,
+                            const size_t numberOfThreads,
+                            const bool pinThreads = true);
+
+    /*! Destructor, stops all worker threads.  Tasks still assigned
+      to the executor will not be run anymore. */
+    ~mtsTaskPeriodicExecutor();
+
+    /*! Name of the executor */
+    const std::string & GetName(void) const;
+
+    /*! Number of worker threads */
+    size_t GetNumberOfThreads(void) const;
+
+    /*! Number of tasks currently assigned to the executor */
+    size_t GetNumberOfTasks(void) const;
+
+    /*! Add a task to the least loaded worker.  The task is released
+      immediately for its startup.  Returns false if the executor is
+      stopped or the task is already assigned. */
+    bool AddTask(mtsTaskPeriodic * task);
+
+    /*! Remove a task from its worker.  If the task is being run, this
+      method blocks until the worker is done with it.  Returns false
+      if the task was not assigned to this executor. */
+    bool RemoveTask(mtsTaskPeriodic * task);
+
+    /*! Stop all worker threads.  This is called by the destructor. */
+    void Stop(void);
+
+    /*! Print the name and load of each worker */
+    void ToStream(std::ostream & outputStream) const;
+
+ protected:
+    /*! Worker thread and its run queue, defined in implementation */
+    class Worker;
+    friend class Worker;
+
+    std::string Name;
+    std::vector<Worker *> Workers;
+    bool Stopped;
+
+    /*! Worker index for each task */
+    typedef std::map<mtsTaskPeriodic *, size_t> TaskMapType;
+    TaskMapType TaskMap;
+    /*! Protects TaskMap and Stopped */
+    mutable osaMutex TaskMapMutex;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskPeriodicExecutor)
+
+#endif // _mtsTaskPeriodicExecutor_h
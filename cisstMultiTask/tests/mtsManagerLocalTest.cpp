@@ -351,6 +351,43 @@ void mtsManagerLocalTest::TestConnectDisconnect(void)
     CPPUNIT_ASSERT(localManager.Connect(fromCallback1->GetName(), "r1", continuous1->GetName(), "p2"));
 }
 
+void mtsManagerLocalTest::TestConnectList(void)
+{
+    mtsManagerLocal * localManager = mtsManagerLocal::GetInstance();
+    mtsTestDevice1<mtsInt> * client1 = new mtsTestDevice1<mtsInt>("connectListClient1");
+    mtsTestDevice1<mtsInt> * client2 = new mtsTestDevice1<mtsInt>("connectListClient2");
+    mtsTestDevice2<mtsInt> * server = new mtsTestDevice2<mtsInt>("connectListServer");
+
+    CPPUNIT_ASSERT(localManager->AddComponent(client1));
+    CPPUNIT_ASSERT(localManager->AddComponent(client2));
+    CPPUNIT_ASSERT(localManager->AddComponent(server));
+
+    const std::string processName = localManager->GetProcessName();
+    mtsDescriptionConnectionVec connections;
+    connections.push_back(mtsDescriptionConnection(processName, client1->GetName(), "r1",
+                                                   processName, server->GetName(), "p1"));
+    connections.push_back(mtsDescriptionConnection(processName, client2->GetName(), "r1",
+                                                   processName, server->GetName(), "p2"));
+
+    // one invalid connection, nothing should be connected
+    connections.push_back(mtsDescriptionConnection(processName, client1->GetName(), "r1",
+                                                   processName, server->GetName(), "invalid"));
+    CPPUNIT_ASSERT(!localManager->Connect(connections));
+    CPPUNIT_ASSERT(client1->GetInterfaceRequired("r1")->GetConnectedInterface() == 0);
+    CPPUNIT_ASSERT(client2->GetInterfaceRequired("r1")->GetConnectedInterface() == 0);
+
+    // valid connections only
+    connections.pop_back();
+    const size_t numberOfConnects = localManager->GetStartupPhaseCount(mtsManagerLocal::STARTUP_CONNECT);
+    CPPUNIT_ASSERT(localManager->Connect(connections));
+    CPPUNIT_ASSERT(client1->GetInterfaceRequired("r1")->GetConnectedInterface() != 0);
+    CPPUNIT_ASSERT(client2->GetInterfaceRequired("r1")->GetConnectedInterface() != 0);
+    CPPUNIT_ASSERT_EQUAL(numberOfConnects + 1, localManager->GetStartupPhaseCount(mtsManagerLocal::STARTUP_CONNECT));
+
+    localManager->ResetStartupProfile();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), localManager->GetStartupPhaseCount(mtsManagerLocal::STARTUP_CONNECT));
+}
+
 void mtsManagerLocalTest::TestConnectLocally(void)
 {
     mtsManagerLocal localManager;
@@ -46,6 +46,7 @@ private:
 
         CPPUNIT_TEST(TestConnectLocally);
         CPPUNIT_TEST(TestConnectDisconnect);
+        CPPUNIT_TEST(TestConnectList);
 
 #if CISST_MTS_HAS_ICE
         CPPUNIT_TEST(TestGetIPAddressList);
@@ -84,6 +85,7 @@ public:
 
     void TestConnectLocally(void);
     void TestConnectDisconnect(void);
+    void TestConnectList(void);
 
 #if CISST_MTS_HAS_ICE
     void TestGetIPAddressList(void);
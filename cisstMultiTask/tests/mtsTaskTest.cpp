@@ -19,13 +19,17 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaSleep.h>
 #include <cisstMultiTask/mtsStateTable.h>
+#include <cisstMultiTask/mtsTaskPeriodicExecutor.h>
 
 #include "mtsTaskTest.h"
 
 #include <string>
+#include <sstream>
 
 CMN_IMPLEMENT_SERVICES(mtsTaskTestTask);
+CMN_IMPLEMENT_SERVICES(mtsTaskTestCounter);
 
 mtsTaskTestTask::mtsTaskTestTask(const std::string & name, 
                                  double period) :
@@ -33,6 +37,13 @@ mtsTaskTestTask::mtsTaskTestTask(const std::string & name,
 {
 }
 
+mtsTaskTestCounter::mtsTaskTestCounter(const std::string & name,
+                                       double period) :
+    mtsTaskPeriodic(name, period, false, 50),
+    Counter(0)
+{
+}
+
 void mtsTaskTestTask::TestGetStateVectorID(void)
 {
     mtsDouble data1, data2;
@@ -51,4 +62,54 @@ void mtsTaskTest::TestGetStateVectorID(void)
     task.TestGetStateVectorID();
 }
 
+static bool mtsTaskTestWaitForState(const mtsTask * task,
+                                    const mtsComponentState & state,
+                                    double timeout)
+{
+    while (!(task->GetState() == state) && (timeout > 0.0)) {
+        osaSleep(1.0 * cmn_ms);
+        timeout -= 1.0 * cmn_ms;
+    }
+    return (task->GetState() == state);
+}
+
+void mtsTaskTest::TestExecutor(void)
+{
+    const size_t numberOfTasks = 10;
+    const double period = 5.0 * cmn_ms;
+    const double duration = 200.0 * cmn_ms;
+    mtsTaskPeriodicExecutor executor("TestExecutor", 2, false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), executor.GetNumberOfThreads());
+
+    mtsTaskTestCounter * tasks[numberOfTasks];
+    size_t index;
+    for (index = 0; index < numberOfTasks; ++index) {
+        std::stringstream name;
+        name << "executorTask" << index;
+        tasks[index] = new mtsTaskTestCounter(name.str(), period);
+        CPPUNIT_ASSERT(tasks[index]->SetExecutor(&executor));
+        tasks[index]->Create();
+        // executor can't be changed once the task is created
+        CPPUNIT_ASSERT(!tasks[index]->SetExecutor(0));
+    }
+    CPPUNIT_ASSERT_EQUAL(numberOfTasks, executor.GetNumberOfTasks());
+
+    for (index = 0; index < numberOfTasks; ++index) {
+        CPPUNIT_ASSERT(mtsTaskTestWaitForState(tasks[index], mtsComponentState::READY, 1.0 * cmn_s));
+        tasks[index]->Start();
+    }
+    osaSleep(duration);
+    for (index = 0; index < numberOfTasks; ++index) {
+        tasks[index]->Kill();
+    }
+    const unsigned int expected = static_cast<unsigned int>(duration / period);
+    for (index = 0; index < numberOfTasks; ++index) {
+        CPPUNIT_ASSERT(mtsTaskTestWaitForState(tasks[index], mtsComponentState::FINISHED, 1.0 * cmn_s));
+        CPPUNIT_ASSERT(tasks[index]->Counter > expected / 2);
+        CPPUNIT_ASSERT(tasks[index]->Counter < 2 * expected);
+        delete tasks[index];
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), executor.GetNumberOfTasks());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsTaskTest);
@@ -44,11 +44,31 @@ public:
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskTestTask);
 
 
+class mtsTaskTestCounter : public mtsTaskPeriodic {
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, 5);
+
+public:
+    mtsTaskTestCounter(const std::string & name,
+                       double period);
+    virtual ~mtsTaskTestCounter() {}
+
+    void Configure(const std::string &) {}
+    void Startup(void) {}
+    void Run(void) { Counter++; }
+    void Cleanup(void) {}
+
+    unsigned int Counter;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskTestCounter);
+
+
 class mtsTaskTest: public CppUnit::TestFixture
 {
     CPPUNIT_TEST_SUITE(mtsTaskTest);
 	{
 		CPPUNIT_TEST(TestGetStateVectorID);
+		CPPUNIT_TEST(TestExecutor);
     }
     CPPUNIT_TEST_SUITE_END();
 	
@@ -58,4 +78,7 @@ public:
     void tearDown(void) {}
 
 	void TestGetStateVectorID(void);
+
+    /*! Run multiple periodic tasks using an executor */
+    void TestExecutor(void);
 };
@@ -17,6 +17,9 @@
  */
 
 #include <cisstNumerical/nmrConstraintOptimizer.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <algorithm>
 
 //! This is a container for constrained control optimizer.
 //! It provides high level functions to add common functionality.
@@ -34,7 +37,15 @@
 /*! Initialize control optimizer
   \param n Number of variables
 */
-nmrConstraintOptimizer::nmrConstraintOptimizer(const size_t n)
+nmrConstraintOptimizer::nmrConstraintOptimizer(const size_t n):
+    RealTime(false),
+    MaxCRows(0),
+    MaxARows(0),
+    MaxERows(0),
+    MaxIterations(0),
+    Damping(0.0),
+    RealTimeCRows(0),
+    RealTimeObjectiveSet(false)
 {
     Slacks = 0;
     NumVars = n;
@@ -48,8 +59,13 @@ nmrConstraintOptimizer::nmrConstraintOptimizer(const size_t n)
 */
 nmrConstraintOptimizer::STATUS nmrConstraintOptimizer::Solve(vctDoubleVec &dq)
 {
+#if CISST_HAS_CISSTNETLIB
     CISSTNETLIB_INTEGER res;
 
+    if (RealTime) {
+        return SolveRealTime(dq);
+    }
+
     // make sure input is the correct size
     dq.SetSize(NumVars+Slacks);
 
@@ -110,6 +126,189 @@ nmrConstraintOptimizer::STATUS nmrConstraintOptimizer::Solve(vctDoubleVec &dq)
 
     // res is our current status, check and return its value as a STATUS
     return (STATUS)res;
+#else
+    // nmrLSqLin is not available, use the preallocated solver
+    if (!RealTime) {
+        AllocateRealTime(C.rows(), A.rows(), E.rows(), MaxIterations);
+    }
+    return SolveRealTime(dq);
+#endif
+}
+
+//! Solve using the preallocated solver
+/*! SolveRealTime
+  \param dq Vector of current joint values
+  \return STATUS enum that dictates whether the solver worked or there was a problem
+*/
+nmrConstraintOptimizer::STATUS nmrConstraintOptimizer::SolveRealTime(vctDoubleVec & dq)
+{
+    const size_t n = NumVars + Slacks;
+    dq.SetSize(n);
+
+    // if we don't see an objective
+    if (C.rows() == 0 || d.size() == 0) {
+        dq.SetAll(0);
+        return NMR_EMPTY;
+    }
+
+    // if the sizes don't match
+    if (C.rows() != d.size() || C.cols() != n
+        || A.rows() != b.size() || (A.rows() > 0 && A.cols() != n)
+        || E.rows() != f.size() || (E.rows() > 0 && E.cols() != n)) {
+        return NMR_MALFORMED;
+    }
+
+    // only allocate if the problem is larger than expected
+    if (RealTimeC.cols() != n || C.rows() > MaxCRows || A.rows() > MaxARows || E.rows() > MaxERows) {
+        CMN_LOG_RUN_WARNING << "nmrConstraintOptimizer::Solve: problem larger than sizes used for AllocateRealTime, allocating memory" << std::endl;
+        AllocateRealTime(std::max(MaxCRows, C.rows()), std::max(MaxARows, A.rows()), std::max(MaxERows, E.rows()),
+                         MaxIterations);
+    }
+
+    // objective, unused rows are zero.  Only the rows that changed since
+    // the previous cycle update the factorization, it is computed from
+    // scratch if most rows changed
+    size_t i;
+    size_t changed = (RealTimeCRows > C.rows()) ? (RealTimeCRows - C.rows()) : 0;
+    for (i = 0; i < C.rows(); i++) {
+        if ((d[i] != RealTimed[i]) || !C.Row(i).Equal(RealTimeC.Row(i))) {
+            changed++;
+        }
+    }
+    if (!RealTimeObjectiveSet || (2 * changed > RealTimeC.rows())) {
+        RealTimeC.Ref(C.rows(), n).Assign(C);
+        RealTimeC.Ref(MaxCRows - C.rows(), n, C.rows(), 0).SetAll(0.0);
+        RealTimed.Ref(C.rows()).Assign(d);
+        RealTimed.Ref(MaxCRows - C.rows(), C.rows()).SetAll(0.0);
+        RealTimeSolver.SetObjective(RealTimeC, RealTimed);
+        RealTimeObjectiveSet = true;
+    } else if (changed > 0) {
+        for (i = 0; i < C.rows(); i++) {
+            RealTimeC.Row(i).Assign(C.Row(i));
+            RealTimed[i] = d[i];
+            RealTimeSolver.SetObjectiveRow(i, RealTimeC.Row(i), RealTimed[i]);
+        }
+        for (; i < RealTimeCRows; i++) {
+            RealTimeC.Row(i).SetAll(0.0);
+            RealTimed[i] = 0.0;
+            RealTimeSolver.SetObjectiveRow(i, RealTimeC.Row(i), RealTimed[i]);
+        }
+    }
+    RealTimeCRows = C.rows();
+
+    // constraints, unused equality rows are zero, unused inequality rows
+    // are 0 >= -1
+    if (A.rows() > 0) {
+        RealTimeA.Ref(A.rows(), n).Assign(A);
+        RealTimeb.Ref(A.rows()).Assign(b);
+    }
+    RealTimeA.Ref(MaxARows - A.rows(), n, A.rows(), 0).SetAll(0.0);
+    RealTimeb.Ref(MaxARows - A.rows(), A.rows()).SetAll(-1.0);
+    if (E.rows() > 0) {
+        RealTimeE.Ref(E.rows(), n).Assign(E);
+        RealTimef.Ref(E.rows()).Assign(f);
+    }
+    RealTimeE.Ref(MaxERows - E.rows(), n, E.rows(), 0).SetAll(0.0);
+    RealTimef.Ref(MaxERows - E.rows(), E.rows()).SetAll(0.0);
+
+    RealTimeSolver.SetEqualityConstraints(RealTimeE, RealTimef);
+    RealTimeSolver.SetInequalityConstraints(RealTimeA, RealTimeb);
+    const nmrLSqLinIncremental::STATUS status = RealTimeSolver.Solve();
+    dq.Assign(RealTimeSolver.GetX());
+
+    switch (status) {
+    case nmrLSqLinIncremental::NMR_OK:
+        return NMR_OK;
+    case nmrLSqLinIncremental::NMR_EQ_CONTRADICTION:
+        return NMR_EQ_CONTRADICTION;
+    case nmrLSqLinIncremental::NMR_INEQ_CONTRADICTION:
+        return NMR_INEQ_CONTRADICTION;
+    case nmrLSqLinIncremental::NMR_RANK_DEFICIENT:
+        return NMR_RANK_DEFICIENT;
+    default:
+        return NMR_MAX_ITERATIONS;
+    }
+}
+
+//! Use a preallocated solver for the following calls to Solve.
+/*! AllocateRealTime
+  \param maxCRows Maximum number of rows of the objective
+  \param maxARows Maximum number of rows of the inequality constraint, including slack limits
+  \param maxERows Maximum number of rows of the equality constraint
+  \param maxIterations Maximum number of constraints added to the active set by Solve
+*/
+void nmrConstraintOptimizer::AllocateRealTime(const size_t maxCRows, const size_t maxARows, const size_t maxERows,
+                                              const size_t maxIterations)
+{
+    const size_t n = NumVars + Slacks;
+    MaxCRows = maxCRows;
+    MaxARows = maxARows;
+    MaxERows = maxERows;
+    MaxIterations = maxIterations;
+    RealTimeSolver.Allocate(MaxCRows + n, MaxERows, MaxARows, n);
+    if (MaxIterations > 0) {
+        RealTimeSolver.SetMaxIterations(MaxIterations);
+    }
+    RealTimeC.SetSize(MaxCRows + n, n, VCT_ROW_MAJOR);
+    RealTimeC.SetAll(0.0);
+    RealTimed.SetSize(MaxCRows + n);
+    RealTimed.SetAll(0.0);
+    RealTimeA.SetSize(MaxARows, n, VCT_ROW_MAJOR);
+    RealTimeb.SetSize(MaxARows);
+    RealTimeE.SetSize(MaxERows, n, VCT_ROW_MAJOR);
+    RealTimef.SetSize(MaxERows);
+    RealTimeCRows = 0;
+    SetDamping(Damping);
+    RealTime = true;
+}
+
+//! Use nmrLSqLin for the following calls to Solve.
+/*! DisableRealTime
+ */
+void nmrConstraintOptimizer::DisableRealTime(void)
+{
+    RealTime = false;
+}
+
+//! True if Solve uses the preallocated solver.
+/*! IsRealTime
+ */
+bool nmrConstraintOptimizer::IsRealTime(void) const
+{
+    return RealTime;
+}
+
+//! Damping of the variables for the preallocated solver.
+/*! SetDamping
+  \param damping Weight of the objective rows damping x
+*/
+void nmrConstraintOptimizer::SetDamping(const double damping)
+{
+    Damping = damping;
+    // last rows of the objective
+    if (RealTimeC.rows() == MaxCRows + RealTimeC.cols()) {
+        RealTimeC.Ref(RealTimeC.cols(), RealTimeC.cols(), MaxCRows, 0).Diagonal().SetAll(Damping);
+    }
+    // damping rows changed, factorize the objective again
+    RealTimeObjectiveSet = false;
+}
+
+//! Number of iterations of the last call to Solve (preallocated solver only).
+/*! GetNumberOfIterations
+  \return size_t Number of constraints added to the active set
+*/
+size_t nmrConstraintOptimizer::GetNumberOfIterations(void) const
+{
+    return RealTimeSolver.GetNumberOfIterations();
+}
+
+//! Largest constraint violation of the last solution (preallocated solver only).
+/*! GetConstraintViolation
+  \return double Violation, zero if all the constraints are satisfied
+*/
+double nmrConstraintOptimizer::GetConstraintViolation(void) const
+{
+    return RealTimeSolver.GetConstraintViolation();
 }
 
 //! Returns the number of variables.
@@ -141,6 +340,12 @@ const std::string nmrConstraintOptimizer::GetStatusString(STATUS status) const
     case NMR_BOTH_CONTRADICTION:
         return "BOTH_CONTRADICTION";
         break;
+    case NMR_RANK_DEFICIENT:
+        return "RANK_DEFICIENT";
+        break;
+    case NMR_MAX_ITERATIONS:
+        return "MAX_ITERATIONS";
+        break;
     default:
         return "MALFORMED";
         break;
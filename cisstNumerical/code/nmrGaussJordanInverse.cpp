@@ -20,6 +20,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstNumerical/nmrGaussJordanInverse.h>
 #include <cisstVector/vctFixedSizeMatrix.h>
 
+#include <math.h>
+
 template<class _elementType, bool _rowMajorIn, bool _rowMajorOut>
 void nmrGaussJordanInverse2x2(
     vctFixedSizeMatrix<_elementType, 2, 2, _rowMajorIn> A,
@@ -288,6 +290,162 @@ void nmrGaussJordanInverse4x4(
     return;
 }
 
+
+/*
+  Gauss-Jordan elimination with row pivoting for _lanes independent
+  matrices.  Each row of the augmented matrix [A | I] is stored element
+  by element with the matrices contiguous, i.e. M[row][column][matrix],
+  and the pivoting uses selects instead of branches so that the loops
+  on the matrices can be vectorized.  The pivot indices and the
+  nonsingular flags are stored as _elementType to keep the same width
+  as the elements.
+*/
+template<class _elementType, vct::size_type _size, vct::size_type _lanes>
+class nmrGaussJordanInverseKernel
+{
+public:
+    typedef _elementType value_type;
+    typedef vct::size_type size_type;
+
+    enum {COLUMNS = 2 * _size};
+    value_type M[_size][COLUMNS][_lanes];
+    value_type Nonsingular[_lanes];
+
+    template <bool _rowMajorIn>
+    inline void Load(size_type lane,
+                     const vctFixedSizeMatrix<value_type, _size, _size, _rowMajorIn> & input)
+    {
+        size_type row, column;
+        for (row = 0; row < _size; row++) {
+            for (column = 0; column < _size; column++) {
+                M[row][column][lane] = input.Element(row, column);
+                M[row][column + _size][lane] = (row == column) ? value_type(1) : value_type(0);
+            }
+        }
+    }
+
+    template <bool _rowMajorOut>
+    inline void Store(size_type lane,
+                      vctFixedSizeMatrix<value_type, _size, _size, _rowMajorOut> & output) const
+    {
+        size_type row, column;
+        for (row = 0; row < _size; row++) {
+            for (column = 0; column < _size; column++) {
+                output.Element(row, column) = M[row][column + _size][lane];
+            }
+        }
+    }
+
+    inline void Eliminate(const value_type singularityTolerance)
+    {
+        value_type best[_lanes], pivot[_lanes], scale[_lanes];
+        size_type k, row, column, lane;
+        for (lane = 0; lane < _lanes; lane++) {
+            Nonsingular[lane] = value_type(1);
+        }
+        for (k = 0; k < _size; k++) {
+            // pivot search in column k
+            for (lane = 0; lane < _lanes; lane++) {
+                best[lane] = fabs(M[k][k][lane]);
+                pivot[lane] = value_type(k);
+            }
+            for (row = k + 1; row < _size; row++) {
+                for (lane = 0; lane < _lanes; lane++) {
+                    const value_type absolute = fabs(M[row][k][lane]);
+                    pivot[lane] = (absolute > best[lane]) ? value_type(row) : pivot[lane];
+                    best[lane] = (absolute > best[lane]) ? absolute : best[lane];
+                }
+            }
+            // exchange rows k and pivot, columns on the left of k are
+            // already eliminated
+            for (row = k + 1; row < _size; row++) {
+                value_type * pivotRow = M[k][k];
+                value_type * otherRow = M[row][k];
+                for (column = k; column < COLUMNS; column++) {
+                    for (lane = 0; lane < _lanes; lane++) {
+                        const value_type pivotValue = pivotRow[lane];
+                        const value_type otherValue = otherRow[lane];
+                        pivotRow[lane] = (pivot[lane] == value_type(row)) ? otherValue : pivotValue;
+                        otherRow[lane] = (pivot[lane] == value_type(row)) ? pivotValue : otherValue;
+                    }
+                    pivotRow += _lanes;
+                    otherRow += _lanes;
+                }
+            }
+            // normalize row k, use 1 as pivot for singular matrices
+            for (lane = 0; lane < _lanes; lane++) {
+                const value_type denominator = (best[lane] < singularityTolerance) ? value_type(1) : M[k][k][lane];
+                Nonsingular[lane] = (best[lane] < singularityTolerance) ? value_type(0) : Nonsingular[lane];
+                scale[lane] = value_type(1) / denominator;
+            }
+            for (column = k; column < COLUMNS; column++) {
+                for (lane = 0; lane < _lanes; lane++) {
+                    M[k][column][lane] *= scale[lane];
+                }
+            }
+            // eliminate column k from the other rows
+            for (row = 0; row < _size; row++) {
+                if (row == k) {
+                    continue;
+                }
+                for (lane = 0; lane < _lanes; lane++) {
+                    scale[lane] = M[row][k][lane];
+                }
+                for (column = k; column < COLUMNS; column++) {
+                    for (lane = 0; lane < _lanes; lane++) {
+                        M[row][column][lane] -= scale[lane] * M[k][column][lane];
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+template<class _elementType, bool _rowMajorIn, bool _rowMajorOut>
+void nmrGaussJordanInverse6x6(
+    vctFixedSizeMatrix<_elementType, 6, 6, _rowMajorIn> A,
+    bool & nonsingular,
+    vctFixedSizeMatrix<_elementType, 6, 6, _rowMajorOut> & Ainv,
+    const _elementType singularityTolerance)
+{
+    nmrGaussJordanInverseKernel<_elementType, 6, 1> kernel;
+    kernel.Load(0, A);
+    kernel.Eliminate(singularityTolerance);
+    nonsingular = (kernel.Nonsingular[0] != _elementType(0));
+    if (nonsingular) {
+        kernel.Store(0, Ainv);
+    }
+}
+
+
+template<class _elementType, vct::size_type _size, bool _rowMajorIn, bool _rowMajorOut>
+void nmrGaussJordanInverseBatch(
+    size_t count,
+    const vctFixedSizeMatrix<_elementType, _size, _size, _rowMajorIn> * A,
+    bool * nonsingular,
+    vctFixedSizeMatrix<_elementType, _size, _size, _rowMajorOut> * Ainv,
+    const _elementType singularityTolerance)
+{
+    enum {LANES = 4};
+    nmrGaussJordanInverseKernel<_elementType, _size, LANES> kernel;
+    size_t first, lane;
+    for (first = 0; first < count; first += LANES) {
+        const size_t last = (first + LANES < count) ? (first + LANES) : count;
+        // unused lanes of the last group invert the first matrix again
+        for (lane = 0; lane < LANES; lane++) {
+            kernel.Load(lane, A[(first + lane < last) ? (first + lane) : first]);
+        }
+        kernel.Eliminate(singularityTolerance);
+        for (lane = 0; first + lane < last; lane++) {
+            nonsingular[first + lane] = (kernel.Nonsingular[lane] != _elementType(0));
+            if (nonsingular[first + lane]) {
+                kernel.Store(lane, Ainv[first + lane]);
+            }
+        }
+    }
+}
+
 // Instantiate the function for double matrices in any storage order
 template
 void nmrGaussJordanInverse2x2(vctFixedSizeMatrix<double, 2, 2, VCT_ROW_MAJOR>, bool &,
@@ -410,3 +568,36 @@ void nmrGaussJordanInverse4x4(vctFixedSizeMatrix<float, 4, 4, VCT_COL_MAJOR>, bo
                               vctFixedSizeMatrix<float, 4, 4, VCT_COL_MAJOR> &,
                               const float);
 
+
+// Instantiate the 6x6 and batch functions for double and float
+// matrices in any storage order
+#define NMR_GAUSS_JORDAN_INSTANTIATE(type, rowMajorIn, rowMajorOut)     \
+    template                                                            \
+    void nmrGaussJordanInverse6x6(vctFixedSizeMatrix<type, 6, 6, rowMajorIn>, bool &, \
+                                  vctFixedSizeMatrix<type, 6, 6, rowMajorOut> &, \
+                                  const type);                          \
+    template                                                            \
+    void nmrGaussJordanInverseBatch(size_t, const vctFixedSizeMatrix<type, 2, 2, rowMajorIn> *, bool *, \
+                                    vctFixedSizeMatrix<type, 2, 2, rowMajorOut> *, \
+                                    const type);                        \
+    template                                                            \
+    void nmrGaussJordanInverseBatch(size_t, const vctFixedSizeMatrix<type, 3, 3, rowMajorIn> *, bool *, \
+                                    vctFixedSizeMatrix<type, 3, 3, rowMajorOut> *, \
+                                    const type);                        \
+    template                                                            \
+    void nmrGaussJordanInverseBatch(size_t, const vctFixedSizeMatrix<type, 4, 4, rowMajorIn> *, bool *, \
+                                    vctFixedSizeMatrix<type, 4, 4, rowMajorOut> *, \
+                                    const type);                        \
+    template                                                            \
+    void nmrGaussJordanInverseBatch(size_t, const vctFixedSizeMatrix<type, 6, 6, rowMajorIn> *, bool *, \
+                                    vctFixedSizeMatrix<type, 6, 6, rowMajorOut> *, \
+                                    const type);
+
+NMR_GAUSS_JORDAN_INSTANTIATE(double, VCT_ROW_MAJOR, VCT_ROW_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(double, VCT_ROW_MAJOR, VCT_COL_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(double, VCT_COL_MAJOR, VCT_ROW_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(double, VCT_COL_MAJOR, VCT_COL_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(float, VCT_ROW_MAJOR, VCT_ROW_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(float, VCT_ROW_MAJOR, VCT_COL_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(float, VCT_COL_MAJOR, VCT_ROW_MAJOR)
+NMR_GAUSS_JORDAN_INSTANTIATE(float, VCT_COL_MAJOR, VCT_COL_MAJOR)
@@ -0,0 +1,200 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstNumerical/nmrKdTree.h>
+
+#include <algorithm>
+
+namespace {
+    // order point indices along one axis, used to find the median
+    class nmrKdTreeCompare
+    {
+    public:
+        nmrKdTreeCompare(const vctDynamicVector<vct3> & points, unsigned int axis):
+            Points(points),
+            Axis(axis)
+        {}
+        inline bool operator()(size_t a, size_t b) const {
+            return Points[a][Axis] < Points[b][Axis];
+        }
+    protected:
+        const vctDynamicVector<vct3> & Points;
+        unsigned int Axis;
+    };
+
+    // maximum depth of the tree, must be greater than log2 of the number of points
+    const size_t nmrKdTreeMaxDepth = 64;
+}
+
+
+nmrKdTree::nmrKdTree(void)
+{
+}
+
+
+void nmrKdTree::BuildTree(const vct3 * points, size_t size, ptrdiff_t stride)
+{
+    size_t i;
+    Points.SetSize(size);
+    for (i = 0; i < size; i++) {
+        Points[i] = *(points + i * stride);
+    }
+    Index.resize(size);
+    for (i = 0; i < size; i++) {
+        Index[i] = i;
+    }
+    Nodes.clear();
+    if (size == 0) {
+        X.clear();
+        Y.clear();
+        Z.clear();
+        return;
+    }
+    Nodes.reserve(4 * (size / LEAF_SIZE + 1));
+    Nodes.resize(1);
+    BuildNode(0, 0, size);
+
+    // coordinates in the order of the leaves
+    X.resize(size);
+    Y.resize(size);
+    Z.resize(size);
+    for (i = 0; i < size; i++) {
+        const vct3 & point = Points[Index[i]];
+        X[i] = point.X();
+        Y[i] = point.Y();
+        Z[i] = point.Z();
+    }
+}
+
+
+void nmrKdTree::BuildNode(size_t node, size_t begin, size_t end)
+{
+    Nodes[node].Begin = begin;
+    Nodes[node].End = end;
+    if (end - begin <= LEAF_SIZE) {
+        Nodes[node].Axis = Node::LEAF;
+        Nodes[node].Split = 0.0;
+        Nodes[node].Child = 0;
+        return;
+    }
+    // split along the axis with the largest extent, at the median
+    vct3 lower, upper;
+    lower.Assign(Points[Index[begin]]);
+    upper.Assign(lower);
+    size_t i;
+    for (i = begin + 1; i < end; i++) {
+        lower.ElementwiseMinOf(lower, Points[Index[i]]);
+        upper.ElementwiseMaxOf(upper, Points[Index[i]]);
+    }
+    const vct3 extent(upper - lower);
+    unsigned int axis = (extent.X() >= extent.Y()) ? 0 : 1;
+    if (extent.Z() > extent[axis]) {
+        axis = 2;
+    }
+    const size_t middle = begin + (end - begin) / 2;
+    std::nth_element(Index.begin() + begin, Index.begin() + middle, Index.begin() + end,
+                     nmrKdTreeCompare(Points, axis));
+    const size_t child = Nodes.size();
+    Nodes.resize(child + 2);
+    Nodes[node].Axis = axis;
+    Nodes[node].Split = Points[Index[middle]][axis];
+    Nodes[node].Child = child;
+    BuildNode(child, begin, middle);
+    BuildNode(child + 1, middle, end);
+}
+
+
+bool nmrKdTree::FindNearest(const vct3 & query, size_t & index, double & distanceSquared,
+                            double maxDistanceSquared, size_t hint) const
+{
+    if (Nodes.empty()) {
+        return false;
+    }
+    const double q[3] = {query.X(), query.Y(), query.Z()};
+    double best = maxDistanceSquared;
+    size_t bestIndex = Points.size();
+    if (hint < Points.size()) {
+        const double dx = Points[hint].X() - q[0];
+        const double dy = Points[hint].Y() - q[1];
+        const double dz = Points[hint].Z() - q[2];
+        const double d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 < best) {
+            best = d2;
+            bestIndex = hint;
+        }
+    }
+
+    // far children to visit, at most one per level of the tree.  The
+    // distance from the query to the cell of a node is updated
+    // incrementally using the offset along each axis (Arya and Mount
+    // 1993), this prunes more than the distance to the last split.
+    struct Pending {
+        size_t Node;
+        double DistanceSquared;
+        double Offset[3];
+    };
+    Pending stack[nmrKdTreeMaxDepth];
+    size_t top = 1;
+    stack[0].Node = 0;
+    stack[0].DistanceSquared = 0.0;
+    stack[0].Offset[0] = stack[0].Offset[1] = stack[0].Offset[2] = 0.0;
+    while (top > 0) {
+        --top;
+        if (stack[top].DistanceSquared >= best) {
+            continue;
+        }
+        const Node * node = &(Nodes[stack[top].Node]);
+        const double cellDistanceSquared = stack[top].DistanceSquared;
+        double offset[3] = {stack[top].Offset[0], stack[top].Offset[1], stack[top].Offset[2]};
+        while (node->Axis != Node::LEAF) {
+            const unsigned int axis = node->Axis;
+            const double difference = q[axis] - node->Split;
+            const size_t nearChild = (difference < 0.0) ? node->Child : (node->Child + 1);
+            const double d2 = cellDistanceSquared - offset[axis] * offset[axis] + difference * difference;
+            if (d2 < best) {
+                Pending & far = stack[top];
+                far.Node = (difference < 0.0) ? (node->Child + 1) : node->Child;
+                far.DistanceSquared = d2;
+                far.Offset[0] = offset[0];
+                far.Offset[1] = offset[1];
+                far.Offset[2] = offset[2];
+                far.Offset[axis] = difference;
+                ++top;
+            }
+            node = &(Nodes[nearChild]);
+        }
+        size_t i;
+        for (i = node->Begin; i < node->End; i++) {
+            const double dx = X[i] - q[0];
+            const double dy = Y[i] - q[1];
+            const double dz = Z[i] - q[2];
+            const double d2 = dx * dx + dy * dy + dz * dz;
+            if (d2 < best) {
+                best = d2;
+                bestIndex = Index[i];
+            }
+        }
+    }
+    if (bestIndex >= Points.size()) {
+        return false;
+    }
+    index = bestIndex;
+    distanceSquared = best;
+    return true;
+}
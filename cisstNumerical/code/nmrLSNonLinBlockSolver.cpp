@@ -0,0 +1,369 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstNumerical/nmrLSNonLinBlockSolver.h>
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnTypeTraits.h>
+
+#include <algorithm>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+nmrLSNonLinBlockSolver::nmrLSNonLinBlockSolver(size_t numberOfParameters):
+    NumberOfParameters(numberOfParameters),
+    NumberOfResiduals(0),
+    MaxBlockResiduals(0),
+    MaxBlockParameters(0),
+    MaxIterations(100),
+    FunctionTolerance(1e-10),
+    StepTolerance(1e-10),
+    GradientTolerance(1e-10),
+    InitialDamping(1e-3),
+    Termination(NOT_SOLVED),
+    Iterations(0),
+    InitialCost(0.0),
+    Cost(0.0)
+{
+}
+
+
+void nmrLSNonLinBlockSolver::SetNumberOfParameters(size_t numberOfParameters)
+{
+    NumberOfParameters = numberOfParameters;
+    ClearBlocks();
+}
+
+
+size_t nmrLSNonLinBlockSolver::AddBlock(size_t numberOfResiduals)
+{
+    BlockResiduals.push_back(numberOfResiduals);
+    BlockIndicesBegin.push_back(ParameterIndices.size());
+    BlockIndicesEnd.push_back(ParameterIndices.size());
+    NumberOfResiduals += numberOfResiduals;
+    MaxBlockResiduals = std::max(MaxBlockResiduals, numberOfResiduals);
+    MaxBlockParameters = NumberOfParameters;
+    return BlockResiduals.size() - 1;
+}
+
+
+size_t nmrLSNonLinBlockSolver::AddBlock(size_t numberOfResiduals, const std::vector<size_t> & parameterIndices)
+{
+    const size_t size = parameterIndices.size();
+    if (size == 0) {
+        cmnThrow(std::runtime_error("nmrLSNonLinBlockSolver::AddBlock: block without parameter"));
+    }
+    std::vector<size_t> sorted(parameterIndices);
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted.back() >= NumberOfParameters) {
+        cmnThrow(std::runtime_error("nmrLSNonLinBlockSolver::AddBlock: parameter index out of range"));
+    }
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+        cmnThrow(std::runtime_error("nmrLSNonLinBlockSolver::AddBlock: repeated parameter index"));
+    }
+    BlockResiduals.push_back(numberOfResiduals);
+    BlockIndicesBegin.push_back(ParameterIndices.size());
+    ParameterIndices.insert(ParameterIndices.end(), parameterIndices.begin(), parameterIndices.end());
+    BlockIndicesEnd.push_back(ParameterIndices.size());
+    NumberOfResiduals += numberOfResiduals;
+    MaxBlockResiduals = std::max(MaxBlockResiduals, numberOfResiduals);
+    MaxBlockParameters = std::max(MaxBlockParameters, size);
+    return BlockResiduals.size() - 1;
+}
+
+
+void nmrLSNonLinBlockSolver::ClearBlocks(void)
+{
+    NumberOfResiduals = 0;
+    BlockResiduals.clear();
+    BlockIndicesBegin.clear();
+    BlockIndicesEnd.clear();
+    ParameterIndices.clear();
+    MaxBlockResiduals = 0;
+    MaxBlockParameters = 0;
+}
+
+
+void nmrLSNonLinBlockSolver::SetTolerances(double function, double step, double gradient)
+{
+    FunctionTolerance = function;
+    StepTolerance = step;
+    GradientTolerance = gradient;
+}
+
+
+bool nmrLSNonLinBlockSolver::Solve(const Problem & problem, vctDynamicVector<double> & parameters)
+{
+    if (parameters.size() != NumberOfParameters) {
+        cmnThrow(std::runtime_error("nmrLSNonLinBlockSolver::Solve: size of parameters doesn't match number of parameters"));
+    }
+    Termination = FAILED;
+    Iterations = 0;
+    InitialCost = 0.0;
+    Cost = 0.0;
+    if (BlockResiduals.empty() || (NumberOfParameters == 0)) {
+        CMN_LOG_RUN_WARNING << "nmrLSNonLinBlockSolver: no block or no parameter to solve for" << std::endl;
+        return false;
+    }
+
+    const size_t n = NumberOfParameters;
+    Normal.SetSize(n, n, VCT_ROW_MAJOR);
+    TrialNormal.SetSize(n, n, VCT_ROW_MAJOR);
+    Factor.SetSize(n, n, VCT_ROW_MAJOR);
+    Gradient.SetSize(n);
+    TrialGradient.SetSize(n);
+    TrialParameters.SetSize(n);
+    Scaling.SetSize(n);
+    Step.SetSize(n);
+
+    if (!Accumulate(problem, parameters, Cost, Normal, Gradient)) {
+        CMN_LOG_RUN_WARNING << "nmrLSNonLinBlockSolver: residuals can't be evaluated for initial parameters" << std::endl;
+        return false;
+    }
+    InitialCost = Cost;
+
+    double damping = InitialDamping;
+    double dampingFactor = 2.0;
+    size_t i;
+    while (true) {
+        if (Gradient.MaxAbsElement() <= GradientTolerance) {
+            Termination = CONVERGED_GRADIENT;
+            return true;
+        }
+        if (Iterations == MaxIterations) {
+            Termination = MAX_ITERATIONS;
+            return true;
+        }
+        Iterations++;
+        if (!SolveDamped(damping)) {
+            damping *= dampingFactor;
+            dampingFactor *= 2.0;
+            continue;
+        }
+        if (Step.Norm() <= StepTolerance * (parameters.Norm() + StepTolerance)) {
+            Termination = CONVERGED_STEP;
+            return true;
+        }
+
+        // decrease predicted by the linear model
+        double predicted = 0.0;
+        for (i = 0; i < n; i++) {
+            predicted += Step[i] * (damping * Scaling[i] * Step[i] - Gradient[i]);
+        }
+        predicted *= 0.5;
+
+        TrialParameters.SumOf(parameters, Step);
+        double trialCost;
+        if (Accumulate(problem, TrialParameters, trialCost, TrialNormal, TrialGradient)
+            && (trialCost < Cost)) {
+            const double decrease = Cost - trialCost;
+            const double ratio = (predicted > 0.0) ? (decrease / predicted) : 1.0;
+            parameters.Assign(TrialParameters);
+            Normal.Assign(TrialNormal);
+            Gradient.Assign(TrialGradient);
+            Cost = trialCost;
+            if (decrease <= FunctionTolerance * (Cost + decrease)) {
+                Termination = CONVERGED_FUNCTION;
+                return true;
+            }
+            const double factor = 2.0 * ratio - 1.0;
+            damping *= std::max(1.0 / 3.0, 1.0 - factor * factor * factor);
+            dampingFactor = 2.0;
+        } else {
+            damping *= dampingFactor;
+            dampingFactor *= 2.0;
+        }
+    }
+}
+
+
+bool nmrLSNonLinBlockSolver::Accumulate(const Problem & problem, const vctDynamicVector<double> & parameters,
+                                        double & cost, vctDynamicMatrix<double> & normal,
+                                        vctDynamicVector<double> & gradient)
+{
+    const size_t numberOfBlocks = BlockResiduals.size();
+    size_t numberOfRanges = 1;
+#ifdef _OPENMP
+    numberOfRanges = static_cast<size_t>(omp_get_max_threads());
+#endif
+    numberOfRanges = std::max(static_cast<size_t>(1), std::min(numberOfRanges, numberOfBlocks));
+
+    // workspace, only allocated if the sizes change
+    const size_t n = NumberOfParameters;
+    RangeNormals.resize(numberOfRanges);
+    RangeGradients.resize(numberOfRanges);
+    RangeCosts.resize(numberOfRanges);
+    RangeValid.resize(numberOfRanges);
+    RangeResiduals.resize(numberOfRanges);
+    RangeJacobians.resize(numberOfRanges);
+    size_t range;
+    for (range = 0; range < numberOfRanges; range++) {
+        RangeNormals[range].SetSize(n, n, VCT_ROW_MAJOR);
+        RangeGradients[range].SetSize(n);
+        RangeResiduals[range].SetSize(MaxBlockResiduals);
+        RangeJacobians[range].SetSize(MaxBlockResiduals, MaxBlockParameters, VCT_ROW_MAJOR);
+    }
+
+    // each range of blocks has its own normal equations
+    const int size = static_cast<int>(numberOfRanges);
+    int index;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (index = 0; index < size; index++) {
+        const size_t begin = (numberOfBlocks * index) / numberOfRanges;
+        const size_t end = (numberOfBlocks * (index + 1)) / numberOfRanges;
+        RangeValid[index] = AccumulateRange(problem, parameters, index, begin, end) ? 1 : 0;
+    }
+
+    cost = 0.0;
+    normal.SetAll(0.0);
+    gradient.SetAll(0.0);
+    for (range = 0; range < numberOfRanges; range++) {
+        if (!RangeValid[range]) {
+            return false;
+        }
+        cost += RangeCosts[range];
+        normal.Add(RangeNormals[range]);
+        gradient.Add(RangeGradients[range]);
+    }
+    // residuals not finite
+    return (cost <= cmnTypeTraits<double>::MaxPositiveValue());
+}
+
+
+bool nmrLSNonLinBlockSolver::AccumulateRange(const Problem & problem, const vctDynamicVector<double> & parameters,
+                                             size_t range, size_t begin, size_t end)
+{
+    const size_t n = NumberOfParameters;
+    double * normal = RangeNormals[range].Pointer();
+    double * gradient = RangeGradients[range].Pointer();
+    RangeNormals[range].SetAll(0.0);
+    RangeGradients[range].SetAll(0.0);
+    double cost = 0.0;
+
+    size_t block, row, a, b;
+    for (block = begin; block < end; block++) {
+        const size_t numberOfResiduals = BlockResiduals[block];
+        const size_t * indices = ParameterIndices.empty() ? 0 : &(ParameterIndices[0]) + BlockIndicesBegin[block];
+        const bool allParameters = (BlockIndicesBegin[block] == BlockIndicesEnd[block]);
+        const size_t numberOfColumns = allParameters ? n : (BlockIndicesEnd[block] - BlockIndicesBegin[block]);
+        vctDynamicVectorRef<double> residual(numberOfResiduals, RangeResiduals[range].Pointer());
+        vctDynamicMatrixRef<double> jacobian(numberOfResiduals, numberOfColumns,
+                                             RangeJacobians[range].Pointer(), VCT_ROW_MAJOR);
+        residual.SetAll(0.0);
+        jacobian.SetAll(0.0);
+        if (!problem.EvaluateBlock(block, parameters, residual, jacobian)) {
+            RangeCosts[range] = 0.0;
+            return false;
+        }
+
+        // upper triangle of J^T J and J^T r, one row of J at a time
+        for (row = 0; row < numberOfResiduals; row++) {
+            const double r = residual[row];
+            const double * J = jacobian.Pointer(row, 0);
+            cost += 0.5 * r * r;
+            if (allParameters) {
+                for (a = 0; a < numberOfColumns; a++) {
+                    const double Ja = J[a];
+                    gradient[a] += Ja * r;
+                    if (Ja != 0.0) {
+                        double * normalRow = normal + a * n;
+                        for (b = a; b < numberOfColumns; b++) {
+                            normalRow[b] += Ja * J[b];
+                        }
+                    }
+                }
+            } else {
+                for (a = 0; a < numberOfColumns; a++) {
+                    const double Ja = J[a];
+                    const size_t ia = indices[a];
+                    gradient[ia] += Ja * r;
+                    if (Ja != 0.0) {
+                        for (b = a; b < numberOfColumns; b++) {
+                            const size_t ib = indices[b];
+                            if (ia <= ib) {
+                                normal[ia * n + ib] += Ja * J[b];
+                            } else {
+                                normal[ib * n + ia] += Ja * J[b];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    RangeCosts[range] = cost;
+    return true;
+}
+
+
+bool nmrLSNonLinBlockSolver::SolveDamped(double damping)
+{
+    const size_t n = NumberOfParameters;
+    size_t i, j, k;
+    // Marquardt scaling, parameters without influence get a unit scale
+    for (i = 0; i < n; i++) {
+        const double diagonal = Normal.Element(i, i);
+        Scaling[i] = (diagonal > 0.0) ? diagonal : 1.0;
+    }
+
+    // Cholesky factor L, lower triangle, of the damped matrix
+    for (j = 0; j < n; j++) {
+        double * lj = Factor.Pointer(j, 0);
+        double sum = Normal.Element(j, j) + damping * Scaling[j];
+        for (k = 0; k < j; k++) {
+            sum -= lj[k] * lj[k];
+        }
+        if (!(sum > 0.0)) {
+            return false;
+        }
+        lj[j] = sqrt(sum);
+        for (i = j + 1; i < n; i++) {
+            double * li = Factor.Pointer(i, 0);
+            double value = Normal.Element(j, i);
+            for (k = 0; k < j; k++) {
+                value -= li[k] * lj[k];
+            }
+            li[j] = value / lj[j];
+        }
+    }
+
+    // L L^T step = -gradient
+    for (i = 0; i < n; i++) {
+        const double * li = Factor.Pointer(i, 0);
+        double value = -Gradient[i];
+        for (k = 0; k < i; k++) {
+            value -= li[k] * Step[k];
+        }
+        Step[i] = value / li[i];
+    }
+    for (i = n; i-- > 0; ) {
+        double value = Step[i];
+        for (k = i + 1; k < n; k++) {
+            value -= Factor.Element(k, i) * Step[k];
+        }
+        Step[i] = value / Factor.Element(i, i);
+    }
+    return true;
+}
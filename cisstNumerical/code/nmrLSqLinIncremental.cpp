@@ -0,0 +1,603 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s): agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnTypeTraits.h>
+#include <cisstNumerical/nmrLSqLinIncremental.h>
+
+#include <math.h>
+#include <algorithm>
+
+
+nmrLSqLinIncremental::nmrLSqLinIncremental(void):
+    Ma(0), Me(0), Mg(0), N(0),
+    Violation(0.0),
+    PreviousValid(false),
+    NumberOfWorking(0),
+    Tolerance(cmnTypeTraits<double>::Tolerance()),
+    MaxIterations(10),
+    Iterations(0)
+{
+}
+
+
+nmrLSqLinIncremental::nmrLSqLinIncremental(size_t ma, size_t me, size_t mg, size_t n):
+    Tolerance(cmnTypeTraits<double>::Tolerance())
+{
+    Allocate(ma, me, mg, n);
+}
+
+
+void nmrLSqLinIncremental::Allocate(size_t ma, size_t me, size_t mg, size_t n)
+{
+    Ma = ma;
+    Me = me;
+    Mg = mg;
+    N = n;
+    A.SetSize(Ma, N, VCT_ROW_MAJOR);
+    A.SetAll(0.0);
+    b.SetSize(Ma);
+    b.SetAll(0.0);
+    E.SetSize(Me, N, VCT_ROW_MAJOR);
+    E.SetAll(0.0);
+    f.SetSize(Me);
+    f.SetAll(0.0);
+    G.SetSize(Mg, N, VCT_ROW_MAJOR);
+    G.SetAll(0.0);
+    h.SetSize(Mg);
+    h.SetAll(0.0);
+    R.SetSize(N, N, VCT_ROW_MAJOR);
+    R.SetAll(0.0);
+    d.SetSize(N);
+    d.SetAll(0.0);
+    X.SetSize(N);
+    X.SetAll(0.0);
+    Violation = 0.0;
+    Previous.SetSize(N);
+    PreviousValid = false;
+    Active.SetSize(Mg);
+    Active.SetAll(false);
+    // at most N linearly independent constraints
+    NumberOfWorking = 0;
+    Working.SetSize(N);
+    Y.SetSize(N, N, VCT_ROW_MAJOR);
+    L.SetSize(N, N, VCT_ROW_MAJOR);
+    L.SetAll(0.0);
+    Lambda.SetSize(N);
+    Row.SetSize(N);
+    Work.SetSize(N);
+    U.SetSize(N);
+    V.SetSize(N);
+    Z.SetSize(N);
+    Step.SetSize(N);
+    MaxIterations = 3 * (Me + Mg) + 10;
+    Iterations = 0;
+}
+
+
+void nmrLSqLinIncremental::Refactorize(void)
+{
+    R.SetAll(0.0);
+    d.SetAll(0.0);
+    for (size_t i = 0; i < Ma; i++) {
+        Update(A.Row(i).Pointer(), b[i]);
+    }
+}
+
+
+void nmrLSqLinIncremental::UpdateObjectiveRow(size_t index, double value)
+{
+    double * a = A.Row(index).Pointer();
+    if ((value == b[index]) && (Row.Equal(A.Row(index)))) {
+        return;
+    }
+    // update first so that R is less likely to become singular
+    Update(Row.Pointer(), value);
+    const bool downdated = Downdate(a, b[index]);
+    A.Row(index).Assign(Row);
+    b[index] = value;
+    if (!downdated) {
+        Refactorize();
+    }
+}
+
+
+void nmrLSqLinIncremental::Update(const double * a, double value)
+{
+    // Givens rotations of [R d; a value] to eliminate a
+    double * x = Work.Pointer();
+    double * dd = d.Pointer();
+    size_t j, k;
+    for (j = 0; j < N; j++) {
+        x[j] = a[j];
+    }
+    for (j = 0; j < N; j++) {
+        if (x[j] == 0.0) {
+            continue;
+        }
+        double * r = R.Row(j).Pointer();
+        const double norm = sqrt(r[j] * r[j] + x[j] * x[j]);
+        const double c = r[j] / norm;
+        const double s = x[j] / norm;
+        r[j] = norm;
+        for (k = j + 1; k < N; k++) {
+            const double t = c * r[k] + s * x[k];
+            x[k] = c * x[k] - s * r[k];
+            r[k] = t;
+        }
+        const double t = c * dd[j] + s * value;
+        value = c * value - s * dd[j];
+        dd[j] = t;
+    }
+}
+
+
+bool nmrLSqLinIncremental::Downdate(const double * a, double value)
+{
+    // hyperbolic rotations of [R d; a value] to eliminate a, in mixed
+    // form (the updated row of R is used to compute the updated a)
+    double * x = Work.Pointer();
+    double * dd = d.Pointer();
+    size_t j, k;
+    for (j = 0; j < N; j++) {
+        x[j] = a[j];
+    }
+    for (j = 0; j < N; j++) {
+        if (x[j] == 0.0) {
+            continue;
+        }
+        double * r = R.Row(j).Pointer();
+        if (fabs(x[j]) >= r[j] * (1.0 - Tolerance)) {
+            return false;
+        }
+        const double norm = sqrt((r[j] - x[j]) * (r[j] + x[j]));
+        const double c = norm / r[j];
+        const double s = x[j] / r[j];
+        r[j] = norm;
+        for (k = j + 1; k < N; k++) {
+            r[k] = (r[k] - s * x[k]) / c;
+            x[k] = c * x[k] - s * r[k];
+        }
+        dd[j] = (dd[j] - s * value) / c;
+        value = c * value - s * dd[j];
+    }
+    return true;
+}
+
+
+void nmrLSqLinIncremental::ResetActiveSet(void)
+{
+    Active.SetAll(false);
+}
+
+
+size_t nmrLSqLinIncremental::GetNumberOfActiveConstraints(void) const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < Mg; i++) {
+        if (Active[i]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+
+const double * nmrLSqLinIncremental::Constraint(size_t index, double & value) const
+{
+    if (index < Me) {
+        value = f[index];
+        return E.Row(index).Pointer();
+    }
+    value = h[index - Me];
+    return G.Row(index - Me).Pointer();
+}
+
+
+void nmrLSqLinIncremental::SolveRT(const double * c, double * u) const
+{
+    size_t j, k;
+    for (j = 0; j < N; j++) {
+        u[j] = c[j];
+    }
+    for (j = 0; j < N; j++) {
+        const double * r = R.Row(j).Pointer();
+        u[j] /= r[j];
+        for (k = j + 1; k < N; k++) {
+            u[k] -= r[k] * u[j];
+        }
+    }
+}
+
+
+void nmrLSqLinIncremental::SolveR(const double * w, double * x) const
+{
+    size_t j, k;
+    for (j = N; j > 0; j--) {
+        const double * r = R.Row(j - 1).Pointer();
+        double sum = w[j - 1];
+        for (k = j; k < N; k++) {
+            sum -= r[k] * x[k];
+        }
+        x[j - 1] = sum / r[j - 1];
+    }
+}
+
+
+void nmrLSqLinIncremental::SolveLLT(double * v) const
+{
+    const size_t n = NumberOfWorking;
+    size_t i, j;
+    for (i = 0; i < n; i++) {
+        const double * l = L.Row(i).Pointer();
+        double sum = v[i];
+        for (j = 0; j < i; j++) {
+            sum -= l[j] * v[j];
+        }
+        v[i] = sum / l[i];
+    }
+    for (i = n; i > 0; i--) {
+        double sum = v[i - 1];
+        for (j = i; j < n; j++) {
+            sum -= L.Element(j, i - 1) * v[j];
+        }
+        v[i - 1] = sum / L.Element(i - 1, i - 1);
+    }
+}
+
+
+bool nmrLSqLinIncremental::AddToWorkingSet(size_t index)
+{
+    double value;
+    const size_t k = NumberOfWorking;
+    if (k == N) {
+        return false;
+    }
+    double * u = Y.Row(k).Pointer();
+    double * l = L.Row(k).Pointer();
+    SolveRT(Constraint(index, value), u);
+    // new row of the Cholesky factor of Y Y^T
+    double uu = 0.0;
+    size_t i, j;
+    for (j = 0; j < N; j++) {
+        uu += u[j] * u[j];
+    }
+    double ll = uu;
+    for (i = 0; i < k; i++) {
+        const double * y = Y.Row(i).Pointer();
+        const double * li = L.Row(i).Pointer();
+        double sum = 0.0;
+        for (j = 0; j < N; j++) {
+            sum += y[j] * u[j];
+        }
+        for (j = 0; j < i; j++) {
+            sum -= li[j] * l[j];
+        }
+        l[i] = sum / li[i];
+        ll -= l[i] * l[i];
+    }
+    if (ll <= Tolerance * uu) {
+        return false;
+    }
+    l[k] = sqrt(ll);
+    Working[k] = index;
+    NumberOfWorking++;
+    return true;
+}
+
+
+void nmrLSqLinIncremental::RemoveFromWorkingSet(size_t position)
+{
+    size_t i, j, k;
+    NumberOfWorking--;
+    for (i = position; i < NumberOfWorking; i++) {
+        Working[i] = Working[i + 1];
+        Lambda[i] = Lambda[i + 1];
+        Y.Row(i).Assign(Y.Row(i + 1));
+    }
+    // Cholesky factor of Y Y^T from scratch, the working set is small
+    for (i = 0; i < NumberOfWorking; i++) {
+        const double * yi = Y.Row(i).Pointer();
+        double * li = L.Row(i).Pointer();
+        for (j = 0; j <= i; j++) {
+            const double * yj = Y.Row(j).Pointer();
+            const double * lj = L.Row(j).Pointer();
+            double sum = 0.0;
+            for (k = 0; k < N; k++) {
+                sum += yi[k] * yj[k];
+            }
+            for (k = 0; k < j; k++) {
+                sum -= li[k] * lj[k];
+            }
+            if (j < i) {
+                li[j] = sum / lj[j];
+            } else {
+                li[i] = sqrt(sum > 0.0 ? sum : 0.0);
+            }
+        }
+    }
+}
+
+
+void nmrLSqLinIncremental::SolveWorkingSet(void)
+{
+    // with w = R x, minimize || w - d || s.t. Y w = e: w = d + Y^T lambda
+    // and the multipliers are the solution of Y Y^T lambda = e - Y d
+    const size_t n = NumberOfWorking;
+    double * lambda = Lambda.Pointer();
+    double value;
+    size_t i, j;
+    for (i = 0; i < n; i++) {
+        Constraint(Working[i], value);
+        const double * y = Y.Row(i).Pointer();
+        for (j = 0; j < N; j++) {
+            value -= y[j] * d[j];
+        }
+        lambda[i] = value;
+    }
+    SolveLLT(lambda);
+    double * w = Step.Pointer();
+    for (j = 0; j < N; j++) {
+        w[j] = d[j];
+    }
+    for (i = 0; i < n; i++) {
+        const double * y = Y.Row(i).Pointer();
+        for (j = 0; j < N; j++) {
+            w[j] += lambda[i] * y[j];
+        }
+    }
+    SolveR(w, X.Pointer());
+}
+
+
+nmrLSqLinIncremental::STATUS nmrLSqLinIncremental::Solve(void)
+{
+    const STATUS status = SolveActiveSet();
+    Violation = ConstraintViolation(X.Pointer());
+    if (status == NMR_OK) {
+        Previous.Assign(X);
+        PreviousValid = true;
+    } else if ((status == NMR_MAX_ITERATIONS) && PreviousValid) {
+        // the iterate violates some constraints, use the previous
+        // solution if it is closer to the new feasible set
+        const double previousViolation = ConstraintViolation(Previous.Pointer());
+        if (previousViolation < Violation) {
+            X.Assign(Previous);
+            Violation = previousViolation;
+        }
+    }
+    return status;
+}
+
+
+double nmrLSqLinIncremental::ConstraintViolation(const double * x) const
+{
+    double violation = 0.0;
+    size_t i, j;
+    for (i = 0; i < Me; i++) {
+        const double * e = E.Row(i).Pointer();
+        double value = -f[i];
+        for (j = 0; j < N; j++) {
+            value += e[j] * x[j];
+        }
+        violation = std::max(violation, fabs(value));
+    }
+    for (i = 0; i < Mg; i++) {
+        const double * g = G.Row(i).Pointer();
+        double value = h[i];
+        for (j = 0; j < N; j++) {
+            value -= g[j] * x[j];
+        }
+        violation = std::max(violation, value);
+    }
+    return violation;
+}
+
+
+nmrLSqLinIncremental::STATUS nmrLSqLinIncremental::SolveActiveSet(void)
+{
+    size_t i, j;
+    double value;
+    Iterations = 0;
+    NumberOfWorking = 0;
+
+    double maxDiagonal = 0.0;
+    for (j = 0; j < N; j++) {
+        maxDiagonal = std::max(maxDiagonal, R.Element(j, j));
+    }
+    for (j = 0; j < N; j++) {
+        if (R.Element(j, j) <= Tolerance * maxDiagonal || maxDiagonal == 0.0) {
+            return NMR_RANK_DEFICIENT;
+        }
+    }
+
+    // warm start: equality constraints and previous active set, then
+    // drop the constraints with a negative multiplier to find a dual
+    // feasible starting point
+    for (i = 0; i < Me; i++) {
+        AddToWorkingSet(i);
+    }
+    for (i = 0; i < Mg; i++) {
+        if (Active[i]) {
+            Active[i] = AddToWorkingSet(Me + i);
+        }
+    }
+    while (true) {
+        SolveWorkingSet();
+        size_t position = NumberOfWorking;
+        double minLambda = 0.0;
+        for (i = 0; i < NumberOfWorking; i++) {
+            if ((Working[i] >= Me) && (Lambda[i] < minLambda)) {
+                minLambda = Lambda[i];
+                position = i;
+            }
+        }
+        if (position == NumberOfWorking) {
+            break;
+        }
+        Active[Working[position] - Me] = false;
+        RemoveFromWorkingSet(position);
+    }
+
+    // Goldfarb-Idnani: add the most violated constraint, dropping the
+    // constraints whose multiplier would become negative
+    double * u = U.Pointer();
+    double * v = V.Pointer();
+    double * z = Z.Pointer();
+    double * x = X.Pointer();
+    double * lambda = Lambda.Pointer();
+    while (true) {
+        size_t p = Mg;
+        double minSlack = 0.0;
+        for (i = 0; i < Mg; i++) {
+            if (Active[i]) {
+                continue;
+            }
+            const double * g = G.Row(i).Pointer();
+            double slack = -h[i];
+            for (j = 0; j < N; j++) {
+                slack += g[j] * x[j];
+            }
+            if ((slack < -Tolerance * (1.0 + fabs(h[i]))) && (slack < minSlack)) {
+                minSlack = slack;
+                p = i;
+            }
+        }
+        if (p == Mg) {
+            break;
+        }
+        if (Iterations == MaxIterations) {
+            return NMR_MAX_ITERATIONS;
+        }
+        Iterations++;
+
+        const double * g = G.Row(p).Pointer();
+        SolveRT(g, u);
+        double uu = 0.0;
+        for (j = 0; j < N; j++) {
+            uu += u[j] * u[j];
+        }
+        double lambdaP = 0.0;
+        while (true) {
+            // step direction in w = R x: projection of u on the null
+            // space of Y, v are the multiplier directions
+            const size_t n = NumberOfWorking;
+            for (i = 0; i < n; i++) {
+                const double * y = Y.Row(i).Pointer();
+                double sum = 0.0;
+                for (j = 0; j < N; j++) {
+                    sum += y[j] * u[j];
+                }
+                v[i] = sum;
+            }
+            SolveLLT(v);
+            double zz = 0.0;
+            for (j = 0; j < N; j++) {
+                z[j] = u[j];
+            }
+            for (i = 0; i < n; i++) {
+                const double * y = Y.Row(i).Pointer();
+                for (j = 0; j < N; j++) {
+                    z[j] -= v[i] * y[j];
+                }
+            }
+            for (j = 0; j < N; j++) {
+                zz += z[j] * z[j];
+            }
+            // partial step, largest step keeping the multipliers positive
+            size_t position = n;
+            double partialStep = 0.0;
+            for (i = 0; i < n; i++) {
+                if ((Working[i] >= Me) && (v[i] > 0.0)) {
+                    const double t = lambda[i] / v[i];
+                    if ((position == n) || (t < partialStep)) {
+                        partialStep = t;
+                        position = i;
+                    }
+                }
+            }
+            const bool dependent = (zz <= Tolerance * uu);
+            if (dependent && (position == n)) {
+                return NMR_INEQ_CONTRADICTION;
+            }
+            // full step, constraint p becomes active
+            double slack = -h[p];
+            for (j = 0; j < N; j++) {
+                slack += g[j] * x[j];
+            }
+            const double fullStep = dependent ? 0.0 : -slack / zz;
+            const double t = (dependent || (position < n && partialStep < fullStep)) ? partialStep : fullStep;
+            if (!dependent) {
+                SolveR(z, Step.Pointer());
+                for (j = 0; j < N; j++) {
+                    x[j] += t * Step[j];
+                }
+            }
+            for (i = 0; i < n; i++) {
+                lambda[i] -= t * v[i];
+            }
+            lambdaP += t;
+            if (t == fullStep && !dependent) {
+                if (AddToWorkingSet(Me + p)) {
+                    lambda[NumberOfWorking - 1] = lambdaP;
+                    Active[p] = true;
+                }
+                break;
+            }
+            Active[Working[position] - Me] = false;
+            RemoveFromWorkingSet(position);
+        }
+    }
+
+    // equality constraints skipped because they are linearly dependent,
+    // the other ones are at the beginning of the working set
+    size_t position = 0;
+    for (i = 0; i < Me; i++) {
+        if ((position < NumberOfWorking) && (Working[position] == i)) {
+            position++;
+            continue;
+        }
+        const double * e = Constraint(i, value);
+        for (j = 0; j < N; j++) {
+            value -= e[j] * x[j];
+        }
+        if (fabs(value) > Tolerance * (1.0 + fabs(f[i]))) {
+            return NMR_EQ_CONTRADICTION;
+        }
+    }
+    return NMR_OK;
+}
+
+
+const char * nmrLSqLinIncremental::GetStatusString(STATUS status)
+{
+    switch (status) {
+    case NMR_OK:
+        return "Both equality and inequality constraints are compatible and have been satisfied.";
+    case NMR_EQ_CONTRADICTION:
+        return "Equality constraints are contradictory.";
+    case NMR_INEQ_CONTRADICTION:
+        return "Inequality constraints are contradictory.";
+    case NMR_RANK_DEFICIENT:
+        return "The objective matrix doesn't have full column rank.";
+    case NMR_MAX_ITERATIONS:
+        return "The maximum number of iterations has been reached.";
+    default:
+        return "Invalid status.";
+    }
+}
@@ -0,0 +1,283 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstNumerical/nmrPolynomialHornerEvaluator.h>
+#include <cisstNumerical/nmrMultiVariablePowerBasis.h>
+
+#include <algorithm>
+
+
+bool nmrPolynomialHornerEvaluator::Term::operator < (const Term & other) const
+{
+    // highest powers first, variable 0 first
+    const size_t size = Powers.size();
+    size_t variable;
+    for (variable = 0; variable < size; variable++) {
+        if (Powers[variable] != other.Powers[variable]) {
+            return (Powers[variable] > other.Powers[variable]);
+        }
+    }
+    return false;
+}
+
+
+nmrPolynomialHornerEvaluator::nmrPolynomialHornerEvaluator(void):
+    NumVariables(0),
+    MaxDepth(1)
+{
+    AddOperation(PUSH_CONSTANT, 0, 0, 0.0);
+    Stack.SetSize(BLOCK_SIZE);
+}
+
+
+nmrPolynomialHornerEvaluator::nmrPolynomialHornerEvaluator(const nmrDynAllocPolynomialContainer & polynomial):
+    NumVariables(0),
+    MaxDepth(1)
+{
+    Compile(polynomial);
+}
+
+
+void nmrPolynomialHornerEvaluator::Compile(const nmrDynAllocPolynomialContainer & polynomial)
+{
+    NumVariables = polynomial.GetNumVariables();
+    Operations.clear();
+
+    // the basis of a term evaluated with all variables equal to one
+    // gives the factor of the term, e.g. the multinomial factor for
+    // Bernstein polynomials
+    nmrMultiVariablePowerBasis::StandardPowerBasis ones(NumVariables, polynomial.GetMaxDegree());
+    std::vector<nmrMultiVariablePowerBasis::VariableType> values(NumVariables, 1.0);
+    ones.SetVariables(&(values[0]));
+
+    std::vector<Term> terms;
+    terms.reserve(polynomial.GetNumberOfTerms());
+    nmrDynAllocPolynomialContainer::TermConstIteratorType termIterator = polynomial.FirstTermIterator();
+    const nmrDynAllocPolynomialContainer::TermConstIteratorType endTermIterator = polynomial.EndTermIterator();
+    VariableIndexType variable;
+    for (; termIterator != endTermIterator; ++termIterator) {
+        const ValueType coefficient = polynomial.GetCoefficient(termIterator)
+            * polynomial.EvaluateBasis(termIterator, ones);
+        if (coefficient != 0.0) {
+            Term term;
+            term.Coefficient = coefficient;
+            term.Powers.resize(NumVariables);
+            const nmrPolynomialTermPowerIndex & powers = polynomial.GetTermPowerIndex(termIterator);
+            for (variable = 0; variable < NumVariables; variable++) {
+                term.Powers[variable] = powers.GetPower(variable);
+            }
+            terms.push_back(term);
+        }
+    }
+    std::sort(terms.begin(), terms.end());
+
+    if (terms.empty()) {
+        AddOperation(PUSH_CONSTANT, 0, 0, 0.0);
+    } else {
+        CompileTerms(terms, 0, terms.size(), 0);
+    }
+
+    // workspace for the powers and the stack
+    MaxPowers.assign(NumVariables, 1);
+    PowerOffsets.assign(NumVariables, 0);
+    size_t depth = 0;
+    MaxDepth = 0;
+    const size_t numberOfOperations = Operations.size();
+    size_t index;
+    for (index = 0; index < numberOfOperations; index++) {
+        const Operation & operation = Operations[index];
+        switch (operation.Code) {
+        case PUSH_CONSTANT:
+            depth++;
+            MaxDepth = std::max(MaxDepth, depth);
+            break;
+        case ADD:
+            depth--;
+            break;
+        default:
+            MaxPowers[operation.Variable] = std::max(MaxPowers[operation.Variable], operation.Power);
+        }
+    }
+    size_t numberOfPowers = 0;
+    for (variable = 0; variable < NumVariables; variable++) {
+        PowerOffsets[variable] = numberOfPowers;
+        numberOfPowers += MaxPowers[variable] - 1;
+    }
+    Variables.SetSize(NumVariables * BLOCK_SIZE);
+    Variables.SetAll(0.0);
+    Powers.SetSize(numberOfPowers * BLOCK_SIZE);
+    Stack.SetSize(MaxDepth * BLOCK_SIZE);
+}
+
+
+void nmrPolynomialHornerEvaluator::CompileTerms(const std::vector<Term> & terms, size_t begin, size_t end,
+                                                VariableIndexType variable)
+{
+    // terms are grouped by power of the current variable, highest
+    // power first, each group is a polynomial of the next variables
+    const bool lastVariable = (variable == (NumVariables - 1));
+    PowerType previousPower = 0;
+    size_t groupBegin = begin;
+    while (groupBegin < end) {
+        const PowerType power = terms[groupBegin].Powers[variable];
+        size_t groupEnd = groupBegin + 1;
+        while ((groupEnd < end) && (terms[groupEnd].Powers[variable] == power)) {
+            groupEnd++;
+        }
+        if (lastVariable) {
+            // terms are unique, the group has a single term
+            if (groupBegin == begin) {
+                AddOperation(PUSH_CONSTANT, variable, 0, terms[groupBegin].Coefficient);
+            } else {
+                AddOperation(MULTIPLY_POWER_ADD_CONSTANT, variable, previousPower - power,
+                             terms[groupBegin].Coefficient);
+            }
+        } else {
+            if (groupBegin == begin) {
+                CompileTerms(terms, groupBegin, groupEnd, variable + 1);
+            } else {
+                AddOperation(MULTIPLY_POWER, variable, previousPower - power);
+                CompileTerms(terms, groupBegin, groupEnd, variable + 1);
+                AddOperation(ADD, variable, 0);
+            }
+        }
+        previousPower = power;
+        groupBegin = groupEnd;
+    }
+    if (previousPower > 0) {
+        AddOperation(MULTIPLY_POWER, variable, previousPower);
+    }
+}
+
+
+void nmrPolynomialHornerEvaluator::AddOperation(OperationCode code, VariableIndexType variable, PowerType power,
+                                                ValueType constant)
+{
+    Operation operation;
+    operation.Code = code;
+    operation.Variable = variable;
+    operation.Power = power;
+    operation.Constant = constant;
+    Operations.push_back(operation);
+}
+
+
+nmrPolynomialHornerEvaluator::ValueType
+nmrPolynomialHornerEvaluator::Evaluate(const ValueType variables[])
+{
+    VariableIndexType variable;
+    for (variable = 0; variable < NumVariables; variable++) {
+        Variables[variable * BLOCK_SIZE] = variables[variable];
+    }
+    EvaluateBlock(1);
+    return Stack[0];
+}
+
+
+void nmrPolynomialHornerEvaluator::EvaluatePoints(const ValueType * points, ptrdiff_t variableStride, ptrdiff_t pointStride,
+                                                  size_t numberOfPoints, ValueType * values, ptrdiff_t valueStride)
+{
+    size_t blockBegin, index;
+    VariableIndexType variable;
+    for (blockBegin = 0; blockBegin < numberOfPoints; blockBegin += BLOCK_SIZE) {
+        const size_t blockSize = std::min(static_cast<size_t>(BLOCK_SIZE), numberOfPoints - blockBegin);
+        for (variable = 0; variable < NumVariables; variable++) {
+            const ValueType * input = points + variable * variableStride + blockBegin * pointStride;
+            ValueType * output = Variables.Pointer() + variable * BLOCK_SIZE;
+            for (index = 0; index < blockSize; index++) {
+                output[index] = input[index * pointStride];
+            }
+        }
+        EvaluateBlock(blockSize);
+        const ValueType * result = Stack.Pointer();
+        ValueType * output = values + blockBegin * valueStride;
+        for (index = 0; index < blockSize; index++) {
+            output[index * valueStride] = result[index];
+        }
+    }
+}
+
+
+void nmrPolynomialHornerEvaluator::EvaluateBlock(size_t numberOfPoints)
+{
+    size_t index;
+    VariableIndexType variable;
+    PowerType power;
+    // powers of the variables used by the scheme
+    for (variable = 0; variable < NumVariables; variable++) {
+        const ValueType * x = PowerBlock(variable, 1);
+        const ValueType * previous = x;
+        for (power = 2; power <= MaxPowers[variable]; power++) {
+            ValueType * current = Powers.Pointer() + (PowerOffsets[variable] + power - 2) * BLOCK_SIZE;
+            for (index = 0; index < numberOfPoints; index++) {
+                current[index] = previous[index] * x[index];
+            }
+            previous = current;
+        }
+    }
+
+    ValueType * stack = Stack.Pointer();
+    size_t top = 0;
+    const size_t numberOfOperations = Operations.size();
+    size_t operationIndex;
+    for (operationIndex = 0; operationIndex < numberOfOperations; operationIndex++) {
+        const Operation & operation = Operations[operationIndex];
+        const ValueType constant = operation.Constant;
+        switch (operation.Code) {
+        case PUSH_CONSTANT:
+            {
+                ValueType * value = stack + top * BLOCK_SIZE;
+                for (index = 0; index < numberOfPoints; index++) {
+                    value[index] = constant;
+                }
+                top++;
+            }
+            break;
+        case MULTIPLY_POWER:
+            {
+                ValueType * value = stack + (top - 1) * BLOCK_SIZE;
+                const ValueType * x = PowerBlock(operation.Variable, operation.Power);
+                for (index = 0; index < numberOfPoints; index++) {
+                    value[index] *= x[index];
+                }
+            }
+            break;
+        case MULTIPLY_POWER_ADD_CONSTANT:
+            {
+                ValueType * value = stack + (top - 1) * BLOCK_SIZE;
+                const ValueType * x = PowerBlock(operation.Variable, operation.Power);
+                for (index = 0; index < numberOfPoints; index++) {
+                    value[index] = value[index] * x[index] + constant;
+                }
+            }
+            break;
+        case ADD:
+            {
+                top--;
+                ValueType * value = stack + (top - 1) * BLOCK_SIZE;
+                const ValueType * term = stack + top * BLOCK_SIZE;
+                for (index = 0; index < numberOfPoints; index++) {
+                    value[index] += term[index];
+                }
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,269 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstNumerical/nmrRegistrationICP.h>
+#include <cisstNumerical/nmrSVDJacobi.h>
+#include <cisstVector/vctDeterminant.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <algorithm>
+#include <math.h>
+
+
+nmrRegistrationICP::nmrRegistrationICP(void):
+    MaxIterations(50),
+    Tolerance(1e-6),
+    MaxDistance(cmnTypeTraits<double>::MaxPositiveValue()),
+    TrimRatio(1.0),
+    Weighting(WEIGHT_NONE),
+    WeightingScale(0.0),
+    RMS(0.0),
+    Iterations(0),
+    Converged(false),
+    Inliers(0)
+{
+}
+
+
+bool nmrRegistrationICP::Register(const vct3 * data, size_t size, ptrdiff_t stride, vctFrm3 & transform)
+{
+    RMS = 0.0;
+    Iterations = 0;
+    Converged = false;
+    Inliers = 0;
+    if (Tree.size() == 0) {
+        CMN_LOG_RUN_WARNING << "nmrRegistrationICP: model is not set" << std::endl;
+        return false;
+    }
+    if (size < 3) {
+        CMN_LOG_RUN_WARNING << "nmrRegistrationICP called for " << size << " points" << std::endl;
+        return false;
+    }
+    // keep the correspondences of the previous call as hints if possible
+    if (Correspondences.size() != size) {
+        Correspondences.assign(size, Tree.size());
+    }
+    DistancesSquared.resize(size);
+    Weights.resize(size);
+
+    double previousRMS = 0.0;
+    while (true) {
+        FindCorrespondences(data, stride, transform);
+        Inliers = ComputeWeights();
+        if (Inliers < 3) {
+            CMN_LOG_RUN_WARNING << "nmrRegistrationICP: only " << Inliers
+                                << " pairs after outlier rejection" << std::endl;
+            return false;
+        }
+        double sumOfWeights = 0.0;
+        double sumOfErrors = 0.0;
+        size_t i;
+        for (i = 0; i < size; i++) {
+            if (Weights[i] > 0.0) {
+                sumOfWeights += Weights[i];
+                sumOfErrors += Weights[i] * DistancesSquared[i];
+            }
+        }
+        RMS = sqrt(sumOfErrors / sumOfWeights);
+        if ((Iterations > 0)
+            && (fabs(previousRMS - RMS) <= Tolerance * previousRMS)) {
+            Converged = true;
+            return true;
+        }
+        if (RMS == 0.0) {
+            Converged = true;
+            return true;
+        }
+        if (Iterations == MaxIterations) {
+            return true;
+        }
+        if (!ComputeTransform(data, stride, transform)) {
+            CMN_LOG_RUN_WARNING << "nmrRegistrationICP: registration failed at iteration "
+                                << Iterations << std::endl;
+            return false;
+        }
+        previousRMS = RMS;
+        Iterations++;
+    }
+}
+
+
+void nmrRegistrationICP::FindCorrespondences(const vct3 * data, ptrdiff_t stride, const vctFrm3 & transform)
+{
+    const int size = static_cast<int>(Correspondences.size());
+    const size_t noCorrespondence = Tree.size();
+    const double maxDistanceSquared =
+        (MaxDistance < sqrt(cmnTypeTraits<double>::MaxPositiveValue())) ?
+        (MaxDistance * MaxDistance) : cmnTypeTraits<double>::MaxPositiveValue();
+    int i;
+    // queries are independent, the tree is only read
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (i = 0; i < size; i++) {
+        vct3 point;
+        transform.ApplyTo(*(data + i * stride), point);
+        size_t index;
+        double distanceSquared;
+        if (Tree.FindNearest(point, index, distanceSquared, maxDistanceSquared, Correspondences[i])) {
+            Correspondences[i] = index;
+            DistancesSquared[i] = distanceSquared;
+        } else {
+            Correspondences[i] = noCorrespondence;
+            DistancesSquared[i] = maxDistanceSquared;
+        }
+    }
+}
+
+
+size_t nmrRegistrationICP::ComputeWeights(void)
+{
+    const size_t size = Correspondences.size();
+    const size_t noCorrespondence = Tree.size();
+    size_t i;
+    Sorted.clear();
+    for (i = 0; i < size; i++) {
+        if (Correspondences[i] != noCorrespondence) {
+            Weights[i] = 1.0;
+            Sorted.push_back(DistancesSquared[i]);
+        } else {
+            Weights[i] = 0.0;
+        }
+    }
+    if (Sorted.empty()) {
+        return 0;
+    }
+
+    // trimming, keep the pairs with the smallest distances
+    if (TrimRatio < 1.0) {
+        size_t kept = static_cast<size_t>(ceil(TrimRatio * static_cast<double>(Sorted.size())));
+        if (kept < 1) {
+            kept = 1;
+        }
+        std::nth_element(Sorted.begin(), Sorted.begin() + (kept - 1), Sorted.end());
+        const double threshold = Sorted[kept - 1];
+        Sorted.clear();
+        for (i = 0; i < size; i++) {
+            if (Weights[i] > 0.0) {
+                if (DistancesSquared[i] > threshold) {
+                    Weights[i] = 0.0;
+                } else {
+                    Sorted.push_back(DistancesSquared[i]);
+                }
+            }
+        }
+    }
+
+    // robust weights of the remaining pairs
+    if (Weighting != WEIGHT_NONE) {
+        double scale = WeightingScale;
+        if (scale <= 0.0) {
+            // scale from the median absolute deviation of the distances
+            const size_t middle = Sorted.size() / 2;
+            std::nth_element(Sorted.begin(), Sorted.begin() + middle, Sorted.end());
+            const double sigma = 1.4826 * sqrt(Sorted[middle]);
+            scale = ((Weighting == WEIGHT_HUBER) ? 1.345 : 4.685) * sigma;
+        }
+        // all the pairs are exact, nothing to weight
+        if (scale > 0.0) {
+            const double scaleSquared = scale * scale;
+            for (i = 0; i < size; i++) {
+                if (Weights[i] > 0.0) {
+                    const double distanceSquared = DistancesSquared[i];
+                    if (Weighting == WEIGHT_HUBER) {
+                        if (distanceSquared > scaleSquared) {
+                            Weights[i] = scale / sqrt(distanceSquared);
+                        }
+                    } else {
+                        if (distanceSquared < scaleSquared) {
+                            const double ratio = 1.0 - distanceSquared / scaleSquared;
+                            Weights[i] = ratio * ratio;
+                        } else {
+                            Weights[i] = 0.0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    size_t inliers = 0;
+    for (i = 0; i < size; i++) {
+        if (Weights[i] > 0.0) {
+            inliers++;
+        }
+    }
+    return inliers;
+}
+
+
+bool nmrRegistrationICP::ComputeTransform(const vct3 * data, ptrdiff_t stride, vctFrm3 & transform) const
+{
+    const size_t size = Correspondences.size();
+    size_t i;
+    // weighted averages
+    double sumOfWeights = 0.0;
+    vct3 average1(0.0), average2(0.0);
+    for (i = 0; i < size; i++) {
+        const double weight = Weights[i];
+        if (weight > 0.0) {
+            sumOfWeights += weight;
+            average1.AddProductOf(weight, *(data + i * stride));
+            average2.AddProductOf(weight, Tree.Point(Correspondences[i]));
+        }
+    }
+    average1.Divide(sumOfWeights);
+    average2.Divide(sumOfWeights);
+
+    // weighted sum of the outer products, see nmrRegistrationRigid
+    vctDouble3x3 H(0.0);
+    for (i = 0; i < size; i++) {
+        const double weight = Weights[i];
+        if (weight > 0.0) {
+            const vct3 point1(*(data + i * stride) - average1);
+            const vct3 point2(Tree.Point(Correspondences[i]) - average2);
+            size_t row, column;
+            for (row = 0; row < 3; row++) {
+                const double scaled = weight * point1[row];
+                for (column = 0; column < 3; column++) {
+                    H.Element(row, column) += scaled * point2[column];
+                }
+            }
+        }
+    }
+    vctDouble3x3 U, Vt;
+    vctDouble3 S;
+    nmrSVDJacobi(H, U, S, Vt);
+    vctDouble3x3 X = (U * Vt).Transpose();
+    double det = vctDeterminant<3>::Compute(X);
+    // reflection, apply correction from Umeyama(1991)
+    if (fabs(det - 1.0) > 1e-6) {
+        vctDouble3x3 Fix(0.0);
+        Fix.Diagonal() = vct3(1.0, 1.0, -1.0);
+        X = (U * Fix * Vt).Transpose();
+        det = vctDeterminant<3>::Compute(X);
+        if (fabs(det - 1.0) > 1e-6) {
+            return false;
+        }
+    }
+    vctMatRot3 R;
+    R.Assign(X);
+    transform = vctFrm3(R, average2 - R * average1);
+    return true;
+}
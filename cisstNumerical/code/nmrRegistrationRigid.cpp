@@ -18,7 +18,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnLogger.h>
 #include <cisstVector/vctDeterminant.h>
-#include <cisstNumerical/nmrSVD.h>
+#include <cisstNumerical/nmrSVDJacobi.h>
 #include <cisstNumerical/nmrRegistrationRigid.h>
 
 template <class _vectorOwnerType>
@@ -50,10 +50,10 @@ bool nmrRegistrationRigid(vctDynamicConstVectorBase<_vectorOwnerType, vct3> &dat
         H.OuterProductOf(dataSet1[i]-avg1, dataSet2[i]-avg2);
         sumH.Add(H);
     }
-    // Now, compute SVD of sumH
+    // Now, compute SVD of sumH, Jacobi is faster than LAPACK for 3x3
     vctDouble3x3 U, Vt;
     vctDouble3 S;
-    nmrSVD(sumH, U, S, Vt);
+    nmrSVDJacobi(sumH, U, S, Vt);
     // Compute X = V*U' = (U*V')'
     vctDouble3x3 X = (U*Vt).Transpose();
     double det = vctDeterminant<3>::Compute(X);
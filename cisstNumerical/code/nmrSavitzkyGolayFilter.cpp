@@ -0,0 +1,187 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstNumerical/nmrSavitzkyGolayFilter.h>
+
+#include <math.h>
+
+
+nmrSavitzkyGolayFilter::nmrSavitzkyGolayFilter(void):
+    WindowSize(0),
+    Delay(0),
+    Position(0),
+    NumberOfSamples(0)
+{
+}
+
+
+void nmrSavitzkyGolayFilter::Configure(size_t polynomialOrder, size_t maxDerivative,
+                                       size_t left, size_t right,
+                                       size_t numberOfChannels, double period)
+{
+    if (maxDerivative > polynomialOrder) {
+        cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::Configure: derivative order greater than polynomial order"));
+    }
+    const size_t windowSize = left + right + 1;
+    if (windowSize < polynomialOrder + 1) {
+        cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::Configure: window too small for polynomial order"));
+    }
+    if (period <= 0.0) {
+        cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::Configure: period must be positive"));
+    }
+
+    // least squares fit of a polynomial of tau = t / scale, the
+    // scaling keeps the normal equations well conditioned
+    const size_t size = polynomialOrder + 1;
+    double scale = static_cast<double>((left > right) ? left : right);
+    if (scale == 0.0) {
+        scale = 1.0;
+    }
+    vctDynamicMatrix<double> basis(size, windowSize);
+    size_t row, column, sample;
+    for (sample = 0; sample < windowSize; sample++) {
+        const double tau = (static_cast<double>(sample) - static_cast<double>(left)) / scale;
+        double power = 1.0;
+        for (row = 0; row < size; row++) {
+            basis.Element(row, sample) = power;
+            power *= tau;
+        }
+    }
+
+    // solve (basis basis^T) X = basis with Gauss-Jordan elimination,
+    // row d of X gives the coefficient of tau^d for each sample
+    vctDynamicMatrix<double> system(size, size + windowSize);
+    for (row = 0; row < size; row++) {
+        for (column = 0; column < size; column++) {
+            system.Element(row, column) = vctDotProduct(basis.Row(row), basis.Row(column));
+        }
+        for (sample = 0; sample < windowSize; sample++) {
+            system.Element(row, size + sample) = basis.Element(row, sample);
+        }
+    }
+    for (column = 0; column < size; column++) {
+        size_t pivot = column;
+        for (row = column + 1; row < size; row++) {
+            if (fabs(system.Element(row, column)) > fabs(system.Element(pivot, column))) {
+                pivot = row;
+            }
+        }
+        if (pivot != column) {
+            system.ExchangeRows(pivot, column);
+        }
+        system.Row(column).Divide(system.Element(column, column));
+        for (row = 0; row < size; row++) {
+            if (row != column) {
+                system.Row(row).AddProductOf(-system.Element(row, column), system.Row(column));
+            }
+        }
+    }
+
+    // derivative of order d at tau = 0 is d! X[d], scaled to time units
+    Coefficients.SetSize(maxDerivative + 1, windowSize);
+    double factor = 1.0;
+    for (row = 0; row <= maxDerivative; row++) {
+        if (row > 0) {
+            factor *= static_cast<double>(row) / (scale * period);
+        }
+        for (sample = 0; sample < windowSize; sample++) {
+            Coefficients.Element(row, sample) = factor * system.Element(row, size + sample);
+        }
+    }
+    WindowSize = windowSize;
+    Delay = right;
+    Allocate(numberOfChannels);
+}
+
+
+void nmrSavitzkyGolayFilter::SetCoefficients(const vctDynamicMatrix<double> & coefficients,
+                                             size_t right, size_t numberOfChannels)
+{
+    if ((coefficients.rows() == 0) || (right >= coefficients.cols())) {
+        cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::SetCoefficients: invalid coefficients"));
+    }
+    Coefficients.SetSize(coefficients.rows(), coefficients.cols());
+    Coefficients.Assign(coefficients);
+    WindowSize = coefficients.cols();
+    Delay = right;
+    Allocate(numberOfChannels);
+}
+
+
+void nmrSavitzkyGolayFilter::Allocate(size_t numberOfChannels)
+{
+    History.SetSize(2 * WindowSize, numberOfChannels, VCT_ROW_MAJOR);
+    Outputs.SetSize(Coefficients.rows(), numberOfChannels, VCT_ROW_MAJOR);
+    Reset();
+}
+
+
+void nmrSavitzkyGolayFilter::Reset(void)
+{
+    History.SetAll(0.0);
+    Outputs.SetAll(0.0);
+    Position = 0;
+    NumberOfSamples = 0;
+}
+
+
+bool nmrSavitzkyGolayFilter::Update(const double * sample, ptrdiff_t stride)
+{
+    if (WindowSize == 0) {
+        return false;
+    }
+    const size_t numberOfChannels = History.cols();
+    size_t channel;
+    double * first = History.Pointer(Position, 0);
+    double * second = History.Pointer(Position + WindowSize, 0);
+    for (channel = 0; channel < numberOfChannels; channel++) {
+        first[channel] = second[channel] = sample[channel * stride];
+    }
+    Position = (Position + 1) % WindowSize;
+    if (NumberOfSamples < WindowSize) {
+        NumberOfSamples++;
+        if (NumberOfSamples < WindowSize) {
+            return false;
+        }
+    }
+
+    // the window, oldest sample first, is in rows Position to
+    // Position + WindowSize - 1
+    const size_t windowSize = WindowSize;
+    const double * window = History.Pointer(Position, 0);
+    const size_t numberOfOutputs = Coefficients.rows();
+    const ptrdiff_t coefficientStride = Coefficients.col_stride();
+    size_t output, index;
+    for (output = 0; output < numberOfOutputs; output++) {
+        double * result = Outputs.Pointer(output, 0);
+        const double * coefficients = Coefficients.Pointer(output, 0);
+        for (channel = 0; channel < numberOfChannels; channel++) {
+            result[channel] = 0.0;
+        }
+        for (index = 0; index < windowSize; index++) {
+            const double coefficient = coefficients[index * coefficientStride];
+            const double * values = window + index * numberOfChannels;
+            for (channel = 0; channel < numberOfChannels; channel++) {
+                result[channel] += coefficient * values[channel];
+            }
+        }
+    }
+    return true;
+}
@@ -21,7 +21,11 @@
 
 #include <cisstVector/vctDynamicVectorTypes.h>
 #include <cisstVector/vctDynamicMatrixTypes.h>
+#include <cisstNumerical/nmrConfig.h>
+#if CISST_HAS_CISSTNETLIB
 #include <cisstNumerical/nmrLSqLin.h>
+#endif
+#include <cisstNumerical/nmrLSqLinIncremental.h>
 
 // Always include last!
 #include <cisstNumerical/nmrExport.h>
@@ -29,6 +33,20 @@
 //! This is a container for constrained control optimizer.
 //! It provides high level functions to add common functionality.
 //! Solves the LSI problem  arg min || C x - d ||, s.t. E x = f and A x >= b.
+//! By default, Solve uses nmrLSqLin.  For control loops, AllocateRealTime
+//! switches to a preallocated nmrLSqLinIncremental: the problem is copied
+//! in matrices of fixed maximum sizes, unused rows are padded with
+//! constraints always satisfied, only the objective rows that changed
+//! since the previous cycle update the factorization, the active set of
+//! the previous cycle is used as a warm start and the number of
+//! iterations is capped.  When the cap is reached, Solve returns
+//! NMR_MAX_ITERATIONS and whichever of the previous solution and the
+//! last iterate violates the constraints less, which may still violate
+//! some constraints (see GetConstraintViolation).  C must have full
+//! column rank, SetDamping adds a small damping of all the variables
+//! otherwise.  Without cisstNetlib, Solve always uses the preallocated
+//! solver and allocates it on the first call if AllocateRealTime wasn't
+//! called.
 /*! \brief nmrConstraintOptimizer: A class that makes using the constraint control algorithm more efficient
  */
 class CISST_EXPORT nmrConstraintOptimizer
@@ -49,8 +67,10 @@ private:
     //!Equality Vector
     vctDoubleVec f;
 
+#if CISST_HAS_CISSTNETLIB
     //!holds the solution
     nmrLSqLinSolutionDynamic lsiSolution;
+#endif
 
     //!number of variables for incremental joint optimization (can be inferred from objective function).
     size_t NumVars;
@@ -66,6 +86,20 @@ private:
     //!Slack Index
     size_t SlackIndex;
 
+    //!Preallocated solver used if RealTime is set
+    nmrLSqLinIncremental RealTimeSolver;
+    bool RealTime;
+    //!Maximum sizes and copies of the problem padded to these sizes,
+    //!the objective has one more damping row per variable
+    size_t MaxCRows, MaxARows, MaxERows, MaxIterations;
+    double Damping;
+    //!Number of objective rows used by the previous cycle and false if
+    //!the factorization of the objective must be computed from scratch
+    size_t RealTimeCRows;
+    bool RealTimeObjectiveSet;
+    vctDoubleMat RealTimeC, RealTimeA, RealTimeE;
+    vctDoubleVec RealTimed, RealTimeb, RealTimef;
+
 public:
 
     //! enum used for solver results.
@@ -74,11 +108,21 @@ public:
     //! 2  Inequality constraints are contradictory.
     //! 3  Both equality and inequality constraints are contradictory.
     //! 4  Input has a NaN or INF
-    enum STATUS {NMR_OK, NMR_EQ_CONTRADICTION, NMR_INEQ_CONTRADICTION, NMR_BOTH_CONTRADICTION, NMR_MALFORMED, NMR_EMPTY};
+    //! 5  There is no objective
+    //! 6  The objective doesn't have full column rank (real-time solver only)
+    //! 7  The maximum number of iterations has been reached (real-time solver only)
+    enum STATUS {NMR_OK, NMR_EQ_CONTRADICTION, NMR_INEQ_CONTRADICTION, NMR_BOTH_CONTRADICTION, NMR_MALFORMED, NMR_EMPTY,
+                 NMR_RANK_DEFICIENT, NMR_MAX_ITERATIONS};
 
     /*! Constructor
      */
-    nmrConstraintOptimizer() {}
+    nmrConstraintOptimizer():
+        NumVars(0), Slacks(0),
+        RealTime(false), MaxCRows(0), MaxARows(0), MaxERows(0), MaxIterations(0), Damping(0.0),
+        RealTimeCRows(0), RealTimeObjectiveSet(false)
+    {
+        ResetIndices();
+    }
 
     /*! Destructor
      */
@@ -120,6 +164,51 @@ public:
     */
     void ReserveSpace(const size_t CRows, const size_t ARows, const size_t ERows, const size_t num_slacks);
 
+    //! Use a preallocated solver for the following calls to Solve.
+    /*! AllocateRealTime
+      \param maxCRows Maximum number of rows of the objective
+      \param maxARows Maximum number of rows of the inequality constraint, including slack limits
+      \param maxERows Maximum number of rows of the equality constraint
+      \param maxIterations Maximum number of constraints added to the active set by Solve, 0 for the default of nmrLSqLinIncremental
+
+      The number of variables is the current number of variables and
+      slacks, i.e. call after ReserveSpace.  Solve doesn't allocate
+      memory as long as the problem doesn't exceed these sizes.  The
+      solution of Solve contains the slacks after the variables.
+    */
+    void AllocateRealTime(const size_t maxCRows, const size_t maxARows, const size_t maxERows,
+                          const size_t maxIterations = 0);
+
+    //! Use nmrLSqLin for the following calls to Solve.  Without
+    //! cisstNetlib, the next call to Solve allocates the preallocated
+    //! solver again.
+    /*! DisableRealTime
+     */
+    void DisableRealTime(void);
+
+    //! True if Solve uses the preallocated solver.
+    /*! IsRealTime
+     */
+    bool IsRealTime(void) const;
+
+    //! Damping of the variables for the preallocated solver.
+    /*! SetDamping
+      \param damping Weight of the objective rows damping x, 0 by default
+    */
+    void SetDamping(const double damping);
+
+    //! Number of iterations of the last call to Solve (preallocated solver only).
+    /*! GetNumberOfIterations
+      \return size_t Number of constraints added to the active set
+    */
+    size_t GetNumberOfIterations(void) const;
+
+    //! Largest constraint violation of the last solution (preallocated solver only).
+    /*! GetConstraintViolation
+      \return double Violation, zero if all the constraints are satisfied
+    */
+    double GetConstraintViolation(void) const;
+
     //! Returns references to spaces in the tableau.
     /*! GetObjectiveSpace
       \param CRows Number of rows needed for the objective data
@@ -238,6 +327,13 @@ public:
     */
     const std::string GetStatusString(STATUS status) const;
 
+private:
+    //! Solve using the preallocated solver
+    /*! SolveRealTime
+      \param dq Vector of current joint values
+      \return STATUS enum that dictates whether the solver worked or there was a problem
+    */
+    STATUS SolveRealTime(vctDoubleVec & dq);
 };
 
 #endif // _nmrConstraintOptimizer_h
@@ -0,0 +1,125 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrKdTree
+*/
+
+
+#ifndef _nmrKdTree_h
+#define _nmrKdTree_h
+
+#include <vector>
+
+#include <cisstVector/vctTypes.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  kd-tree for nearest neighbor queries in a set of 3D points, e.g. the
+  model point cloud of an ICP registration.  The tree is built once
+  (Build) and can then be queried from multiple threads since the
+  queries don't modify the tree.
+
+  The points are reordered so that the points of a leaf are
+  contiguous in memory, each leaf contains at most LEAF_SIZE points.
+  The queries return the index of the point in the array used to build
+  the tree.
+
+  When the queries are repeated for slowly moving points (e.g. ICP
+  iterations or consecutive frames), the previous result can be passed
+  as a hint.  The distance to the hint is used as the initial search
+  radius, which prunes most of the tree.
+
+  \code
+  nmrKdTree tree;
+  tree.Build(modelPoints);
+  size_t index;
+  double distanceSquared;
+  if (tree.FindNearest(point, index, distanceSquared)) {
+      // modelPoints[index] is the closest point
+  }
+  \endcode
+*/
+class CISST_EXPORT nmrKdTree
+{
+public:
+    enum {LEAF_SIZE = 8};
+
+    nmrKdTree(void);
+
+    /*! Build the tree for a set of points.  The points are copied. */
+    template <class _vectorOwnerType>
+    void Build(const vctDynamicConstVectorBase<_vectorOwnerType, vct3> & points) {
+        BuildTree(points.Pointer(), points.size(), points.stride());
+    }
+
+    /*! Number of points in the tree. */
+    inline size_t size(void) const {
+        return Points.size();
+    }
+
+    /*! Point used to build the tree. */
+    inline const vct3 & Point(size_t index) const {
+        return Points[index];
+    }
+
+    /*! Find the point the closest to query.
+      \param query Query point
+      \param index (output) Index of the closest point
+      \param distanceSquared (output) Square of the distance to the closest point
+      \param maxDistanceSquared Only points closer than this are considered
+      \param hint Index of a point close to query, e.g. result of the previous query
+      (ignored if greater or equal to size())
+      \returns false if no point is closer than maxDistanceSquared, index
+      and distanceSquared are not modified in this case.
+    */
+    bool FindNearest(const vct3 & query, size_t & index, double & distanceSquared,
+                     double maxDistanceSquared = cmnTypeTraits<double>::MaxPositiveValue(),
+                     size_t hint = static_cast<size_t>(-1)) const;
+
+protected:
+    /*! Node of the tree.  For inner nodes, the children are Child and
+      Child + 1.  For leaves, Axis is LEAF and the points are in
+      [Begin, End). */
+    struct Node {
+        enum {LEAF = 3};
+        double Split;
+        unsigned int Axis;
+        size_t Child;
+        size_t Begin, End;
+    };
+
+    void BuildTree(const vct3 * points, size_t size, ptrdiff_t stride);
+    void BuildNode(size_t node, size_t begin, size_t end);
+
+    //! Points in the original order
+    vctDynamicVector<vct3> Points;
+    //! Coordinates of the reordered points and original indices
+    std::vector<double> X, Y, Z;
+    std::vector<size_t> Index;
+    std::vector<Node> Nodes;
+};
+
+#endif // _nmrKdTree_h
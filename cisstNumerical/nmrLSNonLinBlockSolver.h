@@ -0,0 +1,250 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrLSNonLinBlockSolver
+*/
+
+
+#ifndef _nmrLSNonLinBlockSolver_h
+#define _nmrLSNonLinBlockSolver_h
+
+#include <vector>
+
+#include <cisstCommon/cmnThrow.h>
+#include <cisstVector/vctDynamicMatrix.h>
+#include <cisstVector/vctDynamicVector.h>
+#include <cisstVector/vctDynamicMatrixRef.h>
+#include <cisstVector/vctDynamicVectorRef.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  Levenberg-Marquardt solver for large nonlinear least squares
+  problems
+
+     arg min 1/2 sum_i || r_i(x) ||^2
+
+  where the residuals are provided by blocks, typically one block per
+  observation (e.g. one measured pose for a robot calibration).  Each
+  block has a fixed number of residuals and depends on a subset of the
+  parameters, its Jacobian only contains the columns of these
+  parameters.  Unlike nmrLSNonLinJacobianSolver, the complete (number
+  of residuals by number of parameters) Jacobian is never formed: the
+  normal equations J^T J and J^T r are accumulated block by block, so
+  the memory and the cost of a factorization only depend on the number
+  of parameters.  This is appropriate for problems with many
+  observations and up to a few hundred parameters.
+
+  The blocks are evaluated in parallel if cisst is configured with
+  CISST_NMR_HAS_OPENMP.  The blocks are split in one range per thread, each thread accumulates
+  its own normal equations which are then added.  The method
+  Problem::EvaluateBlock is therefore called concurrently and must be
+  thread safe, i.e. it should not modify the problem.
+
+  The damped normal equations (J^T J + lambda diag(J^T J)) dx = - J^T r
+  are solved with a Cholesky factorization and the damping lambda is
+  updated with the gain ratio of the step (Nielsen's strategy).
+
+  \code
+  class CalibrationProblem: public nmrLSNonLinBlockSolver::Problem {
+      bool EvaluateBlock(size_t block, const vctDynamicVector<double> & parameters,
+                         vctDynamicVectorRef<double> & residual,
+                         vctDynamicMatrixRef<double> & jacobian) const {
+          // residual and jacobian for the measurement "block"
+          ...
+          return true;
+      }
+  };
+
+  nmrLSNonLinBlockSolver solver(numberOfParameters);
+  for (pose = 0; pose < numberOfPoses; pose++) {
+      solver.AddBlock(3); // 3 residuals, depends on all parameters
+  }
+  solver.Solve(problem, parameters);
+  \endcode
+*/
+class CISST_EXPORT nmrLSNonLinBlockSolver
+{
+public:
+    /*! Reason why the solver stopped */
+    typedef enum {NOT_SOLVED,
+                  CONVERGED_GRADIENT,
+                  CONVERGED_STEP,
+                  CONVERGED_FUNCTION,
+                  MAX_ITERATIONS,
+                  FAILED} TerminationType;
+
+    /*! Interface for the residuals, to be derived by the user */
+    class CISST_EXPORT Problem {
+    public:
+        virtual ~Problem() {}
+
+        /*! Compute the residuals of a block and their derivatives.
+          \param block Index of the block, as returned by AddBlock
+          \param parameters All the parameters
+          \param residual The residuals of the block, size set by AddBlock
+          \param jacobian One row per residual, one column per parameter of the block, in the order used for AddBlock
+          \return false if the residuals can't be computed for these parameters
+
+          Called from multiple threads if CISST_NMR_HAS_OPENMP is
+          set, must not modify the problem. */
+        virtual bool EvaluateBlock(size_t block, const vctDynamicVector<double> & parameters,
+                                   vctDynamicVectorRef<double> & residual,
+                                   vctDynamicMatrixRef<double> & jacobian) const = 0;
+    };
+
+    nmrLSNonLinBlockSolver(size_t numberOfParameters = 0);
+
+    /*! Set the number of parameters, removes all the blocks */
+    void SetNumberOfParameters(size_t numberOfParameters);
+
+    inline size_t GetNumberOfParameters(void) const {
+        return NumberOfParameters;
+    }
+
+    /*! Add a block of residuals depending on all the parameters,
+      returns the index of the block. */
+    size_t AddBlock(size_t numberOfResiduals);
+
+    /*! Add a block of residuals depending on some parameters, the
+      columns of the Jacobian of the block correspond to the parameter
+      indices, in the same order.  Throws an exception if an index is
+      invalid or repeated. */
+    size_t AddBlock(size_t numberOfResiduals, const std::vector<size_t> & parameterIndices);
+
+    /*! Remove all the blocks */
+    void ClearBlocks(void);
+
+    inline size_t GetNumberOfBlocks(void) const {
+        return BlockResiduals.size();
+    }
+
+    /*! Total number of residuals */
+    inline size_t GetNumberOfResiduals(void) const {
+        return NumberOfResiduals;
+    }
+
+    inline void SetMaxIterations(size_t maxIterations) {
+        MaxIterations = maxIterations;
+    }
+
+    /*! Stopping criteria: relative decrease of the cost, relative
+      size of the step and largest element of the gradient */
+    void SetTolerances(double function, double step, double gradient);
+
+    /*! Initial damping, relative to the diagonal of J^T J */
+    inline void SetInitialDamping(double damping) {
+        InitialDamping = damping;
+    }
+
+    /*! Minimize the sum of squares starting from the initial value of
+      parameters.  Returns true if one of the convergence criteria
+      is met or if the maximum number of iterations is reached.
+      Throws an exception if the size of parameters is not the
+      number of parameters. */
+    bool Solve(const Problem & problem, vctDynamicVector<double> & parameters);
+
+    inline TerminationType GetTermination(void) const {
+        return Termination;
+    }
+
+    inline size_t GetNumberOfIterations(void) const {
+        return Iterations;
+    }
+
+    /*! Cost 1/2 sum || r_i ||^2 for the initial parameters */
+    inline double GetInitialCost(void) const {
+        return InitialCost;
+    }
+
+    /*! Cost 1/2 sum || r_i ||^2 for the solution */
+    inline double GetCost(void) const {
+        return Cost;
+    }
+
+    /*! J^T J at the solution, only the upper triangle is set.  Its
+      inverse can be used to estimate the covariance of the
+      parameters. */
+    inline const vctDynamicMatrix<double> & GetNormalMatrix(void) const {
+        return Normal;
+    }
+
+protected:
+    /*! Evaluate all the blocks and accumulate the cost, J^T J and
+      J^T r.  Returns false if a block can't be evaluated. */
+    bool Accumulate(const Problem & problem, const vctDynamicVector<double> & parameters,
+                    double & cost, vctDynamicMatrix<double> & normal,
+                    vctDynamicVector<double> & gradient);
+
+    /*! Accumulate the blocks [begin, end) in the workspace of a range */
+    bool AccumulateRange(const Problem & problem, const vctDynamicVector<double> & parameters,
+                         size_t range, size_t begin, size_t end);
+
+    /*! Solve (normal + damping diag(normal)) step = -gradient, returns
+      false if the damped matrix is not positive definite */
+    bool SolveDamped(double damping);
+
+    size_t NumberOfParameters;
+    size_t NumberOfResiduals;
+
+    //! For each block, number of residuals and position of the
+    //! parameter indices, no index if the block uses all parameters
+    std::vector<size_t> BlockResiduals;
+    std::vector<size_t> BlockIndicesBegin;
+    std::vector<size_t> BlockIndicesEnd;
+    std::vector<size_t> ParameterIndices;
+    size_t MaxBlockResiduals;
+    size_t MaxBlockParameters;
+
+    size_t MaxIterations;
+    double FunctionTolerance;
+    double StepTolerance;
+    double GradientTolerance;
+    double InitialDamping;
+
+    TerminationType Termination;
+    size_t Iterations;
+    double InitialCost;
+    double Cost;
+
+    //! Normal equations at the current and trial parameters
+    vctDynamicMatrix<double> Normal, TrialNormal;
+    vctDynamicVector<double> Gradient, TrialGradient;
+    vctDynamicVector<double> TrialParameters;
+    vctDynamicMatrix<double> Factor;
+    vctDynamicVector<double> Scaling;
+    vctDynamicVector<double> Step;
+
+    //! Workspace for each range of blocks
+    std::vector<vctDynamicMatrix<double> > RangeNormals;
+    std::vector<vctDynamicVector<double> > RangeGradients;
+    std::vector<double> RangeCosts;
+    std::vector<int> RangeValid;
+    std::vector<vctDynamicVector<double> > RangeResiduals;
+    std::vector<vctDynamicMatrix<double> > RangeJacobians;
+};
+
+#endif // _nmrLSNonLinBlockSolver_h
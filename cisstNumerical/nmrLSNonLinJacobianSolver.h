@@ -120,6 +120,9 @@ http://www.cisst.org/cisst/license.txt.
   \note This code relies on the ERC CISST cnetlib library.  Since
   cnetlib is optional, make sure that CISST_HAS_CNETLIB has been
   turned ON during the configuration with CMake.
+
+  \note For problems with many observations, see
+  nmrLSNonLinBlockSolver which doesn't form the complete Jacobian.
 */
 class nmrLSNonLinJacobianSolver {
 	// we have this class so that we reserve memory only one
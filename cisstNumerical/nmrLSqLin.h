@@ -102,6 +102,9 @@ http://www.cisst.org/cisst/license.txt.
      \note The general rule for numerical functions which depend on LAPACK is that
      column-major matrices should be used everywhere, and that all
      matrices should be compact.
+     \note To solve the same problem repeatedly, e.g. once per control cycle,
+     when only a few rows change, see nmrLSqLinIncremental which updates
+     the factorization and starts from the previous active set.
  */
 
 /*
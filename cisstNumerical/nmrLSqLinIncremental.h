@@ -0,0 +1,317 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s): agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrLSqLinIncremental
+*/
+
+
+#ifndef _nmrLSqLinIncremental_h
+#define _nmrLSqLinIncremental_h
+
+#include <cisstCommon/cmnThrow.h>
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  Incremental and warm-started solver for the LSEI problem
+
+     arg min || A x - b ||, s.t. E x = f and G x >= h
+
+  for problems that are solved repeatedly with the same structure,
+  e.g. once per control cycle, where only a few rows change between
+  two solutions.  Unlike nmrLSqLin, which factorizes the complete
+  problem each time, this solver keeps:
+
+  - The upper triangular factor R of the QR decomposition of A (and
+    Q^T b).  Replacing a row of A with SetObjectiveRow is a rank-one
+    update followed by a rank-one downdate of R, i.e. O(N^2) instead
+    of O(Ma N^2).  If the downdate fails (A close to rank deficient),
+    R is computed again from the stored rows.  The updates accumulate
+    round-off errors; Refactorize can be called once in a while to
+    compute R from scratch.
+
+  - The active set of inequality constraints of the previous solution.
+    Solve starts from the previous active set (warm start) and uses the
+    dual active set method of Goldfarb and Idnani, so only the
+    constraints that changed status require an iteration.
+
+  - The last solution that satisfied all the constraints.  If Solve
+    reaches the maximum number of iterations, X is whichever of the
+    last iterate and this previous solution has the smaller constraint
+    violation.  Neither is guaranteed to satisfy the current
+    constraints, see GetConstraintViolation.  The active set
+    found so far is kept so the next call continues from it.  The
+    maximum number of iterations bounds the computation time, e.g. in
+    a control loop.
+
+  All the memory is allocated by the constructor or Allocate, none of
+  the other methods allocate memory.  A must have full column rank (add
+  damping rows otherwise).  The solver doesn't require cisstNetlib.
+
+  \code
+  nmrLSqLinIncremental solver(ma, me, mg, n);
+  solver.SetObjective(A, b);
+  solver.SetEqualityConstraints(E, f);
+  solver.SetInequalityConstraints(G, h);
+  solver.Solve();
+  // next cycle, only one row of the objective and one constraint changed
+  solver.SetObjectiveRow(2, A.Row(2), b[2]);
+  solver.SetInequalityConstraintRow(0, G.Row(0), h[0]);
+  solver.Solve();
+  x = solver.GetX();
+  \endcode
+*/
+class CISST_EXPORT nmrLSqLinIncremental
+{
+public:
+
+    //! enum used for solver results.
+    //! NMR_OK  All the constraints are satisfied.
+    //! NMR_EQ_CONTRADICTION  Equality constraints are linearly dependent and contradictory.
+    //! NMR_INEQ_CONTRADICTION  Inequality constraints are contradictory.
+    //! NMR_RANK_DEFICIENT  The objective matrix A doesn't have full column rank.
+    //! NMR_MAX_ITERATIONS  The maximum number of iterations has been reached.
+    enum STATUS {NMR_OK, NMR_EQ_CONTRADICTION, NMR_INEQ_CONTRADICTION, NMR_RANK_DEFICIENT, NMR_MAX_ITERATIONS};
+
+    /*! Default constructor, Allocate must be called before use. */
+    nmrLSqLinIncremental(void);
+
+    /*! Constructor with allocation, see Allocate. */
+    nmrLSqLinIncremental(size_t ma, size_t me, size_t mg, size_t n);
+
+    /*! Allocate all the memory used by the solver.  The objective and
+      the constraints are set to zero and the active set is empty.
+      \param ma, me, mg Number of rows of A, E and G
+      \param n Number of variables
+    */
+    void Allocate(size_t ma, size_t me, size_t mg, size_t n);
+
+    /*! Set the objective and compute the factorization of A. */
+    template <class _matrixOwnerType, class _vectorOwnerType>
+    void SetObjective(const vctDynamicConstMatrixBase<_matrixOwnerType, double> & inA,
+                      const vctDynamicConstVectorBase<_vectorOwnerType, double> & inb)
+        throw (std::runtime_error)
+    {
+        if ((inA.rows() != Ma) || (inA.cols() != N) || (inb.size() != Ma)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetObjective: Size used for Allocate was different"));
+        }
+        A.Assign(inA);
+        b.Assign(inb);
+        Refactorize();
+    }
+
+    /*! Replace one row of the objective and update the factorization
+      of A.  No computation is done if the row didn't change. */
+    template <class _vectorOwnerType>
+    void SetObjectiveRow(size_t index,
+                         const vctDynamicConstVectorBase<_vectorOwnerType, double> & row,
+                         double value)
+        throw (std::runtime_error)
+    {
+        if ((index >= Ma) || (row.size() != N)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetObjectiveRow: Invalid index or row size"));
+        }
+        Row.Assign(row);
+        UpdateObjectiveRow(index, value);
+    }
+
+    /*! Set the equality constraints E x = f. */
+    template <class _matrixOwnerType, class _vectorOwnerType>
+    void SetEqualityConstraints(const vctDynamicConstMatrixBase<_matrixOwnerType, double> & inE,
+                                const vctDynamicConstVectorBase<_vectorOwnerType, double> & inf)
+        throw (std::runtime_error)
+    {
+        if ((inE.rows() != Me) || (inE.cols() != N) || (inf.size() != Me)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetEqualityConstraints: Size used for Allocate was different"));
+        }
+        E.Assign(inE);
+        f.Assign(inf);
+    }
+
+    /*! Replace one equality constraint. */
+    template <class _vectorOwnerType>
+    void SetEqualityConstraintRow(size_t index,
+                                  const vctDynamicConstVectorBase<_vectorOwnerType, double> & row,
+                                  double value)
+        throw (std::runtime_error)
+    {
+        if ((index >= Me) || (row.size() != N)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetEqualityConstraintRow: Invalid index or row size"));
+        }
+        E.Row(index).Assign(row);
+        f[index] = value;
+    }
+
+    /*! Set the inequality constraints G x >= h.  The active set of the
+      previous solution is kept. */
+    template <class _matrixOwnerType, class _vectorOwnerType>
+    void SetInequalityConstraints(const vctDynamicConstMatrixBase<_matrixOwnerType, double> & inG,
+                                  const vctDynamicConstVectorBase<_vectorOwnerType, double> & inh)
+        throw (std::runtime_error)
+    {
+        if ((inG.rows() != Mg) || (inG.cols() != N) || (inh.size() != Mg)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetInequalityConstraints: Size used for Allocate was different"));
+        }
+        G.Assign(inG);
+        h.Assign(inh);
+    }
+
+    /*! Replace one inequality constraint. */
+    template <class _vectorOwnerType>
+    void SetInequalityConstraintRow(size_t index,
+                                    const vctDynamicConstVectorBase<_vectorOwnerType, double> & row,
+                                    double value)
+        throw (std::runtime_error)
+    {
+        if ((index >= Mg) || (row.size() != N)) {
+            cmnThrow(std::runtime_error("nmrLSqLinIncremental SetInequalityConstraintRow: Invalid index or row size"));
+        }
+        G.Row(index).Assign(row);
+        h[index] = value;
+    }
+
+    /*! Compute the factorization of A from scratch, using the rows
+      stored by SetObjective and SetObjectiveRow. */
+    void Refactorize(void);
+
+    /*! Clear the active set, the next call to Solve is a cold start. */
+    void ResetActiveSet(void);
+
+    /*! Solve the problem, starting from the active set of the previous
+      solution.  When the status is NMR_EQ_CONTRADICTION, the solution
+      satisfies the linearly independent equality constraints only.
+      When the status is NMR_MAX_ITERATIONS, the solution is whichever
+      of the last solution that satisfied all the constraints and the
+      last iterate has the smaller constraint violation.  It may not be
+      feasible, see GetConstraintViolation.
+    */
+    STATUS Solve(void);
+
+    /*! Solution of the last call to Solve. */
+    inline const vctDoubleVec & GetX(void) const {
+        return X;
+    }
+
+    /*! True if the inequality constraint is in the active set of the
+      last solution. */
+    inline bool IsActive(size_t index) const {
+        return Active[index];
+    }
+
+    /*! Largest violation of the equality and inequality constraints by
+      the solution of the last call to Solve. */
+    inline double GetConstraintViolation(void) const {
+        return Violation;
+    }
+
+    /*! Number of inequality constraints in the active set of the last
+      solution. */
+    size_t GetNumberOfActiveConstraints(void) const;
+
+    /*! Number of constraints added to the active set by the last call
+      to Solve. */
+    inline size_t GetNumberOfIterations(void) const {
+        return Iterations;
+    }
+
+    /*! Tolerance used to decide if a constraint is violated and if a
+      constraint or A are rank deficient (default is
+      cmnTypeTraits<double>::Tolerance()). */
+    inline void SetTolerance(double tolerance) {
+        Tolerance = tolerance;
+    }
+
+    /*! Maximum number of constraints added to the active set by Solve
+      (default is 3 (Me + Mg) + 10). */
+    inline void SetMaxIterations(size_t maxIterations) {
+        MaxIterations = maxIterations;
+    }
+
+    //! Helper function for converting status enum to a string message.
+    static const char * GetStatusString(STATUS status);
+
+protected:
+    size_t Ma, Me, Mg, N;
+
+    //! Problem, row major
+    vctDoubleMat A, E, G;
+    vctDoubleVec b, f, h;
+
+    //! Upper triangular factor of A and first N elements of Q^T b
+    vctDoubleMat R;
+    vctDoubleVec d;
+
+    vctDoubleVec X;
+    vctDynamicVector<bool> Active;
+    double Violation;
+
+    //! Last solution satisfying all the constraints
+    vctDoubleVec Previous;
+    bool PreviousValid;
+
+    //! Working set: constraint indices (E first, then G), rows of
+    //! R^-T C^T, Cholesky factor of their product and multipliers
+    size_t NumberOfWorking;
+    vctDynamicVector<size_t> Working;
+    vctDoubleMat Y;
+    vctDoubleMat L;
+    vctDoubleVec Lambda;
+
+    //! Workspace
+    vctDoubleVec Row, Work, U, V, Z, Step;
+
+    double Tolerance;
+    size_t MaxIterations;
+    size_t Iterations;
+
+    //! Active set method, Solve adds the fallback for the iteration cap
+    STATUS SolveActiveSet(void);
+    //! Largest violation of the constraints by x
+    double ConstraintViolation(const double * x) const;
+
+    void UpdateObjectiveRow(size_t index, double value);
+    //! Rank-one update of R and d with the row a, value
+    void Update(const double * a, double value);
+    //! Rank-one downdate of R and d, returns false if R becomes singular
+    bool Downdate(const double * a, double value);
+
+    //! Row of E or G and right hand side of a constraint
+    const double * Constraint(size_t index, double & value) const;
+    //! Add a constraint to the working set if it is linearly independent
+    bool AddToWorkingSet(size_t index);
+    void RemoveFromWorkingSet(size_t position);
+    //! Solution and multipliers for the working set as equalities
+    void SolveWorkingSet(void);
+    //! U = R^-T c
+    void SolveRT(const double * c, double * u) const;
+    //! x = R^-1 w
+    void SolveR(const double * w, double * x) const;
+    //! Solve L L^T v = v (k first elements)
+    void SolveLLT(double * v) const;
+};
+
+#endif // _nmrLSqLinIncremental_h
@@ -0,0 +1,174 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrPolynomialHornerEvaluator
+*/
+
+
+#ifndef _nmrPolynomialHornerEvaluator_h
+#define _nmrPolynomialHornerEvaluator_h
+
+#include <vector>
+
+#include <cisstCommon/cmnThrow.h>
+#include <cisstVector/vctDynamicMatrix.h>
+#include <cisstVector/vctDynamicVector.h>
+#include <cisstNumerical/nmrDynAllocPolynomialContainer.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  Compiled form of a polynomial (nmrStandardPolynomial or
+  nmrBernsteinPolynomial) for fast evaluation at many points.
+
+  The polynomial containers evaluate each term separately from the
+  power table of a nmrMultiVariablePowerBasis, which has to be updated
+  for each point.  Compile() converts the terms of a polynomial to a
+  nested Horner scheme:
+  \f$p(x_0, x_1, ...) = q_0(x_1, ...) + x_0 (q_1(x_1, ...) + x_0 (...))\f$
+  where each \f$q_k\f$ is in turn expanded along the next variable.
+  For Bernstein polynomials, the multinomial factors are folded in the
+  coefficients.  The evaluation requires one multiplication and one
+  addition per term.
+
+  The points are evaluated by blocks of BLOCK_SIZE points, the
+  operations of the Horner scheme being applied to all the points of
+  a block at once so the compiler can vectorize them.  The workspace
+  is allocated by Compile(), the evaluation doesn't allocate memory.
+  Since the workspace is shared, an evaluator should not be used by
+  multiple threads at the same time.
+
+  The evaluator is a copy of the polynomial at the time of the
+  compilation, it has to be compiled again if the polynomial is
+  modified.  Note that the values of all the variables are provided
+  by the caller, including the implicit variable of a Bernstein
+  polynomial (the variables must sum to one).
+
+  \code
+  nmrStandardPolynomial polynomial(2, 0, 3);
+  ...
+  nmrPolynomialHornerEvaluator evaluator(polynomial);
+  vctDynamicMatrix<double> points(2, 1000); // one column per point
+  vctDynamicVector<double> values(1000);
+  evaluator.Evaluate(points, values);
+  \endcode
+*/
+class CISST_EXPORT nmrPolynomialHornerEvaluator
+{
+public:
+    enum {BLOCK_SIZE = 64};
+
+    typedef nmrPolynomialBase::VariableIndexType VariableIndexType;
+    typedef nmrPolynomialBase::PowerType PowerType;
+    typedef nmrPolynomialBase::ValueType ValueType;
+
+    /*! Default constructor, evaluates to zero */
+    nmrPolynomialHornerEvaluator(void);
+
+    /*! Constructor, calls Compile */
+    nmrPolynomialHornerEvaluator(const nmrDynAllocPolynomialContainer & polynomial);
+
+    /*! Compile the terms of a polynomial */
+    void Compile(const nmrDynAllocPolynomialContainer & polynomial);
+
+    inline VariableIndexType GetNumVariables(void) const {
+        return NumVariables;
+    }
+
+    /*! Evaluate the polynomial at one point.  The array variables
+      must contain GetNumVariables() values. */
+    ValueType Evaluate(const ValueType variables[]);
+
+    /*! Evaluate the polynomial at many points.
+      \param points One row per variable, one column per point
+      \param values The values for each point, size must be the number of columns of points
+    */
+    template <class _matrixOwnerType, class _vectorOwnerType>
+    void Evaluate(const vctDynamicConstMatrixBase<_matrixOwnerType, ValueType> & points,
+                  vctDynamicVectorBase<_vectorOwnerType, ValueType> & values) {
+        if (points.rows() != static_cast<size_t>(NumVariables)) {
+            cmnThrow(std::runtime_error("nmrPolynomialHornerEvaluator: number of rows doesn't match number of variables"));
+        }
+        if (points.cols() != values.size()) {
+            cmnThrow(std::runtime_error("nmrPolynomialHornerEvaluator: number of points doesn't match size of output"));
+        }
+        EvaluatePoints(points.Pointer(), points.row_stride(), points.col_stride(), points.cols(),
+                       values.Pointer(), values.stride());
+    }
+
+protected:
+    /*! Operations of the Horner scheme, applied to a stack of blocks */
+    typedef enum {PUSH_CONSTANT, MULTIPLY_POWER, MULTIPLY_POWER_ADD_CONSTANT, ADD} OperationCode;
+
+    struct Operation {
+        OperationCode Code;
+        VariableIndexType Variable;
+        PowerType Power;
+        ValueType Constant;
+    };
+
+    struct Term {
+        std::vector<PowerType> Powers;
+        ValueType Coefficient;
+        bool operator < (const Term & other) const;
+    };
+
+    /*! Generate the operations for the terms [begin, end), which have
+      the same powers for the variables before variable */
+    void CompileTerms(const std::vector<Term> & terms, size_t begin, size_t end,
+                      VariableIndexType variable);
+
+    void AddOperation(OperationCode code, VariableIndexType variable, PowerType power,
+                      ValueType constant = 0.0);
+
+    /*! Evaluate numberOfPoints, points and values are strided arrays */
+    void EvaluatePoints(const ValueType * points, ptrdiff_t variableStride, ptrdiff_t pointStride,
+                        size_t numberOfPoints, ValueType * values, ptrdiff_t valueStride);
+
+    /*! Evaluate up to BLOCK_SIZE points copied in Variables */
+    void EvaluateBlock(size_t numberOfPoints);
+
+    /*! Block of values of x_variable^power */
+    inline const ValueType * PowerBlock(VariableIndexType variable, PowerType power) const {
+        return (power == 1) ?
+            (Variables.Pointer() + variable * BLOCK_SIZE)
+            : (Powers.Pointer() + (PowerOffsets[variable] + power - 2) * BLOCK_SIZE);
+    }
+
+    VariableIndexType NumVariables;
+    std::vector<Operation> Operations;
+    //! Highest power needed for each variable and position in Powers
+    std::vector<PowerType> MaxPowers;
+    std::vector<size_t> PowerOffsets;
+    size_t MaxDepth;
+
+    //! Workspace, one block per variable, power and level of the stack
+    vctDynamicVector<ValueType> Variables;
+    vctDynamicVector<ValueType> Powers;
+    vctDynamicVector<ValueType> Stack;
+};
+
+#endif // _nmrPolynomialHornerEvaluator_h
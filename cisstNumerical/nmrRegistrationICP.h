@@ -0,0 +1,201 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrRegistrationICP
+*/
+
+
+#ifndef _nmrRegistrationICP_h
+#define _nmrRegistrationICP_h
+
+#include <vector>
+
+#include <cisstVector/vctTypes.h>
+#include <cisstNumerical/nmrKdTree.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  Iterative Closest Point (ICP) registration of a data point cloud to
+  a model point cloud.  Each iteration finds the closest model point
+  of each transformed data point and computes the rigid transformation
+  of the weighted pairs with the SVD method of nmrRegistrationRigid
+  (Arun 1987, Umeyama 1991).
+
+  - The closest points are found with a kd-tree (nmrKdTree) built by
+    SetModel.  The tree is kept until the next call to SetModel, so
+    the same model can be used for many registrations (e.g. one per
+    frame).  The correspondences of the previous iteration (or of the
+    previous call to Register if the number of data points didn't
+    change) are used as hints to speed up the queries.
+
+  - If cisst is configured with CISST_NMR_HAS_OPENMP, the closest
+    point queries are computed in parallel.
+
+  - Outliers can be rejected with a maximum distance (SetMaxDistance),
+    by keeping only a fraction of the closest pairs (trimmed ICP,
+    SetTrimRatio) and/or with robust weights (SetWeighting).
+
+  \code
+  nmrRegistrationICP icp;
+  icp.SetModel(modelPoints);
+  icp.SetTrimRatio(0.9);
+  vctFrm3 transform; // initial guess
+  if (icp.Register(dataPoints, transform)) {
+      std::cout << icp.GetRMS() << " after " << icp.GetNumberOfIterations() << std::endl;
+  }
+  \endcode
+*/
+class CISST_EXPORT nmrRegistrationICP
+{
+public:
+    /*! Robust weights of the pairs as a function of the distance r
+      and of the scale s:
+      - WEIGHT_NONE: 1
+      - WEIGHT_HUBER: 1 if r <= s, s / r otherwise
+      - WEIGHT_TUKEY: (1 - (r / s)^2)^2 if r < s, 0 otherwise */
+    typedef enum {WEIGHT_NONE, WEIGHT_HUBER, WEIGHT_TUKEY} WeightingType;
+
+    nmrRegistrationICP(void);
+
+    /*! Set the model point cloud and build the kd-tree. */
+    template <class _vectorOwnerType>
+    void SetModel(const vctDynamicConstVectorBase<_vectorOwnerType, vct3> & model) {
+        Tree.Build(model);
+        Correspondences.clear();
+    }
+
+    /*! kd-tree of the model, can be used for other queries. */
+    inline const nmrKdTree & GetModelTree(void) const {
+        return Tree;
+    }
+
+    /*! Register the data points to the model.
+      \param data The data point cloud
+      \param transform (input) Initial guess (output) Transformation
+      from data to model
+      \returns false if the model is not set or if there are less
+      than 3 pairs, true otherwise (see also HasConverged)
+    */
+    template <class _vectorOwnerType>
+    bool Register(const vctDynamicConstVectorBase<_vectorOwnerType, vct3> & data,
+                  vctFrm3 & transform) {
+        return Register(data.Pointer(), data.size(), data.stride(), transform);
+    }
+
+    /*! Maximum number of iterations (default 50). */
+    inline void SetMaxIterations(size_t maxIterations) {
+        MaxIterations = maxIterations;
+    }
+
+    /*! The iterations stop when the relative change of the RMS
+      distance is less than the tolerance (default 1e-6). */
+    inline void SetTolerance(double tolerance) {
+        Tolerance = tolerance;
+    }
+
+    /*! Pairs with a distance greater than maxDistance are not used
+      (default is no maximum). */
+    inline void SetMaxDistance(double maxDistance) {
+        MaxDistance = maxDistance;
+    }
+
+    /*! Fraction of the pairs used, the pairs with the largest
+      distances are not used (default 1.0, all pairs). */
+    inline void SetTrimRatio(double ratio) {
+        TrimRatio = ratio;
+    }
+
+    /*! Robust weighting of the pairs.  If scale is 0 (default), the
+      scale is computed at each iteration from the median distance m
+      of the pairs: 1.345 * 1.4826 m for Huber, 4.685 * 1.4826 m for
+      Tukey. */
+    inline void SetWeighting(WeightingType weighting, double scale = 0.0) {
+        Weighting = weighting;
+        WeightingScale = scale;
+    }
+
+    /*! Root mean square of the weighted distances for the last
+      iteration. */
+    inline double GetRMS(void) const {
+        return RMS;
+    }
+
+    inline size_t GetNumberOfIterations(void) const {
+        return Iterations;
+    }
+
+    /*! True if the last call to Register stopped before the maximum
+      number of iterations. */
+    inline bool HasConverged(void) const {
+        return Converged;
+    }
+
+    /*! Number of pairs with a non zero weight at the last iteration. */
+    inline size_t GetNumberOfInliers(void) const {
+        return Inliers;
+    }
+
+    /*! Index of the closest model point for each data point at the
+      last iteration, the model size if there is none within the
+      maximum distance. */
+    inline const std::vector<size_t> & GetCorrespondences(void) const {
+        return Correspondences;
+    }
+
+protected:
+    bool Register(const vct3 * data, size_t size, ptrdiff_t stride, vctFrm3 & transform);
+
+    //! Closest points of the transformed data points
+    void FindCorrespondences(const vct3 * data, ptrdiff_t stride, const vctFrm3 & transform);
+
+    //! Weights of the pairs, returns the number of non zero weights
+    size_t ComputeWeights(void);
+
+    //! Weighted paired-point registration
+    bool ComputeTransform(const vct3 * data, ptrdiff_t stride, vctFrm3 & transform) const;
+
+    nmrKdTree Tree;
+
+    size_t MaxIterations;
+    double Tolerance;
+    double MaxDistance;
+    double TrimRatio;
+    WeightingType Weighting;
+    double WeightingScale;
+
+    double RMS;
+    size_t Iterations;
+    bool Converged;
+    size_t Inliers;
+
+    std::vector<size_t> Correspondences;
+    std::vector<double> DistancesSquared;
+    std::vector<double> Weights;
+    //! Workspace for the median and the trimming
+    std::vector<double> Sorted;
+};
+
+#endif // _nmrRegistrationICP_h
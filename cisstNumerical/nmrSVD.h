@@ -971,6 +971,11 @@ public:
   and column major are allowed but they must not be mixed in a
   data object.
 
+  \note For small square fixed size matrices (e.g. 3x3 to 6x6), the
+  functions nmrSVDJacobi and nmrSVDJacobiBatch defined in
+  nmrSVDJacobi.h are faster, don't require LAPACK nor a workspace and
+  don't modify the input matrix.
+
  */
 //@{
 
@@ -0,0 +1,311 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrSVDJacobi and nmrSVDJacobiBatch
+*/
+
+
+#ifndef _nmrSVDJacobi_h
+#define _nmrSVDJacobi_h
+
+#include <limits>
+#include <math.h>
+
+#include <cisstVector/vctFixedSizeMatrix.h>
+#include <cisstVector/vctFixedSizeVector.h>
+
+
+#ifndef DOXYGEN
+/*
+  Kernel used by nmrSVDJacobi and nmrSVDJacobiBatch.  The one-sided
+  (Hestenes) Jacobi method orthogonalizes the columns of A V with plane
+  rotations, the singular values are the norms of the columns.  The
+  kernel solves _lanes independent problems at once, the matrices are
+  stored element by element with the problems contiguous so that the
+  loops on the problems can be vectorized.  The rotations are computed
+  without branches, all the problems use the same number of sweeps.
+  Each matrix is scaled by its largest element to avoid overflows and
+  underflows when computing the squared norms of the columns.
+*/
+template <class _elementType, vct::size_type _size, vct::size_type _lanes>
+class nmrSVDJacobiKernel
+{
+public:
+    typedef _elementType value_type;
+    typedef vct::size_type size_type;
+
+    enum {MAX_SWEEPS = 30};
+
+    // columns of A V and V, element [column][row][problem]
+    value_type W[_size][_size][_lanes];
+    value_type V[_size][_size][_lanes];
+    value_type Scale[_lanes];
+
+    template <bool _storageOrder>
+    inline void Load(size_type lane,
+                     const vctFixedSizeMatrix<value_type, _size, _size, _storageOrder> & A)
+    {
+        size_type row, column;
+        value_type maxAbs = value_type(0);
+        for (column = 0; column < _size; column++) {
+            for (row = 0; row < _size; row++) {
+                const value_type absolute = fabs(A.Element(row, column));
+                maxAbs = (absolute > maxAbs) ? absolute : maxAbs;
+            }
+        }
+        Scale[lane] = (maxAbs > value_type(0)) ? maxAbs : value_type(1);
+        const value_type inverseScale = value_type(1) / Scale[lane];
+        for (column = 0; column < _size; column++) {
+            for (row = 0; row < _size; row++) {
+                W[column][row][lane] = A.Element(row, column) * inverseScale;
+                V[column][row][lane] = (row == column) ? value_type(1) : value_type(0);
+            }
+        }
+    }
+
+    /* Returns the number of sweeps, MAX_SWEEPS + 1 if the method
+       didn't converge. */
+    inline int Sweeps(void)
+    {
+        const value_type tolerance = static_cast<value_type>(_size) * std::numeric_limits<value_type>::epsilon();
+        const value_type tolerance2 = tolerance * tolerance;
+        const value_type tiny = std::numeric_limits<value_type>::min();
+        value_type alpha[_lanes], beta[_lanes], gamma[_lanes];
+        value_type c[_lanes], s[_lanes];
+        size_type p, q, row, lane;
+        for (int sweep = 1; sweep <= MAX_SWEEPS; sweep++) {
+            // largest cos^2 - tolerance^2 of the angle between two columns
+            value_type offMax = value_type(0);
+            for (p = 0; p < _size - 1; p++) {
+                for (q = p + 1; q < _size; q++) {
+                    for (lane = 0; lane < _lanes; lane++) {
+                        alpha[lane] = value_type(0);
+                        beta[lane] = value_type(0);
+                        gamma[lane] = value_type(0);
+                    }
+                    for (row = 0; row < _size; row++) {
+                        const value_type * wp = W[p][row];
+                        const value_type * wq = W[q][row];
+                        for (lane = 0; lane < _lanes; lane++) {
+                            alpha[lane] += wp[lane] * wp[lane];
+                            beta[lane] += wq[lane] * wq[lane];
+                            gamma[lane] += wp[lane] * wq[lane];
+                        }
+                    }
+                    // rotation zeroing the dot product of the columns,
+                    // tangent of the smallest angle, t = 0 if gamma = 0
+                    for (lane = 0; lane < _lanes; lane++) {
+                        const value_type off = gamma[lane] * gamma[lane]
+                            - tolerance2 * alpha[lane] * beta[lane];
+                        offMax = (off > offMax) ? off : offMax;
+                        const value_type tau = beta[lane] - alpha[lane];
+                        const value_type sign = (tau < value_type(0)) ? value_type(-1) : value_type(1);
+                        const value_type t = sign * value_type(2) * gamma[lane]
+                            / (sign * tau + sqrt(tau * tau + value_type(4) * gamma[lane] * gamma[lane]) + tiny);
+                        c[lane] = value_type(1) / sqrt(value_type(1) + t * t);
+                        s[lane] = c[lane] * t;
+                    }
+                    for (row = 0; row < _size; row++) {
+                        value_type * wp = W[p][row];
+                        value_type * wq = W[q][row];
+                        value_type * vp = V[p][row];
+                        value_type * vq = V[q][row];
+                        for (lane = 0; lane < _lanes; lane++) {
+                            const value_type w = wp[lane];
+                            wp[lane] = c[lane] * w - s[lane] * wq[lane];
+                            wq[lane] = s[lane] * w + c[lane] * wq[lane];
+                            const value_type v = vp[lane];
+                            vp[lane] = c[lane] * v - s[lane] * vq[lane];
+                            vq[lane] = s[lane] * v + c[lane] * vq[lane];
+                        }
+                    }
+                }
+            }
+            if (offMax <= value_type(0)) {
+                return sweep;
+            }
+        }
+        return MAX_SWEEPS + 1;
+    }
+
+    /* Singular values in decreasing order and singular vectors of one
+       problem. */
+    template <bool _storageOrder, vct::stride_type _stride, class _dataPtrType>
+    inline void Store(size_type lane,
+                      vctFixedSizeMatrix<value_type, _size, _size, _storageOrder> & U,
+                      vctFixedSizeVectorBase<_size, _stride, value_type, _dataPtrType> & S,
+                      vctFixedSizeMatrix<value_type, _size, _size, _storageOrder> & Vt) const
+    {
+        value_type sigma[_size];
+        size_type order[_size];
+        size_type i, j, row;
+        value_type sigmaMax = value_type(0);
+        for (i = 0; i < _size; i++) {
+            value_type norm2 = value_type(0);
+            for (row = 0; row < _size; row++) {
+                norm2 += W[i][row][lane] * W[i][row][lane];
+            }
+            sigma[i] = sqrt(norm2);
+            sigmaMax = (sigma[i] > sigmaMax) ? sigma[i] : sigmaMax;
+            // insertion sort, decreasing order
+            for (j = i; (j > 0) && (sigma[order[j - 1]] < sigma[i]); j--) {
+                order[j] = order[j - 1];
+            }
+            order[j] = i;
+        }
+        const value_type zero = sigmaMax * std::numeric_limits<value_type>::epsilon();
+        for (i = 0; i < _size; i++) {
+            const size_type column = order[i];
+            S[i] = sigma[column] * Scale[lane];
+            for (row = 0; row < _size; row++) {
+                Vt.Element(i, row) = V[column][row][lane];
+            }
+            if (sigma[column] > zero) {
+                for (row = 0; row < _size; row++) {
+                    U.Element(row, i) = W[column][row][lane] / sigma[column];
+                }
+            } else {
+                // rank deficient, complete U with the unit vector the
+                // most orthogonal to the previous columns
+                value_type bestNorm2 = value_type(-1);
+                size_type k, pass;
+                for (k = 0; k < _size; k++) {
+                    value_type u[_size];
+                    for (row = 0; row < _size; row++) {
+                        u[row] = (row == k) ? value_type(1) : value_type(0);
+                    }
+                    for (pass = 0; pass < 2; pass++) {
+                        for (j = 0; j < i; j++) {
+                            value_type dot = value_type(0);
+                            for (row = 0; row < _size; row++) {
+                                dot += U.Element(row, j) * u[row];
+                            }
+                            for (row = 0; row < _size; row++) {
+                                u[row] -= dot * U.Element(row, j);
+                            }
+                        }
+                    }
+                    value_type norm2 = value_type(0);
+                    for (row = 0; row < _size; row++) {
+                        norm2 += u[row] * u[row];
+                    }
+                    if (norm2 > bestNorm2) {
+                        bestNorm2 = norm2;
+                        const value_type norm = sqrt(norm2);
+                        for (row = 0; row < _size; row++) {
+                            U.Element(row, i) = u[row] / norm;
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+#endif // DOXYGEN
+
+
+/*!
+  \ingroup cisstNumerical
+  \name SVD of small fixed size matrices
+
+  These functions compute the singular value decomposition A = U S Vt
+  of small square fixed size matrices (e.g. 3x3, 4x4, 6x6) using the
+  one-sided Jacobi method.  Unlike nmrSVD, they don't use LAPACK,
+  don't need a workspace, don't modify A and accept any storage order.
+  The one-sided Jacobi method is accurate for small matrices (the
+  singular values have a high relative accuracy) and, for sizes up to
+  6x6, faster than the general LAPACK routine.  The results follow the
+  nmrSVD conventions: the singular values are in decreasing order and
+  U and Vt are orthogonal.
+
+  nmrSVDJacobiBatch solves many independent problems of the same size,
+  e.g. the 3x3 SVDs of point set registrations.  The problems are
+  processed by groups of 4, interleaved in memory, so that the compiler
+  can use SIMD instructions across the problems.
+
+  \code
+  vctFixedSizeMatrix<double, 3, 3> A, U, Vt;
+  vctFixedSizeVector<double, 3> S;
+  nmrSVDJacobi(A, U, S, Vt);
+
+  std::vector<vctDouble3x3> As(1000), Us(1000), Vts(1000);
+  std::vector<vctDouble3> Ss(1000);
+  nmrSVDJacobiBatch(As.size(), &(As[0]), &(Us[0]), &(Ss[0]), &(Vts[0]));
+  \endcode
+
+  \return 0 if the method converged, 1 otherwise (for the batch, if
+  the method didn't converge for one of the problems).
+
+  \test nmrSVDJacobiTest::TestSVD3x3
+        nmrSVDJacobiTest::TestSVD6x6
+        nmrSVDJacobiTest::TestRankDeficient
+        nmrSVDJacobiTest::TestBatch
+*/
+//@{
+template <class _elementType, vct::size_type _size, bool _storageOrder,
+          vct::stride_type _stride, class _dataPtrType>
+inline int nmrSVDJacobi(const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & A,
+                        vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & U,
+                        vctFixedSizeVectorBase<_size, _stride, _elementType, _dataPtrType> & S,
+                        vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & Vt)
+{
+    typedef nmrSVDJacobiKernel<_elementType, _size, 1> KernelType;
+    KernelType kernel;
+    kernel.Load(0, A);
+    const int sweeps = kernel.Sweeps();
+    kernel.Store(0, U, S, Vt);
+    return (sweeps > KernelType::MAX_SWEEPS) ? 1 : 0;
+}
+
+
+template <class _elementType, vct::size_type _size, bool _storageOrder>
+inline int nmrSVDJacobiBatch(vct::size_type count,
+                             const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> * A,
+                             vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> * U,
+                             vctFixedSizeVector<_elementType, _size> * S,
+                             vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> * Vt)
+{
+    enum {LANES = 4};
+    typedef nmrSVDJacobiKernel<_elementType, _size, LANES> KernelType;
+    KernelType kernel;
+    int result = 0;
+    vct::size_type first, lane;
+    for (first = 0; first < count; first += LANES) {
+        const vct::size_type last = (first + LANES < count) ? (first + LANES) : count;
+        // unused lanes of the last group solve the first problem again
+        for (lane = 0; lane < LANES; lane++) {
+            kernel.Load(lane, A[(first + lane < last) ? (first + lane) : first]);
+        }
+        if (kernel.Sweeps() > KernelType::MAX_SWEEPS) {
+            result = 1;
+        }
+        for (lane = 0; first + lane < last; lane++) {
+            kernel.Store(lane, U[first + lane], S[first + lane], Vt[first + lane]);
+        }
+    }
+    return result;
+}
+//@}
+
+
+#endif // _nmrSVDJacobi_h
@@ -32,6 +32,8 @@ http://www.cisst.org/cisst/license.txt.
    by the filter size determined by the number of samples NL left of a data 
    point and the number of samples NR right of the data point. For a causal 
    filter NR=0
+
+   To filter a stream of samples, see nmrSavitzkyGolayFilter.
 */
 
 vctDynamicVector<double> CISST_EXPORT nmrSavitzkyGolay( int K, 
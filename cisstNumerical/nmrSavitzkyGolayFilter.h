@@ -0,0 +1,168 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Declaration of nmrSavitzkyGolayFilter
+*/
+
+
+#ifndef _nmrSavitzkyGolayFilter_h
+#define _nmrSavitzkyGolayFilter_h
+
+#include <cisstCommon/cmnThrow.h>
+#include <cisstVector/vctDynamicMatrix.h>
+#include <cisstVector/vctDynamicVector.h>
+
+// Always include last
+#include <cisstNumerical/nmrExport.h>
+
+/*!
+  \ingroup cisstNumerical
+
+  Streaming Savitzky-Golay filter for multi-channel signals, e.g. the
+  joint positions of a robot.  Each new sample (one value per channel)
+  is added with Update and the filter computes, for all the channels,
+  the smoothed value and the derivatives (velocity, acceleration, ...)
+  of a polynomial fitted to the last samples.
+
+  The window contains the last left + right + 1 samples.  The outputs
+  are estimated at the sample received right samples ago, i.e. the
+  filter is causal if right is 0 and has a delay of right samples
+  otherwise.  The same conventions are used by nmrSavitzkyGolay, which
+  can be used to compute the coefficients (see SetCoefficients).
+
+  The samples are stored twice in a ring buffer so that the window is
+  always contiguous in memory.  Each update costs one multiplication
+  and addition per coefficient and channel, the loops over channels
+  can be vectorized.  Update doesn't allocate memory.
+
+  \code
+  nmrSavitzkyGolayFilter filter;
+  // 2nd order polynomial, position, velocity and acceleration, 9
+  // past samples, causal, 6 joints sampled at 5 kHz
+  filter.Configure(2, 2, 9, 0, 6, 1.0 / 5000.0);
+  ...
+  if (filter.Update(jointPositions)) {
+      velocities.Assign(filter.GetOutput(1));
+      accelerations.Assign(filter.GetOutput(2));
+  }
+  \endcode
+*/
+class CISST_EXPORT nmrSavitzkyGolayFilter
+{
+public:
+    nmrSavitzkyGolayFilter(void);
+
+    /*! Compute the coefficients of the filter.
+      \param polynomialOrder Order of the fitted polynomial
+      \param maxDerivative Highest derivative computed, outputs are 0 (smoothed) to maxDerivative
+      \param left Number of samples before the estimated sample
+      \param right Number of samples after the estimated sample (0 for causal)
+      \param numberOfChannels Size of the samples
+      \param period Sampling period, used to scale the derivatives
+
+      Throws an exception if maxDerivative is greater than
+      polynomialOrder or if the window is too small for the
+      polynomial order.
+    */
+    void Configure(size_t polynomialOrder, size_t maxDerivative,
+                   size_t left, size_t right,
+                   size_t numberOfChannels, double period = 1.0);
+
+    /*! Use precomputed coefficients, one row per output and one
+      column per sample of the window, the first column for the oldest
+      sample (e.g. rows computed with nmrSavitzkyGolay).  The
+      coefficients are used as is, derivatives are not scaled by the
+      sampling period. */
+    void SetCoefficients(const vctDynamicMatrix<double> & coefficients,
+                         size_t right, size_t numberOfChannels);
+
+    /*! Remove all the samples */
+    void Reset(void);
+
+    /*! Add a sample and compute the outputs.  Returns false until the
+      window is full, the outputs are zero until then. */
+    template <class _vectorOwnerType>
+    bool Update(const vctDynamicConstVectorBase<_vectorOwnerType, double> & sample) {
+        if (sample.size() != Outputs.cols()) {
+            cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::Update: size of sample doesn't match number of channels"));
+        }
+        return Update(sample.Pointer(), sample.stride());
+    }
+
+    /*! Add a sample for a single channel filter. */
+    inline bool Update(double sample) {
+        if (Outputs.cols() != 1) {
+            cmnThrow(std::runtime_error("nmrSavitzkyGolayFilter::Update: filter has more than one channel"));
+        }
+        return Update(&sample, 1);
+    }
+
+    /*! True if the window is full */
+    inline bool IsValid(void) const {
+        return (NumberOfSamples == WindowSize);
+    }
+
+    inline size_t GetWindowSize(void) const {
+        return WindowSize;
+    }
+
+    /*! Delay of the outputs in number of samples */
+    inline size_t GetDelay(void) const {
+        return Delay;
+    }
+
+    inline const vctDynamicMatrix<double> & GetCoefficients(void) const {
+        return Coefficients;
+    }
+
+    /*! All the outputs, one row per output (smoothed value and
+      derivatives), one column per channel */
+    inline const vctDynamicMatrix<double> & GetOutputs(void) const {
+        return Outputs;
+    }
+
+    /*! One output for all the channels, 0 for the smoothed value, 1
+      for the first derivative, ... */
+    inline vctDynamicConstVectorRef<double> GetOutput(size_t index) const {
+        return Outputs.Row(index);
+    }
+
+protected:
+    bool Update(const double * sample, ptrdiff_t stride);
+
+    /*! Allocate the history and outputs */
+    void Allocate(size_t numberOfChannels);
+
+    vctDynamicMatrix<double> Coefficients;
+    size_t WindowSize;
+    size_t Delay;
+
+    //! Each sample is stored in rows Position and Position + WindowSize
+    vctDynamicMatrix<double> History;
+    size_t Position;
+    size_t NumberOfSamples;
+
+    vctDynamicMatrix<double> Outputs;
+};
+
+#endif // _nmrSavitzkyGolayFilter_h
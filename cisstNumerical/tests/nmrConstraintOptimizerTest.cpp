@@ -112,6 +112,7 @@ void nmrConstraintOptimizerTest::TestSetRefs(void)
     CPPUNIT_ASSERT_EQUAL(ERows, fRef.size());
 }
 
+#if CISST_HAS_CISSTNETLIB
 /*! Test Solve */
 void nmrConstraintOptimizerTest::TestSolve(void)
 {
@@ -141,3 +142,180 @@ void nmrConstraintOptimizerTest::TestSolve(void)
     vctDoubleVec dq(NumVars);
     CPPUNIT_ASSERT_EQUAL(co.Solve(dq), nmrConstraintOptimizer::NMR_OK);
 }
+#endif
+
+/*! Joint motion towards a target with joint limits, the first joint is
+  softly limited using a slack and the sum of the joint motions is
+  fixed */
+static void SetUpRealTimeProblem(nmrConstraintOptimizer & co, const vctDoubleVec & target, const double slackWeight)
+{
+    const size_t NumVars = target.size();
+    size_t CRows = NumVars + 1, ARows = 2 * NumVars + 1, ERows = 1, Slacks = 1;
+    vctDoubleVec SlackLimits(1);
+    SlackLimits[0] = 0.5;
+    co.ResetIndices();
+    vctDynamicMatrixRef<double> CRef, CSlackRef, ARef, ASlackRef, ERef, ESlackRef;
+    vctDynamicVectorRef<double> dRef, bRef, fRef;
+    co.SetRefs(CRows, ARows, ERows, Slacks, SlackLimits, CRef, CSlackRef, dRef, ARef, ASlackRef, bRef, ERef, ESlackRef, fRef);
+    CRef.SetAll(0.0);
+    CSlackRef.SetAll(0.0);
+    ARef.SetAll(0.0);
+    ASlackRef.SetAll(0.0);
+    ERef.SetAll(0.0);
+    ESlackRef.SetAll(0.0);
+    for (size_t i = 0; i < NumVars; i++) {
+        CRef[i][i] = 1.0;
+        if (i > 0) {
+            CRef[i][i - 1] = 0.2;
+        }
+        dRef[i] = target[i];
+        // -1 <= x_i <= 1
+        ARef[2 * i][i] = 1.0;
+        bRef[2 * i] = -1.0;
+        ARef[2 * i + 1][i] = -1.0;
+        bRef[2 * i + 1] = -1.0;
+    }
+    CSlackRef[NumVars][0] = slackWeight;
+    dRef[NumVars] = 0.0;
+    // x_0 + s >= 0.8
+    ARef[2 * NumVars][0] = 1.0;
+    ASlackRef[2 * NumVars][0] = 1.0;
+    bRef[2 * NumVars] = 0.8;
+    ERef.SetAll(1.0);
+    fRef[0] = 0.3;
+}
+
+/*! Test Solve with the preallocated solver */
+void nmrConstraintOptimizerTest::TestSolveRealTime(void)
+{
+    size_t NumVars = 6;
+    nmrConstraintOptimizer co(NumVars);
+    co.ResetIndices();
+    co.ReserveSpace(NumVars + 1, 2 * NumVars + 1, 1, 1);
+    co.Allocate();
+    vctDoubleVec target(NumVars);
+    target.Assign(2.0, -0.5, 0.3, -2.0, 0.7, 0.1);
+    SetUpRealTimeProblem(co, target, 1.0);
+
+    vctDoubleVec dqReference(NumVars);
+#if CISST_HAS_CISSTNETLIB
+    // reference solution with nmrLSqLin
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dqReference));
+    CPPUNIT_ASSERT(!co.IsRealTime());
+#else
+    // without nmrLSqLin, the reference is the solution for the exact
+    // sizes, Solve allocates the preallocated solver
+    CPPUNIT_ASSERT(!co.IsRealTime());
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dqReference));
+    CPPUNIT_ASSERT(co.IsRealTime());
+    CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+    // x_0 + s >= 0.8 with s <= 0.5 and the sum of the joint motions
+    CPPUNIT_ASSERT(dqReference[0] + dqReference[NumVars] >= 0.8 - 1e-10);
+    CPPUNIT_ASSERT(dqReference[NumVars] <= 0.5 + 1e-10);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3, dqReference.Ref(NumVars).SumOfElements(), 1e-10);
+#endif
+
+    // exact sizes
+    co.AllocateRealTime(NumVars + 1, 2 * NumVars + 2, 1);
+    CPPUNIT_ASSERT(co.IsRealTime());
+    vctDoubleVec dq(NumVars + 1);
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+    CPPUNIT_ASSERT_EQUAL(NumVars + 1, dq.size());
+    CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+    size_t i;
+    for (i = 0; i < NumVars; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(dqReference[i], dq[i], 1e-8);
+    }
+
+    // same problem, the previous active set is the solution
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), co.GetNumberOfIterations());
+
+    // larger maximum sizes, unused rows are ignored
+    co.AllocateRealTime(2 * NumVars, 4 * NumVars, 3);
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+    for (i = 0; i < NumVars; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(dqReference[i], dq[i], 1e-8);
+    }
+
+    // slack not in the objective, damping is required
+    SetUpRealTimeProblem(co, target, 0.0);
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_RANK_DEFICIENT, co.Solve(dq));
+    co.SetDamping(1e-3);
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+    CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+
+    co.DisableRealTime();
+    CPPUNIT_ASSERT(!co.IsRealTime());
+}
+
+/*! Test Solve with the preallocated solver when some objective rows change */
+void nmrConstraintOptimizerTest::TestRealTimeObjectiveRows(void)
+{
+    size_t NumVars = 6;
+    nmrConstraintOptimizer co(NumVars);
+    co.ResetIndices();
+    co.ReserveSpace(NumVars + 1, 2 * NumVars + 1, 1, 1);
+    co.Allocate();
+    co.AllocateRealTime(NumVars + 1, 2 * NumVars + 2, 1);
+    vctDoubleVec target(NumVars);
+    target.Assign(2.0, -0.5, 0.3, -2.0, 0.7, 0.1);
+    SetUpRealTimeProblem(co, target, 1.0);
+    vctDoubleVec dq;
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+
+    // each cycle, one objective value and the slack row change; the
+    // reference is a new solver which factorizes the whole objective
+    vctDoubleVec dqReference;
+    for (size_t cycle = 1; cycle < 20; cycle++) {
+        target[cycle % NumVars] += 0.05 * cycle;
+        const double slackWeight = 1.0 + 0.1 * cycle;
+        SetUpRealTimeProblem(co, target, slackWeight);
+        CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+
+        nmrConstraintOptimizer reference(NumVars);
+        reference.ResetIndices();
+        reference.ReserveSpace(NumVars + 1, 2 * NumVars + 1, 1, 1);
+        reference.Allocate();
+        reference.AllocateRealTime(NumVars + 1, 2 * NumVars + 2, 1);
+        SetUpRealTimeProblem(reference, target, slackWeight);
+        CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, reference.Solve(dqReference));
+        CPPUNIT_ASSERT(dq.AlmostEqual(dqReference, 1e-9));
+    }
+}
+
+/*! Test Solve with the preallocated solver and limited iterations */
+void nmrConstraintOptimizerTest::TestRealTimeMaxIterations(void)
+{
+    size_t NumVars = 6;
+    nmrConstraintOptimizer co(NumVars);
+    co.ResetIndices();
+    co.ReserveSpace(NumVars + 1, 2 * NumVars + 1, 1, 1);
+    co.Allocate();
+    co.AllocateRealTime(NumVars + 1, 2 * NumVars + 2, 1, 1);
+    vctDoubleVec target(NumVars, 0.0);
+    target[0] = 0.9;
+    SetUpRealTimeProblem(co, target, 1.0);
+    vctDoubleVec dq;
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_OK, co.Solve(dq));
+    const vctDoubleVec previous(dq);
+
+    // large motion, all the joint limits are reached, the previous
+    // solution is still feasible and returned
+    target.Assign(5.0, -5.0, 5.0, -5.0, 5.0, -5.0);
+    SetUpRealTimeProblem(co, target, 1.0);
+    CPPUNIT_ASSERT_EQUAL(nmrConstraintOptimizer::NMR_MAX_ITERATIONS, co.Solve(dq));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), co.GetNumberOfIterations());
+    CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+    CPPUNIT_ASSERT(dq.AlmostEqual(previous, 1e-12));
+
+    // following cycles continue from the constraints found
+    size_t cycles = 1;
+    while (co.Solve(dq) == nmrConstraintOptimizer::NMR_MAX_ITERATIONS) {
+        CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+        cycles++;
+        CPPUNIT_ASSERT(cycles < 10);
+    }
+    CPPUNIT_ASSERT(co.GetConstraintViolation() < 1e-10);
+    CPPUNIT_ASSERT(cycles > 1);
+}
@@ -32,7 +32,12 @@ class nmrConstraintOptimizerTest: public CppUnit::TestCase
         CPPUNIT_TEST(TestConstructor);
         CPPUNIT_TEST(TestAllocate);
         CPPUNIT_TEST(TestSetRefs);
+#if CISST_HAS_CISSTNETLIB
         CPPUNIT_TEST(TestSolve);
+#endif
+        CPPUNIT_TEST(TestSolveRealTime);
+        CPPUNIT_TEST(TestRealTimeObjectiveRows);
+        CPPUNIT_TEST(TestRealTimeMaxIterations);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -53,8 +58,19 @@ class nmrConstraintOptimizerTest: public CppUnit::TestCase
     /*! Test SetRefs command */
     void TestSetRefs(void);
 
+#if CISST_HAS_CISSTNETLIB
     /*! Test Solve */
     void TestSolve(void);
+#endif
+
+    /*! Test Solve with the preallocated solver */
+    void TestSolveRealTime(void);
+
+    /*! Test Solve with the preallocated solver when some objective rows change */
+    void TestRealTimeObjectiveRows(void);
+
+    /*! Test Solve with the preallocated solver and limited iterations */
+    void TestRealTimeMaxIterations(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(nmrConstraintOptimizerTest);
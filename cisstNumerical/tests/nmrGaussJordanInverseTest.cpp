@@ -68,6 +68,34 @@ void nmrGaussJordanInverseTest::MakeSingularMatrix(vctFixedSizeMatrix<_elementTy
     m.Row(selectedRow).Assign( combination );
 }
 
+template <class _elementType>
+void nmrGaussJordanInverseTest::TestInverse6x6(void)
+{
+    typedef _elementType value_type;
+    enum {SIZE = 6};
+    vctFixedSizeMatrix<value_type, SIZE, SIZE, VCT_ROW_MAJOR> A, Ainv, Ainvinv, Adiff;
+    vctRandom(A, value_type(-RandomElementRange), value_type(RandomElementRange));
+    // keep the condition number reasonable for float
+    A.Diagonal().Add(value_type(2 * RandomElementRange));
+    value_type tolerance = value_type(ToleranceScale) * cmnTypeTraits<value_type>::Tolerance();
+    bool nonsingular;
+
+    nmrGaussJordanInverse6x6(A, nonsingular, Ainv, tolerance);
+
+    if (!nonsingular)
+        return;
+
+    TestMatrixInverse(A, Ainv, tolerance);
+
+    nmrGaussJordanInverse6x6(Ainv, nonsingular, Ainvinv, tolerance);
+
+    CPPUNIT_ASSERT(nonsingular);
+
+    Adiff.DifferenceOf(A, Ainvinv);
+    value_type maxDiff = Adiff.LinfNorm();
+    CPPUNIT_ASSERT(maxDiff < tolerance * RandomElementRange);
+}
+
 template <class _elementType>
 void nmrGaussJordanInverseTest::TestInverse4x4(void)
 {
@@ -150,6 +178,29 @@ void nmrGaussJordanInverseTest::TestInverse2x2(void)
 
 }
 
+template <class _elementType>
+void nmrGaussJordanInverseTest::TestSingular6x6(void)
+{
+    typedef _elementType value_type;
+    enum {SIZE = 6};
+    vctFixedSizeMatrix<value_type, SIZE, SIZE, VCT_ROW_MAJOR> A, Ainv;
+    vctRandom(A, value_type(-RandomElementRange), value_type(RandomElementRange));
+    MakeSingularMatrix(A);
+    value_type tolerance = value_type(ToleranceScale) * cmnTypeTraits<value_type>::Tolerance();
+    bool nonsingular;
+
+    nmrGaussJordanInverse6x6(A, nonsingular, Ainv, tolerance);
+
+    CPPUNIT_ASSERT(!nonsingular);
+
+    A.Diagonal().Add( value_type(1) );
+
+    nmrGaussJordanInverse6x6(A, nonsingular, Ainv, tolerance);
+
+    CPPUNIT_ASSERT(nonsingular);
+}
+
+
 template <class _elementType>
 void nmrGaussJordanInverseTest::TestSingular4x4(void)
 {
@@ -218,6 +269,49 @@ void nmrGaussJordanInverseTest::TestSingular2x2(void)
 }
 
 
+template <class _elementType, vct::size_type _size>
+void nmrGaussJordanInverseTest::TestBatch(void)
+{
+    typedef _elementType value_type;
+    typedef vctFixedSizeMatrix<value_type, _size, _size, VCT_ROW_MAJOR> MatrixType;
+    enum {COUNT = 21};
+    MatrixType A[COUNT], Ainv[COUNT];
+    bool nonsingular[COUNT];
+    value_type tolerance = value_type(ToleranceScale) * cmnTypeTraits<value_type>::Tolerance();
+    size_t index;
+    for (index = 0; index < COUNT; index++) {
+        vctRandom(A[index], value_type(-RandomElementRange), value_type(RandomElementRange));
+        A[index].Diagonal().Add(value_type(2 * RandomElementRange));
+        if ((index % 5) == 3) {
+            MakeSingularMatrix(A[index]);
+        }
+        Ainv[index].SetAll(value_type(-1));
+    }
+
+    nmrGaussJordanInverseBatch(COUNT, A, nonsingular, Ainv, tolerance);
+
+    for (index = 0; index < COUNT; index++) {
+        CPPUNIT_ASSERT_EQUAL((index % 5) != 3, nonsingular[index]);
+        if (nonsingular[index]) {
+            TestMatrixInverse(A[index], Ainv[index], tolerance);
+        } else {
+            // output not modified for singular matrices
+            CPPUNIT_ASSERT(Ainv[index].Equal(value_type(-1)));
+        }
+    }
+}
+
+
+void nmrGaussJordanInverseTest::TestInverse6x6Double(void)
+{
+    TestInverse6x6<double>();
+}
+
+void nmrGaussJordanInverseTest::TestInverse6x6Float(void)
+{
+    TestInverse6x6<float>();
+}
+
 void nmrGaussJordanInverseTest::TestInverse4x4Double(void)
 {
     TestInverse4x4<double>();
@@ -247,6 +341,16 @@ void nmrGaussJordanInverseTest::TestInverse2x2Float()
     TestInverse2x2<float>();
 }
 
+void nmrGaussJordanInverseTest::TestSingular6x6Double(void)
+{
+    TestSingular6x6<double>();
+}
+
+void nmrGaussJordanInverseTest::TestSingular6x6Float(void)
+{
+    TestSingular6x6<float>();
+}
+
 void nmrGaussJordanInverseTest::TestSingular4x4Double(void)
 {
     TestSingular4x4<double>();
@@ -277,5 +381,20 @@ void nmrGaussJordanInverseTest::TestSingular2x2Float(void)
     TestSingular2x2<float>();
 }
 
+void nmrGaussJordanInverseTest::TestBatch4x4Double(void)
+{
+    TestBatch<double, 4>();
+}
+
+void nmrGaussJordanInverseTest::TestBatch6x6Double(void)
+{
+    TestBatch<double, 6>();
+}
+
+void nmrGaussJordanInverseTest::TestBatch6x6Float(void)
+{
+    TestBatch<float, 6>();
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(nmrGaussJordanInverseTest);
 
@@ -31,6 +31,8 @@ class nmrGaussJordanInverseTest : public CppUnit::TestCase
 {
     CPPUNIT_TEST_SUITE(nmrGaussJordanInverseTest);
 
+    CPPUNIT_TEST(TestInverse6x6Double);
+    CPPUNIT_TEST(TestInverse6x6Float);
     CPPUNIT_TEST(TestInverse4x4Double);
     CPPUNIT_TEST(TestInverse4x4Float);
     CPPUNIT_TEST(TestInverse3x3Double);
@@ -38,6 +40,8 @@ class nmrGaussJordanInverseTest : public CppUnit::TestCase
     CPPUNIT_TEST(TestInverse2x2Double);
     CPPUNIT_TEST(TestInverse2x2Float);
 
+    CPPUNIT_TEST(TestSingular6x6Double);
+    CPPUNIT_TEST(TestSingular6x6Float);
     CPPUNIT_TEST(TestSingular4x4Double);
     CPPUNIT_TEST(TestSingular4x4Float);
     CPPUNIT_TEST(TestSingular3x3Double);
@@ -45,6 +49,10 @@ class nmrGaussJordanInverseTest : public CppUnit::TestCase
     CPPUNIT_TEST(TestSingular2x2Double);
     CPPUNIT_TEST(TestSingular2x2Float);
 
+    CPPUNIT_TEST(TestBatch4x4Double);
+    CPPUNIT_TEST(TestBatch6x6Double);
+    CPPUNIT_TEST(TestBatch6x6Float);
+
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -73,6 +81,9 @@ public:
     //: Test that the inverse computed by nmrGaussJordanInverseNxN is an inverse, by creating
     // a random matrix, trying to compute its inverse, and then if it's nonsingular verify
     // the inverse property: A * A^{-1} = I, and A^{-1}^{-1} = A.
+    template <class _elementType>
+    void TestInverse6x6(void);
+
     template <class _elementType>
     void TestInverse4x4(void);
 
@@ -82,6 +93,8 @@ public:
     template <class _elementType>
     void TestInverse2x2(void);
 
+    void TestInverse6x6Double(void);
+    void TestInverse6x6Float(void);
     void TestInverse4x4Double(void);
     void TestInverse4x4Float(void);
     void TestInverse3x3Double(void);
@@ -103,6 +116,9 @@ public:
     // good enough for us, and if an incorrect input is generated, we ignore that error.
     // Note that there are still some numerical stability issues that cause incorrect
     // detection, and these may shadow the other rare cases.
+    template <class _elementType>
+    void TestSingular6x6(void);
+
     template <class _elementType>
     void TestSingular4x4(void);
 
@@ -112,6 +128,8 @@ public:
     template <class _elementType>
     void TestSingular2x2(void);
 
+    void TestSingular6x6Double(void);
+    void TestSingular6x6Float(void);
     void TestSingular4x4Double(void);
     void TestSingular4x4Float(void);
     void TestSingular3x3Double(void);
@@ -119,6 +137,16 @@ public:
     void TestSingular2x2Double(void);
     void TestSingular2x2Float(void);
 
+    //: Test nmrGaussJordanInverseBatch on an array of matrices, some of them
+    // singular.  The number of matrices is not a multiple of the group size
+    // used by the batch function.
+    template <class _elementType, vct::size_type _size>
+    void TestBatch(void);
+
+    void TestBatch4x4Double(void);
+    void TestBatch6x6Double(void);
+    void TestBatch6x6Float(void);
+
     static const double ToleranceScale;
     static const double RandomElementRange;
 
@@ -0,0 +1,319 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "nmrSavitzkyGolayFilterTest.h"
+#include "nmrLSNonLinBlockSolverTest.h"
+
+#include <cisstCommon/cmnRandomSequence.h>
+
+#include <math.h>
+
+
+// residuals 10 (x1 - x0^2) and 1 - x0
+class nmrLSNonLinBlockSolverTestRosenbrock: public nmrLSNonLinBlockSolver::Problem
+{
+public:
+    bool EvaluateBlock(size_t CMN_UNUSED(block), const vctDynamicVector<double> & parameters,
+                       vctDynamicVectorRef<double> & residual,
+                       vctDynamicMatrixRef<double> & jacobian) const {
+        residual[0] = 10.0 * (parameters[1] - parameters[0] * parameters[0]);
+        residual[1] = 1.0 - parameters[0];
+        jacobian.Element(0, 0) = -20.0 * parameters[0];
+        jacobian.Element(0, 1) = 10.0;
+        jacobian.Element(1, 0) = -1.0;
+        jacobian.Element(1, 1) = 0.0;
+        return true;
+    }
+};
+
+
+// planar arm, parameters are the link lengths followed by the joint
+// offsets, one block per measured position of the tip
+class nmrLSNonLinBlockSolverTestArm: public nmrLSNonLinBlockSolver::Problem
+{
+public:
+    vctDynamicMatrix<double> Joints;
+    vctDynamicMatrix<double> Positions;
+
+    static void Forward(const vctDynamicVector<double> & parameters,
+                        const vctDynamicConstVectorRef<double> & joints,
+                        double & x, double & y) {
+        const size_t links = joints.size();
+        double angle = 0.0;
+        x = 0.0;
+        y = 0.0;
+        size_t link;
+        for (link = 0; link < links; link++) {
+            angle += joints[link] + parameters[links + link];
+            x += parameters[link] * cos(angle);
+            y += parameters[link] * sin(angle);
+        }
+    }
+
+    bool EvaluateBlock(size_t block, const vctDynamicVector<double> & parameters,
+                       vctDynamicVectorRef<double> & residual,
+                       vctDynamicMatrixRef<double> & jacobian) const {
+        const size_t links = Joints.cols();
+        std::vector<double> xBefore(links), yBefore(links);
+        double angle = 0.0, x = 0.0, y = 0.0;
+        size_t link;
+        for (link = 0; link < links; link++) {
+            xBefore[link] = x;
+            yBefore[link] = y;
+            angle += Joints.Element(block, link) + parameters[links + link];
+            const double c = cos(angle);
+            const double s = sin(angle);
+            x += parameters[link] * c;
+            y += parameters[link] * s;
+            jacobian.Element(0, link) = c;
+            jacobian.Element(1, link) = s;
+        }
+        // an offset rotates all the following links
+        for (link = 0; link < links; link++) {
+            jacobian.Element(0, links + link) = -(y - yBefore[link]);
+            jacobian.Element(1, links + link) = x - xBefore[link];
+        }
+        residual[0] = x - Positions.Element(block, 0);
+        residual[1] = y - Positions.Element(block, 1);
+        return true;
+    }
+};
+
+
+// groups of samples a_g exp(-k t), parameters are k followed by the
+// amplitudes
+class nmrLSNonLinBlockSolverTestDecay: public nmrLSNonLinBlockSolver::Problem
+{
+public:
+    std::vector<size_t> Groups;
+    std::vector<double> Times;
+    std::vector<double> Values;
+
+    bool EvaluateBlock(size_t block, const vctDynamicVector<double> & parameters,
+                       vctDynamicVectorRef<double> & residual,
+                       vctDynamicMatrixRef<double> & jacobian) const {
+        // columns are in the order used for AddBlock, amplitude first
+        const double amplitude = parameters[1 + Groups[block]];
+        const double decay = exp(-parameters[0] * Times[block]);
+        residual[0] = amplitude * decay - Values[block];
+        jacobian.Element(0, 0) = decay;
+        jacobian.Element(0, 1) = -Times[block] * amplitude * decay;
+        return true;
+    }
+};
+
+
+// log(x) - log(4), not defined for x <= 0
+class nmrLSNonLinBlockSolverTestLog: public nmrLSNonLinBlockSolver::Problem
+{
+public:
+    bool EvaluateBlock(size_t CMN_UNUSED(block), const vctDynamicVector<double> & parameters,
+                       vctDynamicVectorRef<double> & residual,
+                       vctDynamicMatrixRef<double> & jacobian) const {
+        if (parameters[0] <= 0.0) {
+            return false;
+        }
+        residual[0] = log(parameters[0]) - log(4.0);
+        jacobian.Element(0, 0) = 1.0 / parameters[0];
+        return true;
+    }
+};
+
+
+void nmrLSNonLinBlockSolverTest::TestRosenbrock(void)
+{
+    nmrLSNonLinBlockSolverTestRosenbrock problem;
+    nmrLSNonLinBlockSolver solver(2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), solver.AddBlock(2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), solver.GetNumberOfResiduals());
+    vctDynamicVector<double> parameters(2, -1.2, 1.0);
+    CPPUNIT_ASSERT(solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT(solver.GetTermination() != nmrLSNonLinBlockSolver::MAX_ITERATIONS);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(24.2, solver.GetInitialCost(), 1e-12);
+    CPPUNIT_ASSERT(solver.GetCost() < 1e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, parameters[0], 1e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, parameters[1], 1e-6);
+}
+
+
+void nmrLSNonLinBlockSolverTest::TestCalibration(void)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    const size_t links = 6;
+    const size_t poses = 500;
+    vctDynamicVector<double> actual(2 * links);
+    size_t link, pose;
+    for (link = 0; link < links; link++) {
+        actual[link] = 0.5 - 0.05 * static_cast<double>(link) + randomSequence.ExtractRandomDouble(-0.01, 0.01);
+        actual[links + link] = randomSequence.ExtractRandomDouble(-0.05, 0.05);
+    }
+
+    nmrLSNonLinBlockSolverTestArm problem;
+    problem.Joints.SetSize(poses, links);
+    problem.Positions.SetSize(poses, 2);
+    nmrLSNonLinBlockSolver solver(2 * links);
+    for (pose = 0; pose < poses; pose++) {
+        for (link = 0; link < links; link++) {
+            problem.Joints.Element(pose, link) = randomSequence.ExtractRandomDouble(-1.5, 1.5);
+        }
+        nmrLSNonLinBlockSolverTestArm::Forward(actual, problem.Joints.Row(pose),
+                                               problem.Positions.Element(pose, 0),
+                                               problem.Positions.Element(pose, 1));
+        CPPUNIT_ASSERT_EQUAL(pose, solver.AddBlock(2));
+    }
+    CPPUNIT_ASSERT_EQUAL(poses, solver.GetNumberOfBlocks());
+    CPPUNIT_ASSERT_EQUAL(2 * poses, solver.GetNumberOfResiduals());
+
+    // start from the nominal lengths without offsets
+    vctDynamicVector<double> parameters(2 * links, 0.0);
+    for (link = 0; link < links; link++) {
+        parameters[link] = 0.5 - 0.05 * static_cast<double>(link);
+    }
+    CPPUNIT_ASSERT(solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT(solver.GetTermination() != nmrLSNonLinBlockSolver::MAX_ITERATIONS);
+    CPPUNIT_ASSERT(solver.GetInitialCost() > 1e-4);
+    CPPUNIT_ASSERT(solver.GetCost() < 1e-20);
+    CPPUNIT_ASSERT(parameters.AlmostEqual(actual, 1e-8));
+
+    // J^T J at the solution, compare one element with the Jacobian
+    vctDynamicVector<double> residual(2);
+    vctDynamicMatrix<double> jacobian(2, 2 * links, VCT_ROW_MAJOR);
+    double sum = 0.0;
+    for (pose = 0; pose < poses; pose++) {
+        vctDynamicVectorRef<double> residualRef(residual);
+        vctDynamicMatrixRef<double> jacobianRef(jacobian);
+        problem.EvaluateBlock(pose, parameters, residualRef, jacobianRef);
+        sum += jacobian.Column(1).DotProduct(jacobian.Column(links + 2));
+    }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sum, solver.GetNormalMatrix().Element(1, links + 2), 1e-9);
+
+    // solve again with noisy measurements, the cost can't be zero
+    for (pose = 0; pose < poses; pose++) {
+        problem.Positions.Element(pose, 0) += randomSequence.ExtractRandomDouble(-1e-4, 1e-4);
+        problem.Positions.Element(pose, 1) += randomSequence.ExtractRandomDouble(-1e-4, 1e-4);
+    }
+    CPPUNIT_ASSERT(solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT(solver.GetTermination() != nmrLSNonLinBlockSolver::MAX_ITERATIONS);
+    CPPUNIT_ASSERT(solver.GetCost() > 0.0);
+    CPPUNIT_ASSERT(parameters.AlmostEqual(actual, 1e-4));
+}
+
+
+void nmrLSNonLinBlockSolverTest::TestSparseBlocks(void)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    const size_t groups = 20;
+    const size_t samples = 30;
+    const double rate = 1.5;
+    vctDynamicVector<double> amplitudes(groups);
+    size_t group, sample;
+    for (group = 0; group < groups; group++) {
+        amplitudes[group] = randomSequence.ExtractRandomDouble(1.0, 5.0);
+    }
+
+    nmrLSNonLinBlockSolverTestDecay problem;
+    nmrLSNonLinBlockSolver solver(1 + groups);
+    std::vector<size_t> indices(2);
+    for (group = 0; group < groups; group++) {
+        for (sample = 0; sample < samples; sample++) {
+            const double time = 0.1 * static_cast<double>(sample);
+            problem.Groups.push_back(group);
+            problem.Times.push_back(time);
+            problem.Values.push_back(amplitudes[group] * exp(-rate * time));
+            // amplitude first to test indices not sorted
+            indices[0] = 1 + group;
+            indices[1] = 0;
+            solver.AddBlock(1, indices);
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(groups * samples, solver.GetNumberOfResiduals());
+
+    vctDynamicVector<double> parameters(1 + groups, 1.0);
+    CPPUNIT_ASSERT(solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT(solver.GetTermination() != nmrLSNonLinBlockSolver::MAX_ITERATIONS);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(rate, parameters[0], 1e-8);
+    for (group = 0; group < groups; group++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(amplitudes[group], parameters[1 + group], 1e-8);
+    }
+    // amplitudes of different groups are independent
+    CPPUNIT_ASSERT_EQUAL(0.0, solver.GetNormalMatrix().Element(1, 2));
+    CPPUNIT_ASSERT(solver.GetNormalMatrix().Element(0, 1) != 0.0);
+}
+
+
+void nmrLSNonLinBlockSolverTest::TestInvalidResiduals(void)
+{
+    nmrLSNonLinBlockSolverTestLog problem;
+    nmrLSNonLinBlockSolver solver(1);
+    solver.AddBlock(1);
+    // first Gauss-Newton step leads to a negative value, step is rejected
+    vctDynamicVector<double> parameters(1, 100.0);
+    solver.SetInitialDamping(1e-6);
+    CPPUNIT_ASSERT(solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0, parameters[0], 1e-8);
+
+    // can't evaluate initial parameters
+    parameters[0] = -1.0;
+    CPPUNIT_ASSERT(!solver.Solve(problem, parameters));
+    CPPUNIT_ASSERT_EQUAL(nmrLSNonLinBlockSolver::FAILED, solver.GetTermination());
+    CPPUNIT_ASSERT_EQUAL(-1.0, parameters[0]);
+}
+
+
+void nmrLSNonLinBlockSolverTest::TestErrors(void)
+{
+    nmrLSNonLinBlockSolver solver(3);
+    std::vector<size_t> indices(2);
+    bool exceptionReceived = false;
+    indices[0] = 0;
+    indices[1] = 3;
+    try {
+        solver.AddBlock(1, indices);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+
+    exceptionReceived = false;
+    indices[1] = 0;
+    try {
+        solver.AddBlock(1, indices);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), solver.GetNumberOfBlocks());
+
+    // no block
+    nmrLSNonLinBlockSolverTestRosenbrock problem;
+    vctDynamicVector<double> parameters(3, 0.0);
+    CPPUNIT_ASSERT(!solver.Solve(problem, parameters));
+
+    exceptionReceived = false;
+    solver.SetNumberOfParameters(2);
+    solver.AddBlock(2);
+    try {
+        solver.Solve(problem, parameters);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+}
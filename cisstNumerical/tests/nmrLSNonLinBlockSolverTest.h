@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrLSNonLinBlockSolverTest_h
+#define _nmrLSNonLinBlockSolverTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstNumerical/nmrLSNonLinBlockSolver.h>
+
+class nmrLSNonLinBlockSolverTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrLSNonLinBlockSolverTest);
+
+    CPPUNIT_TEST(TestRosenbrock);
+    CPPUNIT_TEST(TestCalibration);
+    CPPUNIT_TEST(TestSparseBlocks);
+    CPPUNIT_TEST(TestInvalidResiduals);
+    CPPUNIT_TEST(TestErrors);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Rosenbrock function as a single block */
+    void TestRosenbrock(void);
+
+    /*! Kinematic calibration of a planar arm, one block per pose */
+    void TestCalibration(void);
+
+    /*! Blocks depending on a subset of the parameters */
+    void TestSparseBlocks(void);
+
+    /*! Residuals can't be evaluated for some parameters */
+    void TestInvalidResiduals(void);
+
+    /*! Invalid blocks and parameters */
+    void TestErrors(void);
+};
+
+#endif // _nmrLSNonLinBlockSolverTest_h
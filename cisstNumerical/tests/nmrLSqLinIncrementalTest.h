@@ -0,0 +1,79 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrLSqLinIncrementalTest_h
+#define _nmrLSqLinIncrementalTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstNumerical/nmrLSqLinIncremental.h>
+
+class nmrLSqLinIncrementalTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrLSqLinIncrementalTest);
+
+    CPPUNIT_TEST(TestLS);
+    CPPUNIT_TEST(TestLSI);
+    CPPUNIT_TEST(TestLSEI);
+    CPPUNIT_TEST(TestRowUpdates);
+    CPPUNIT_TEST(TestWarmStart);
+    CPPUNIT_TEST(TestMaxIterations);
+    CPPUNIT_TEST(TestContradictions);
+
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    vctDoubleMat InputA, InputE, InputG;
+    vctDoubleVec Inputb, Inputf, Inputh;
+    vctDoubleVec OutputXLS, OutputXLSI, OutputXLSEI;
+
+    //! Same problems as nmrLSqLinTest, solved with lsei
+    void SetUpProblem(bool small);
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Compare to the solutions computed by nmrLSqLin */
+    void TestLS(void);
+    void TestLSI(void);
+    void TestLSEI(void);
+
+    /*! Replace rows of the objective and compare to the solution
+      computed from scratch */
+    void TestRowUpdates(void);
+
+    /*! Solve again after small changes, the active set should not
+      change */
+    void TestWarmStart(void);
+
+    /*! Fallback to the previous solution when the number of
+      iterations is limited */
+    void TestMaxIterations(void);
+
+    /*! Rank deficient objective and contradictory constraints */
+    void TestContradictions(void);
+};
+
+#endif // _nmrLSqLinIncrementalTest_h
@@ -0,0 +1,186 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "nmrPolynomialHornerEvaluatorTest.h"
+
+#include <cisstCommon/cmnRandomSequence.h>
+#include <cisstNumerical/nmrStandardPolynomial.h>
+#include <cisstNumerical/nmrBernsteinPolynomial.h>
+
+#include <math.h>
+
+
+void nmrPolynomialHornerEvaluatorTest::SetRandomCoefficients(nmrDynAllocPolynomialContainer & polynomial)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    nmrPolynomialTermPowerIndex index(polynomial);
+    index.GoBegin();
+    while (index.IsValid()) {
+        polynomial.SetCoefficient(index, randomSequence.ExtractRandomDouble(-1.0, 1.0));
+        index.Increment();
+    }
+}
+
+
+void nmrPolynomialHornerEvaluatorTest::Compare(const nmrDynAllocPolynomialContainer & polynomial,
+                                               nmrMultiVariablePowerBasis & basis, bool barycentric)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    nmrPolynomialHornerEvaluator evaluator(polynomial);
+    const int numVariables = polynomial.GetNumVariables();
+    CPPUNIT_ASSERT_EQUAL(numVariables, evaluator.GetNumVariables());
+
+    // more points than a block, last block incomplete
+    const size_t numberOfPoints = 3 * nmrPolynomialHornerEvaluator::BLOCK_SIZE + 7;
+    vctDynamicMatrix<double> points(numVariables, numberOfPoints);
+    vctDynamicVector<double> values(numberOfPoints);
+    vctDynamicVector<double> expected(numberOfPoints);
+    vctDynamicVector<double> variables(numVariables);
+    size_t point;
+    int variable;
+    for (point = 0; point < numberOfPoints; point++) {
+        for (variable = 0; variable < numVariables; variable++) {
+            variables[variable] = randomSequence.ExtractRandomDouble(-1.5, 1.5);
+        }
+        if (barycentric) {
+            // last variable is implicit
+            variables[numVariables - 1] = 0.0;
+            variables[numVariables - 1] = 1.0 - variables.SumOfElements();
+        }
+        points.Column(point).Assign(variables);
+        basis.SetVariables(variables.Pointer());
+        expected[point] = polynomial.Evaluate(basis);
+    }
+    evaluator.Evaluate(points, values);
+    const double tolerance = 1e-9 * (1.0 + expected.MaxAbsElement());
+    CPPUNIT_ASSERT(expected.AlmostEqual(values, tolerance));
+
+    // one point at a time
+    for (point = 0; point < numberOfPoints; point += 13) {
+        variables.Assign(points.Column(point));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[point], evaluator.Evaluate(variables.Pointer()), tolerance);
+    }
+
+    // column major storage, one row per point
+    vctDynamicMatrix<double> transposed(numberOfPoints, numVariables, VCT_COL_MAJOR);
+    transposed.Assign(points.TransposeRef());
+    values.SetAll(0.0);
+    evaluator.Evaluate(transposed.TransposeRef(), values);
+    CPPUNIT_ASSERT(expected.AlmostEqual(values, tolerance));
+}
+
+
+void nmrPolynomialHornerEvaluatorTest::TestStandard(void)
+{
+    int numVariables, degree;
+    for (numVariables = 1; numVariables <= 4; numVariables++) {
+        for (degree = 0; degree <= 5; degree++) {
+            nmrStandardPolynomial polynomial(numVariables, 0, degree);
+            nmrMultiVariablePowerBasis::StandardPowerBasis basis(numVariables, degree);
+            SetRandomCoefficients(polynomial);
+            Compare(polynomial, basis, false);
+        }
+    }
+    // without the low degree terms
+    nmrStandardPolynomial polynomial(3, 2, 4);
+    nmrMultiVariablePowerBasis::StandardPowerBasis basis(3, 4);
+    SetRandomCoefficients(polynomial);
+    Compare(polynomial, basis, false);
+}
+
+
+void nmrPolynomialHornerEvaluatorTest::TestBernstein(void)
+{
+    int numVariables, degree;
+    for (numVariables = 2; numVariables <= 4; numVariables++) {
+        for (degree = 1; degree <= 5; degree++) {
+            nmrBernsteinPolynomial polynomial(numVariables, degree);
+            nmrMultiVariablePowerBasis::BarycentricBasis basis(numVariables, degree, numVariables - 1);
+            SetRandomCoefficients(polynomial);
+            Compare(polynomial, basis, true);
+        }
+    }
+}
+
+
+void nmrPolynomialHornerEvaluatorTest::TestSparse(void)
+{
+    // p(x, y, z) = 2 + 3 x^5 - y^3 z + 0.5 x^2 z^4
+    nmrStandardPolynomial polynomial(3, 0, 6);
+    nmrPolynomialTermPowerIndex index(polynomial);
+    index.SetDegree(0);
+    polynomial.SetCoefficient(index, 2.0);
+    index.SetPower(0, 5);
+    polynomial.SetCoefficient(index, 3.0);
+    index.SetDegree(0);
+    index.SetPower(1, 3);
+    index.SetPower(2, 1);
+    polynomial.SetCoefficient(index, -1.0);
+    index.SetDegree(0);
+    index.SetPower(0, 2);
+    index.SetPower(2, 4);
+    polynomial.SetCoefficient(index, 0.5);
+    CPPUNIT_ASSERT_EQUAL(4, static_cast<int>(polynomial.GetNumberOfTerms()));
+
+    nmrPolynomialHornerEvaluator evaluator(polynomial);
+    const double variables[3] = {1.5, -0.5, 2.0};
+    const double x = variables[0], y = variables[1], z = variables[2];
+    const double expected = 2.0 + 3.0 * pow(x, 5) - pow(y, 3) * z + 0.5 * x * x * pow(z, 4);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected, evaluator.Evaluate(variables), 1e-12);
+
+    nmrMultiVariablePowerBasis::StandardPowerBasis basis(3, 6);
+    Compare(polynomial, basis, false);
+}
+
+
+void nmrPolynomialHornerEvaluatorTest::TestSizes(void)
+{
+    // default and empty polynomials evaluate to zero
+    nmrPolynomialHornerEvaluator evaluator;
+    CPPUNIT_ASSERT_EQUAL(0.0, evaluator.Evaluate(0));
+    nmrStandardPolynomial polynomial(2, 0, 3);
+    evaluator.Compile(polynomial);
+    const double variables[2] = {1.0, 2.0};
+    CPPUNIT_ASSERT_EQUAL(0.0, evaluator.Evaluate(variables));
+
+    vctDynamicMatrix<double> points(3, 10);
+    vctDynamicVector<double> values(10);
+    bool exceptionReceived = false;
+    try {
+        evaluator.Evaluate(points, values);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+
+    points.SetSize(2, 10);
+    values.SetSize(9);
+    exceptionReceived = false;
+    try {
+        evaluator.Evaluate(points, values);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(nmrPolynomialHornerEvaluatorTest);
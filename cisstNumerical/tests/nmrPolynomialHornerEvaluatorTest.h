@@ -0,0 +1,70 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrPolynomialHornerEvaluatorTest_h
+#define _nmrPolynomialHornerEvaluatorTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstNumerical/nmrPolynomialHornerEvaluator.h>
+#include <cisstNumerical/nmrMultiVariablePowerBasis.h>
+
+class nmrPolynomialHornerEvaluatorTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrPolynomialHornerEvaluatorTest);
+
+    CPPUNIT_TEST(TestStandard);
+    CPPUNIT_TEST(TestBernstein);
+    CPPUNIT_TEST(TestSparse);
+    CPPUNIT_TEST(TestSizes);
+
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    /*! Set random coefficients for all the terms of the polynomial */
+    void SetRandomCoefficients(nmrDynAllocPolynomialContainer & polynomial);
+
+    /*! Compare the evaluator with the polynomial at random points */
+    void Compare(const nmrDynAllocPolynomialContainer & polynomial,
+                 nmrMultiVariablePowerBasis & basis, bool barycentric);
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Random polynomials in standard basis */
+    void TestStandard(void);
+
+    /*! Random polynomials in Bernstein basis */
+    void TestBernstein(void);
+
+    /*! Polynomial with few terms and gaps between the powers */
+    void TestSparse(void);
+
+    /*! Empty polynomial and size mismatch */
+    void TestSizes(void);
+};
+
+#endif // _nmrPolynomialHornerEvaluatorTest_h
@@ -0,0 +1,298 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "nmrRegistrationICPTest.h"
+
+#include <cisstCommon/cmnRandomSequence.h>
+#include <cisstVector/vctRandomFixedSizeVector.h>
+#include <cisstNumerical/nmrKdTree.h>
+
+#include <math.h>
+
+
+void nmrRegistrationICPTest::MakeModel(vctDynamicVector<vct3> & model)
+{
+    // bumpy ellipsoid
+    const size_t latitudes = 60;
+    const size_t longitudes = 100;
+    model.SetSize(latitudes * longitudes);
+    size_t latitude, longitude;
+    for (latitude = 0; latitude < latitudes; latitude++) {
+        const double theta = cmnPI * (static_cast<double>(latitude) + 0.5) / static_cast<double>(latitudes);
+        for (longitude = 0; longitude < longitudes; longitude++) {
+            const double phi = 2.0 * cmnPI * static_cast<double>(longitude) / static_cast<double>(longitudes);
+            const double radius = 10.0 + 1.5 * sin(3.0 * theta) * cos(2.0 * phi);
+            model[latitude * longitudes + longitude].Assign(1.5 * radius * sin(theta) * cos(phi),
+                                                            radius * sin(theta) * sin(phi),
+                                                            0.8 * radius * cos(theta));
+        }
+    }
+}
+
+
+void nmrRegistrationICPTest::MakeData(const vctDynamicVector<vct3> & model, const vctFrm3 & transform,
+                                      vctDynamicVector<vct3> & data)
+{
+    const vctFrm3 inverse(transform.Inverse());
+    const size_t size = model.size() / 3;
+    data.SetSize(size);
+    size_t index;
+    for (index = 0; index < size; index++) {
+        inverse.ApplyTo(model[3 * index + 1], data[index]);
+    }
+}
+
+
+void nmrRegistrationICPTest::RandomTransform(vctFrm3 & transform)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    vct3 axis;
+    vctRandom(axis, -1.0, 1.0);
+    axis.NormalizedSelf();
+    const double angle = randomSequence.ExtractRandomDouble(-1.0, 1.0) * cmnPI_180;
+    transform.Rotation().From(vctAxAnRot3(axis, angle));
+    vctRandom(transform.Translation(), -0.3, 0.3);
+}
+
+
+void nmrRegistrationICPTest::CheckTransform(const vctFrm3 & expected, const vctFrm3 & result, double tolerance)
+{
+    CPPUNIT_ASSERT((expected.Rotation() - result.Rotation()).LinfNorm() < tolerance);
+    CPPUNIT_ASSERT((expected.Translation() - result.Translation()).LinfNorm() < tolerance);
+}
+
+
+void nmrRegistrationICPTest::TestKdTree(void)
+{
+    vctDynamicVector<vct3> points(2000);
+    size_t index;
+    for (index = 0; index < points.size(); index++) {
+        vctRandom(points[index], -10.0, 10.0);
+    }
+    nmrKdTree tree;
+    tree.Build(points);
+    CPPUNIT_ASSERT_EQUAL(points.size(), tree.size());
+
+    vct3 query;
+    size_t result, expected, other;
+    double distanceSquared, expectedDistanceSquared;
+    unsigned int iteration;
+    for (iteration = 0; iteration < 200; iteration++) {
+        vctRandom(query, -12.0, 12.0);
+        expected = 0;
+        expectedDistanceSquared = (points[0] - query).NormSquare();
+        for (other = 1; other < points.size(); other++) {
+            const double d2 = (points[other] - query).NormSquare();
+            if (d2 < expectedDistanceSquared) {
+                expectedDistanceSquared = d2;
+                expected = other;
+            }
+        }
+        CPPUNIT_ASSERT(tree.FindNearest(query, result, distanceSquared));
+        CPPUNIT_ASSERT_EQUAL(expected, result);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDistanceSquared, distanceSquared, cmnTypeTraits<double>::Tolerance());
+        CPPUNIT_ASSERT(tree.Point(result).Equal(points[expected]));
+    }
+
+    // query the points of the tree
+    for (index = 0; index < points.size(); index++) {
+        CPPUNIT_ASSERT(tree.FindNearest(points[index], result, distanceSquared));
+        CPPUNIT_ASSERT_EQUAL(index, result);
+        CPPUNIT_ASSERT_EQUAL(0.0, distanceSquared);
+    }
+
+    // empty tree
+    vctDynamicVector<vct3> empty;
+    tree.Build(empty);
+    CPPUNIT_ASSERT(!tree.FindNearest(query, result, distanceSquared));
+}
+
+
+void nmrRegistrationICPTest::TestKdTreeHintAndMaxDistance(void)
+{
+    cmnRandomSequence & randomSequence = cmnRandomSequence::GetInstance();
+    vctDynamicVector<vct3> points(1000);
+    size_t index;
+    for (index = 0; index < points.size(); index++) {
+        vctRandom(points[index], -10.0, 10.0);
+    }
+    nmrKdTree tree;
+    tree.Build(points);
+
+    vct3 query;
+    size_t result, expected, other, hint;
+    double distanceSquared, expectedDistanceSquared;
+    unsigned int iteration;
+    for (iteration = 0; iteration < 200; iteration++) {
+        vctRandom(query, -12.0, 12.0);
+        expected = 0;
+        expectedDistanceSquared = (points[0] - query).NormSquare();
+        for (other = 1; other < points.size(); other++) {
+            const double d2 = (points[other] - query).NormSquare();
+            if (d2 < expectedDistanceSquared) {
+                expectedDistanceSquared = d2;
+                expected = other;
+            }
+        }
+        // any hint gives the same result
+        hint = static_cast<size_t>(randomSequence.ExtractRandomInt(0, static_cast<int>(points.size())));
+        CPPUNIT_ASSERT(tree.FindNearest(query, result, distanceSquared,
+                                        cmnTypeTraits<double>::MaxPositiveValue(), hint));
+        CPPUNIT_ASSERT_EQUAL(expected, result);
+        CPPUNIT_ASSERT(tree.FindNearest(query, result, distanceSquared,
+                                        cmnTypeTraits<double>::MaxPositiveValue(), expected));
+        CPPUNIT_ASSERT_EQUAL(expected, result);
+
+        // maximum distance, result and distance are not modified if no point is found
+        const double maxDistanceSquared = randomSequence.ExtractRandomDouble(0.0, 2.0);
+        result = points.size();
+        distanceSquared = -1.0;
+        if (expectedDistanceSquared < maxDistanceSquared) {
+            CPPUNIT_ASSERT(tree.FindNearest(query, result, distanceSquared, maxDistanceSquared, hint));
+            CPPUNIT_ASSERT_EQUAL(expected, result);
+        } else {
+            CPPUNIT_ASSERT(!tree.FindNearest(query, result, distanceSquared, maxDistanceSquared, hint));
+            CPPUNIT_ASSERT_EQUAL(points.size(), result);
+            CPPUNIT_ASSERT_EQUAL(-1.0, distanceSquared);
+        }
+    }
+}
+
+
+void nmrRegistrationICPTest::TestRegistration(void)
+{
+    vctDynamicVector<vct3> model, data;
+    MakeModel(model);
+    nmrRegistrationICP icp;
+    icp.SetModel(model);
+    vctFrm3 expected, result;
+    unsigned int iteration;
+    for (iteration = 0; iteration < 10; iteration++) {
+        RandomTransform(expected);
+        MakeData(model, expected, data);
+        result = vctFrm3::Identity();
+        CPPUNIT_ASSERT(icp.Register(data, result));
+        CPPUNIT_ASSERT(icp.HasConverged());
+        CPPUNIT_ASSERT(icp.GetRMS() < 1e-6);
+        CPPUNIT_ASSERT_EQUAL(data.size(), icp.GetNumberOfInliers());
+        CPPUNIT_ASSERT_EQUAL(data.size(), icp.GetCorrespondences().size());
+        CheckTransform(expected, result, 1e-6);
+    }
+
+    // not enough points
+    data.SetSize(2);
+    CPPUNIT_ASSERT(!icp.Register(data, result));
+
+    // no model
+    nmrRegistrationICP noModel;
+    MakeData(model, expected, data);
+    CPPUNIT_ASSERT(!noModel.Register(data, result));
+}
+
+
+void nmrRegistrationICPTest::TestTrimmed(void)
+{
+    vctDynamicVector<vct3> model, data;
+    MakeModel(model);
+    nmrRegistrationICP icp;
+    icp.SetModel(model);
+    icp.SetTrimRatio(0.85);
+    vctFrm3 expected, result;
+    size_t index;
+    unsigned int iteration;
+    for (iteration = 0; iteration < 10; iteration++) {
+        RandomTransform(expected);
+        MakeData(model, expected, data);
+        // 10% outliers, moved away from the surface
+        for (index = 0; index < data.size(); index += 10) {
+            data[index].Multiply(1.5);
+        }
+        result = vctFrm3::Identity();
+        CPPUNIT_ASSERT(icp.Register(data, result));
+        CPPUNIT_ASSERT(icp.GetRMS() < 1e-6);
+        CheckTransform(expected, result, 1e-6);
+    }
+}
+
+
+void nmrRegistrationICPTest::TestRobustWeighting(void)
+{
+    vctDynamicVector<vct3> model, data;
+    MakeModel(model);
+    nmrRegistrationICP icp;
+    icp.SetModel(model);
+    icp.SetWeighting(nmrRegistrationICP::WEIGHT_TUKEY);
+    vctFrm3 expected, result;
+    size_t index;
+    unsigned int iteration;
+    for (iteration = 0; iteration < 10; iteration++) {
+        RandomTransform(expected);
+        MakeData(model, expected, data);
+        for (index = 0; index < data.size(); index += 10) {
+            data[index].Multiply(1.5);
+        }
+        result = vctFrm3::Identity();
+        CPPUNIT_ASSERT(icp.Register(data, result));
+        CPPUNIT_ASSERT(icp.GetNumberOfInliers() < data.size());
+        CheckTransform(expected, result, 1e-6);
+    }
+
+    // outliers are rejected by the maximum distance
+    icp.SetWeighting(nmrRegistrationICP::WEIGHT_NONE);
+    icp.SetMaxDistance(3.0);
+    RandomTransform(expected);
+    MakeData(model, expected, data);
+    for (index = 0; index < data.size(); index += 10) {
+        data[index].Multiply(1.5);
+    }
+    result = vctFrm3::Identity();
+    CPPUNIT_ASSERT(icp.Register(data, result));
+    CheckTransform(expected, result, 1e-6);
+}
+
+
+void nmrRegistrationICPTest::TestReuse(void)
+{
+    vctDynamicVector<vct3> model, data;
+    MakeModel(model);
+    nmrRegistrationICP icp;
+    icp.SetModel(model);
+    // slow motion, each frame starts from the previous result
+    vctFrm3 expected, result, motion;
+    RandomTransform(expected);
+    vctAxAnRot3 axisAngle(vct3(0.0, 0.0, 1.0), 0.5 * cmnPI_180);
+    motion.Rotation().From(axisAngle);
+    motion.Translation().Assign(0.1, -0.1, 0.05);
+    result = vctFrm3::Identity();
+    unsigned int frame;
+    for (frame = 0; frame < 10; frame++) {
+        MakeData(model, expected, data);
+        CPPUNIT_ASSERT(icp.Register(data, result));
+        CheckTransform(expected, result, 1e-6);
+        if (frame > 0) {
+            CPPUNIT_ASSERT(icp.GetNumberOfIterations() < 20);
+        }
+        expected = motion * expected;
+    }
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(nmrRegistrationICPTest);
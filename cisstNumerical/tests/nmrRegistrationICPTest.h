@@ -0,0 +1,82 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrRegistrationICPTest_h
+#define _nmrRegistrationICPTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstVector/vctTransformationTypes.h>
+#include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstNumerical/nmrRegistrationICP.h>
+
+class nmrRegistrationICPTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrRegistrationICPTest);
+
+    CPPUNIT_TEST(TestKdTree);
+    CPPUNIT_TEST(TestKdTreeHintAndMaxDistance);
+    CPPUNIT_TEST(TestRegistration);
+    CPPUNIT_TEST(TestTrimmed);
+    CPPUNIT_TEST(TestRobustWeighting);
+    CPPUNIT_TEST(TestReuse);
+
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    /*! Sample a smooth non symmetric surface */
+    void MakeModel(vctDynamicVector<vct3> & model);
+
+    /*! Data points are a subset of the model, moved by the inverse of
+      transform */
+    void MakeData(const vctDynamicVector<vct3> & model, const vctFrm3 & transform,
+                  vctDynamicVector<vct3> & data);
+
+    /*! Random transformation with a small rotation and translation */
+    void RandomTransform(vctFrm3 & transform);
+
+    /*! Compare the rotations and translations */
+    void CheckTransform(const vctFrm3 & expected, const vctFrm3 & result, double tolerance);
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Compare kd-tree queries with brute force */
+    void TestKdTree(void);
+    void TestKdTreeHintAndMaxDistance(void);
+
+    /*! Recover a known transformation */
+    void TestRegistration(void);
+
+    /*! Recover a known transformation with outliers */
+    void TestTrimmed(void);
+    void TestRobustWeighting(void);
+
+    /*! Same model and object for consecutive frames */
+    void TestReuse(void);
+};
+
+#endif // _nmrRegistrationICPTest_h
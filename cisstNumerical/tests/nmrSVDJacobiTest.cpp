@@ -0,0 +1,184 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "nmrSVDJacobiTest.h"
+
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <cisstVector/vctFixedSizeMatrixTypes.h>
+#include <cisstVector/vctRandomFixedSizeVector.h>
+#include <cisstVector/vctRandomFixedSizeMatrix.h>
+#include <cisstNumerical/nmrIsOrthonormal.h>
+
+#if CISST_HAS_CISSTNETLIB
+#include <cisstNumerical/nmrSVD.h>
+#endif
+
+
+template <class _elementType, vct::size_type _size, bool _storageOrder>
+void nmrSVDJacobiTest::CheckSVD(const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & A,
+                                const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & U,
+                                const vctFixedSizeVector<_elementType, _size> & S,
+                                const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & Vt,
+                                _elementType tolerance)
+{
+    vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> US(U), product;
+    vct::size_type index;
+    for (index = 0; index < _size; index++) {
+        US.Column(index).Multiply(S[index]);
+    }
+    product.ProductOf(US, Vt);
+    CPPUNIT_ASSERT((A - product).LinfNorm() < tolerance);
+    CPPUNIT_ASSERT(nmrIsOrthonormal(U, tolerance));
+    CPPUNIT_ASSERT(nmrIsOrthonormal(Vt, tolerance));
+    for (index = 1; index < _size; index++) {
+        CPPUNIT_ASSERT(S[index - 1] >= S[index]);
+    }
+    CPPUNIT_ASSERT(S[_size - 1] >= _elementType(0));
+}
+
+
+template <class _elementType, vct::size_type _size, bool _storageOrder>
+void nmrSVDJacobiTest::TestRandom(_elementType tolerance)
+{
+    vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> A, U, Vt;
+    vctFixedSizeVector<_elementType, _size> S;
+    for (unsigned int iteration = 0; iteration < 20; iteration++) {
+        vctRandom(A, _elementType(-10), _elementType(10));
+        CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobi(A, U, S, Vt));
+        CheckSVD(A, U, S, Vt, tolerance);
+    }
+}
+
+
+void nmrSVDJacobiTest::TestSVD3x3(void)
+{
+    TestRandom<double, 3, VCT_ROW_MAJOR>(cmnTypeTraits<double>::Tolerance());
+}
+
+
+void nmrSVDJacobiTest::TestSVD4x4ColumnMajor(void)
+{
+    TestRandom<double, 4, VCT_COL_MAJOR>(cmnTypeTraits<double>::Tolerance());
+}
+
+
+void nmrSVDJacobiTest::TestSVD6x6(void)
+{
+    TestRandom<double, 6, VCT_ROW_MAJOR>(cmnTypeTraits<double>::Tolerance());
+}
+
+
+void nmrSVDJacobiTest::TestSVD3x3Float(void)
+{
+    TestRandom<float, 3, VCT_ROW_MAJOR>(100.0f * cmnTypeTraits<float>::Tolerance());
+}
+
+
+void nmrSVDJacobiTest::TestRankDeficient(void)
+{
+    const double tolerance = cmnTypeTraits<double>::Tolerance();
+    vctDouble3x3 A, U, Vt;
+    vctDouble3 S;
+
+    // zero matrix
+    A.SetAll(0.0);
+    CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobi(A, U, S, Vt));
+    CheckSVD(A, U, S, Vt, tolerance);
+    CPPUNIT_ASSERT(S.Equal(0.0));
+
+    // rank 1, outer product
+    vctDouble3 u, v;
+    vctRandom(u, -1.0, 1.0);
+    vctRandom(v, -1.0, 1.0);
+    A.OuterProductOf(u, v);
+    CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobi(A, U, S, Vt));
+    CheckSVD(A, U, S, Vt, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(u.Norm() * v.Norm(), S[0], tolerance);
+    CPPUNIT_ASSERT(S[1] < tolerance);
+
+    // rank 5 6x6, last row is a combination of the others
+    vctFixedSizeMatrix<double, 6, 6> A6, U6, Vt6;
+    vctFixedSizeVector<double, 6> S6;
+    vctRandom(A6, -10.0, 10.0);
+    A6.Row(5).SumOf(A6.Row(0), A6.Row(1));
+    CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobi(A6, U6, S6, Vt6));
+    CheckSVD(A6, U6, S6, Vt6, tolerance);
+    CPPUNIT_ASSERT(S6[5] < tolerance);
+}
+
+
+void nmrSVDJacobiTest::TestBatch(void)
+{
+    enum {COUNT = 11};
+    vctDouble3x3 A[COUNT], U[COUNT], Vt[COUNT], USingle, VtSingle;
+    vctDouble3 S[COUNT], SSingle;
+    size_t index;
+    for (index = 0; index < COUNT; index++) {
+        vctRandom(A[index], -10.0, 10.0);
+    }
+    // rank deficient problem in the batch
+    A[5].Column(2).SetAll(0.0);
+
+    CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobiBatch(COUNT, A, U, S, Vt));
+
+    for (index = 0; index < COUNT; index++) {
+        CheckSVD(A[index], U[index], S[index], Vt[index], cmnTypeTraits<double>::Tolerance());
+        nmrSVDJacobi(A[index], USingle, SSingle, VtSingle);
+        CPPUNIT_ASSERT(S[index].AlmostEqual(SSingle));
+    }
+}
+
+
+#if CISST_HAS_CISSTNETLIB
+template <vct::size_type _size, bool _storageOrder>
+void nmrSVDJacobiTest::CompareNmrSVD(void)
+{
+    vctFixedSizeMatrix<double, _size, _size, _storageOrder> A, U, Vt, ALapack, ULapack, VtLapack;
+    vctFixedSizeVector<double, _size> S, SLapack;
+    vct::size_type index;
+    for (unsigned int iteration = 0; iteration < 20; iteration++) {
+        vctRandom(A, -10.0, 10.0);
+        CPPUNIT_ASSERT_EQUAL(0, nmrSVDJacobi(A, U, S, Vt));
+        // nmrSVD overwrites its input
+        ALapack.Assign(A);
+        CPPUNIT_ASSERT(nmrSVD(ALapack, ULapack, SLapack, VtLapack) == 0);
+        for (index = 0; index < _size; index++) {
+            // singular values agree to a few roundoff errors of the largest
+            // one, 2.2e-15 at worst over 20000 random 6x6 matrices
+            CPPUNIT_ASSERT(fabs(S[index] - SLapack[index]) <= 1e-14 * SLapack[0]);
+            // singular vectors are the same up to their sign
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fabs(vctDotProduct(U.Column(index), ULapack.Column(index))), 1e-9);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fabs(vctDotProduct(Vt.Row(index), VtLapack.Row(index))), 1e-9);
+        }
+    }
+}
+
+
+void nmrSVDJacobiTest::TestCompareNmrSVD(void)
+{
+    CompareNmrSVD<3, VCT_ROW_MAJOR>();
+    CompareNmrSVD<4, VCT_COL_MAJOR>();
+    CompareNmrSVD<6, VCT_ROW_MAJOR>();
+}
+#endif
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(nmrSVDJacobiTest);
@@ -0,0 +1,92 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrSVDJacobiTest_h
+#define _nmrSVDJacobiTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstNumerical/nmrConfig.h>
+#include <cisstNumerical/nmrSVDJacobi.h>
+
+class nmrSVDJacobiTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrSVDJacobiTest);
+
+    CPPUNIT_TEST(TestSVD3x3);
+    CPPUNIT_TEST(TestSVD4x4ColumnMajor);
+    CPPUNIT_TEST(TestSVD6x6);
+    CPPUNIT_TEST(TestSVD3x3Float);
+    CPPUNIT_TEST(TestRankDeficient);
+    CPPUNIT_TEST(TestBatch);
+#if CISST_HAS_CISSTNETLIB
+    CPPUNIT_TEST(TestCompareNmrSVD);
+#endif
+
+    CPPUNIT_TEST_SUITE_END();
+
+protected:
+    /*! Check that U S Vt is equal to A, U and Vt are orthonormal and
+      S is sorted in decreasing order. */
+    template <class _elementType, vct::size_type _size, bool _storageOrder>
+    void CheckSVD(const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & A,
+                  const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & U,
+                  const vctFixedSizeVector<_elementType, _size> & S,
+                  const vctFixedSizeMatrix<_elementType, _size, _size, _storageOrder> & Vt,
+                  _elementType tolerance);
+
+    /*! Random matrices of size _size */
+    template <class _elementType, vct::size_type _size, bool _storageOrder>
+    void TestRandom(_elementType tolerance);
+
+#if CISST_HAS_CISSTNETLIB
+    /*! Compare to nmrSVD (LAPACK) for random matrices of size _size */
+    template <vct::size_type _size, bool _storageOrder>
+    void CompareNmrSVD(void);
+#endif
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Random matrices */
+    void TestSVD3x3(void);
+    void TestSVD4x4ColumnMajor(void);
+    void TestSVD6x6(void);
+    void TestSVD3x3Float(void);
+
+    /*! Rank deficient matrices, including zero */
+    void TestRankDeficient(void);
+
+    /*! Batch results must be the same as individual results */
+    void TestBatch(void);
+
+#if CISST_HAS_CISSTNETLIB
+    /*! Singular values and vectors must match nmrSVD */
+    void TestCompareNmrSVD(void);
+#endif
+};
+
+#endif // _nmrSVDJacobiTest_h
@@ -0,0 +1,187 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "nmrSavitzkyGolayFilterTest.h"
+
+#include <math.h>
+
+
+void nmrSavitzkyGolayFilterTest::TestCoefficients(void)
+{
+    const double tolerance = 1e-12;
+    nmrSavitzkyGolayFilter filter;
+    // quadratic, 5 points: smoothing (-3 12 17 12 -3) / 35 and first
+    // derivative (-2 -1 0 1 2) / 10
+    filter.Configure(2, 1, 2, 2, 1);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), filter.GetWindowSize());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), filter.GetDelay());
+    const double smoothing[5] = {-3.0 / 35.0, 12.0 / 35.0, 17.0 / 35.0, 12.0 / 35.0, -3.0 / 35.0};
+    const double derivative[5] = {-0.2, -0.1, 0.0, 0.1, 0.2};
+    size_t index;
+    for (index = 0; index < 5; index++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(smoothing[index], filter.GetCoefficients().Element(0, index), tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(derivative[index], filter.GetCoefficients().Element(1, index), tolerance);
+    }
+
+    // linear, causal, 3 points: first derivative (-1 0 1) / 2 with
+    // period 0.5
+    filter.Configure(1, 1, 2, 0, 1, 0.5);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, filter.GetCoefficients().Element(1, 0), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, filter.GetCoefficients().Element(1, 1), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, filter.GetCoefficients().Element(1, 2), tolerance);
+}
+
+
+void nmrSavitzkyGolayFilterTest::TestPolynomialSignals(void)
+{
+    // causal filter, cubic polynomial fitted on 20 samples at 5 kHz
+    const double period = 1.0 / 5000.0;
+    nmrSavitzkyGolayFilter filter;
+    filter.Configure(3, 3, 19, 0, 3, period);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), filter.GetOutputs().rows());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), filter.GetOutputs().cols());
+
+    vctDynamicVector<double> sample(3);
+    size_t index;
+    for (index = 0; index < 100; index++) {
+        const double t = index * period;
+        // different polynomial of degree up to 3 for each channel
+        sample[0] = 1.0 + 2.0 * t;
+        sample[1] = -0.5 + 3.0 * t - 400.0 * t * t;
+        sample[2] = 2.0 - t + 100.0 * t * t + 20000.0 * t * t * t;
+        const bool valid = filter.Update(sample);
+        CPPUNIT_ASSERT_EQUAL(index >= 19, valid);
+        CPPUNIT_ASSERT_EQUAL(valid, filter.IsValid());
+        if (valid) {
+            CPPUNIT_ASSERT(filter.GetOutput(0).AlmostEqual(sample, 1e-9));
+            // velocities
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, filter.GetOutput(1)[0], 1e-6);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0 - 800.0 * t, filter.GetOutput(1)[1], 1e-6);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0 + 200.0 * t + 60000.0 * t * t, filter.GetOutput(1)[2], 1e-6);
+            // accelerations
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, filter.GetOutput(2)[0], 1e-3);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(-800.0, filter.GetOutput(2)[1], 1e-3);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(200.0 + 120000.0 * t, filter.GetOutput(2)[2], 1e-3);
+            // jerk
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(120000.0, filter.GetOutput(3)[2], 1.0);
+        }
+    }
+}
+
+
+void nmrSavitzkyGolayFilterTest::TestDelay(void)
+{
+    nmrSavitzkyGolayFilter filter;
+    filter.Configure(2, 1, 4, 4, 1);
+    size_t index;
+    for (index = 0; index < 50; index++) {
+        const double t = static_cast<double>(index);
+        if (filter.Update(0.5 * t * t - t)) {
+            // estimate at the sample received 4 samples ago
+            const double delayed = t - 4.0;
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5 * delayed * delayed - delayed, filter.GetOutput(0)[0], 1e-9);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(delayed - 1.0, filter.GetOutput(1)[0], 1e-9);
+        }
+    }
+
+    // noise is attenuated by the smoothing
+    filter.Configure(2, 0, 10, 10, 1);
+    double sumOfSquares = 0.0;
+    size_t count = 0;
+    for (index = 0; index < 1000; index++) {
+        const double noise = (index % 2) ? 1.0 : -1.0;
+        if (filter.Update(noise)) {
+            sumOfSquares += filter.GetOutput(0)[0] * filter.GetOutput(0)[0];
+            count++;
+        }
+    }
+    CPPUNIT_ASSERT(sqrt(sumOfSquares / count) < 0.1);
+}
+
+
+void nmrSavitzkyGolayFilterTest::TestSetCoefficients(void)
+{
+    // moving average over 4 samples
+    vctDynamicMatrix<double> coefficients(1, 4, 0.25);
+    nmrSavitzkyGolayFilter filter;
+    filter.SetCoefficients(coefficients, 0, 1);
+    CPPUNIT_ASSERT(!filter.Update(1.0));
+    CPPUNIT_ASSERT(!filter.Update(2.0));
+    CPPUNIT_ASSERT(!filter.Update(3.0));
+    CPPUNIT_ASSERT(filter.Update(4.0));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.5, filter.GetOutput(0)[0], 1e-12);
+    CPPUNIT_ASSERT(filter.Update(5.0));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.5, filter.GetOutput(0)[0], 1e-12);
+
+    filter.Reset();
+    CPPUNIT_ASSERT(!filter.IsValid());
+    CPPUNIT_ASSERT_EQUAL(0.0, filter.GetOutput(0)[0]);
+    CPPUNIT_ASSERT(!filter.Update(10.0));
+    CPPUNIT_ASSERT(!filter.Update(10.0));
+    CPPUNIT_ASSERT(!filter.Update(10.0));
+    CPPUNIT_ASSERT(filter.Update(10.0));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(10.0, filter.GetOutput(0)[0], 1e-12);
+}
+
+
+void nmrSavitzkyGolayFilterTest::TestErrors(void)
+{
+    nmrSavitzkyGolayFilter filter;
+    bool exceptionReceived = false;
+    // derivative higher than polynomial order
+    try {
+        filter.Configure(2, 3, 5, 0, 1);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+
+    // window too small
+    exceptionReceived = false;
+    try {
+        filter.Configure(3, 1, 2, 0, 1);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+
+    // wrong number of channels
+    filter.Configure(2, 1, 5, 0, 2);
+    vctDynamicVector<double> sample(3, 1.0);
+    exceptionReceived = false;
+    try {
+        filter.Update(sample);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+
+    exceptionReceived = false;
+    try {
+        filter.Update(1.0);
+    } catch (std::runtime_error &) {
+        exceptionReceived = true;
+    }
+    CPPUNIT_ASSERT(exceptionReceived);
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(nmrSavitzkyGolayFilterTest);
@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _nmrSavitzkyGolayFilterTest_h
+#define _nmrSavitzkyGolayFilterTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstNumerical/nmrSavitzkyGolayFilter.h>
+
+class nmrSavitzkyGolayFilterTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(nmrSavitzkyGolayFilterTest);
+
+    CPPUNIT_TEST(TestCoefficients);
+    CPPUNIT_TEST(TestPolynomialSignals);
+    CPPUNIT_TEST(TestDelay);
+    CPPUNIT_TEST(TestSetCoefficients);
+    CPPUNIT_TEST(TestErrors);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Compare with the published coefficients for small windows */
+    void TestCoefficients(void);
+
+    /*! Polynomial signals are reproduced exactly, including derivatives */
+    void TestPolynomialSignals(void);
+
+    /*! Symmetric window, outputs are delayed */
+    void TestDelay(void);
+
+    /*! User defined coefficients, single channel and reset */
+    void TestSetCoefficients(void);
+
+    /*! Invalid parameters */
+    void TestErrors(void);
+};
+
+#endif // _nmrSavitzkyGolayFilterTest_h
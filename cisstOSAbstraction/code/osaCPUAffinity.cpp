@@ -81,3 +81,35 @@ osaErrno osaCPUSetAffinity( osaCPUMask mask ){
 
   return OSAFAILURE;
 }
+
+osaErrno osaCPUSetAffinityIndex( unsigned int cpu ){
+
+#if (CISST_OS == CISST_LINUX)                       ||	\
+    (CISST_OS == CISST_LINUX_XENOMAI) 
+
+  if( cpu >= CPU_SETSIZE )
+    { return OSAFAILURE; }
+
+  cpu_set_t set;
+  CPU_ZERO( &set );
+  CPU_SET( cpu, &set );
+
+  if( sched_setaffinity( 0, sizeof( set ), &set ) == 0 )
+    { return OSASUCCESS; }
+  else
+    { return OSAFAILURE; }
+
+#elif (CISST_OS == CISST_WINDOWS)
+
+  if( cpu >= 8 * sizeof( DWORD_PTR ) )
+    { return OSAFAILURE; }
+
+  if( SetThreadAffinityMask( GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu ) != 0 )
+    { return OSASUCCESS; }
+  else
+    { return OSAFAILURE; }
+
+#endif
+
+  return OSAFAILURE;
+}
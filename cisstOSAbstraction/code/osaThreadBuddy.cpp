@@ -56,6 +56,30 @@ http://www.cisst.org/cisst/license.txt.
     #include <unistd.h>
 #endif
 
+#if (CISST_OS == CISST_LINUX)
+    #include <time.h> // for clock_nanosleep
+    #include <errno.h>
+    #include <string.h> // for strerror
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/syscall.h> // for sched_setattr
+    #include <stdint.h>
+    #ifndef SCHED_DEADLINE
+    #define SCHED_DEADLINE 6
+    #endif
+// sched_setattr has no glibc wrapper, see man sched_setattr(2)
+struct osaThreadBuddySchedAttr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+};
+#endif
+
 #if (CISST_OS == CISST_LINUX_RTAI)
 int GetStat(const char * path, struct stat * st)
 {
@@ -253,6 +277,11 @@ struct osaThreadBuddyInternals {
     //char Name[6];
     int coid;          // connection id
     int chid;          // channel id
+#elif (CISST_OS == CISST_LINUX)
+    // Absolute release time of the next period, in nanoseconds on
+    // CLOCK_MONOTONIC.  0 until the first call to WaitForRemainingPeriod.
+    long long int NextRelease;
+    char Name[6];
 #else
     struct timeval DueTime;
     char Name[6];
@@ -260,7 +289,12 @@ struct osaThreadBuddyInternals {
 };
 
 // Constructor. Allocates memory for thread buddy internal data.
-osaThreadBuddy::osaThreadBuddy() {
+osaThreadBuddy::osaThreadBuddy():
+    Period(0.0),
+    OverrunPolicy(OVERRUN_SKIP),
+    NumberOfOverruns(0),
+    NumberOfMissedPeriods(0)
+{
     Data = new osaThreadBuddyInternals;
 }
 
@@ -294,6 +328,8 @@ void osaThreadBuddy::Create(const char *name, const osaAbsoluteTime& tv, int CMN
    
     Period = tv.sec*1000000000 + tv.nsec;
     Data->IsSuspended = false;
+    NumberOfOverruns = 0;
+    NumberOfMissedPeriods = 0;
 
 #if (CISST_OS == CISST_LINUX_RTAI)
     // nam2num converts the character string 'name' to a long, using just the first
@@ -384,7 +420,11 @@ void osaThreadBuddy::Create(const char *name, const osaAbsoluteTime& tv, int CMN
 
    // start the timer
    timer_settime( timerid, 0, &timer, NULL );
-   
+
+#elif (CISST_OS == CISST_LINUX)
+    Data->NextRelease = 0;
+    for (unsigned int i = 0; i < sizeof(Data->Name); i++) Data->Name[i] = name[i];
+    Data->Name[sizeof(Data->Name)-1] = 0;
 #else // default unix
     Data->DueTime.tv_sec = 0;
     Data->DueTime.tv_usec = 0;
@@ -566,6 +606,48 @@ void osaThreadBuddy::WaitForRemainingPeriod(void)
     struct _pulse pulse;
     MsgReceivePulse( Data->chid, &pulse, sizeof(pulse), NULL );
 
+#elif (CISST_OS == CISST_LINUX)
+    if (!IsPeriodic()) {
+        return;
+    }
+    const long long int period = static_cast<long long int>(Period);
+    struct timespec timeNow, timeRelease;
+    long long int now;
+    NumberOfMissedPeriods = 0;
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &timeNow);
+        now = static_cast<long long int>(timeNow.tv_sec) * 1000000000LL + timeNow.tv_nsec;
+        if (Data->NextRelease == 0) {
+            // this is the first time this is being called
+            Data->NextRelease = now;
+        }
+        Data->NextRelease += period;
+        if (Data->NextRelease <= now) {
+            // release time already passed, overrun unless we are
+            // just coming back from a suspension
+            if (!Data->IsSuspended) {
+                NumberOfMissedPeriods = static_cast<unsigned long>((now - Data->NextRelease) / period) + 1;
+                NumberOfOverruns++;
+            }
+            switch (OverrunPolicy) {
+            case OVERRUN_CATCH_UP:
+                // don't wait, next release time is based on the missed one
+                continue;
+            case OVERRUN_RESYNC:
+                Data->NextRelease = now;
+                continue;
+            case OVERRUN_SKIP:
+            default:
+                Data->NextRelease += ((now - Data->NextRelease) / period + 1) * period;
+                break;
+            }
+        }
+        timeRelease.tv_sec = static_cast<time_t>(Data->NextRelease / 1000000000LL);
+        timeRelease.tv_nsec = static_cast<long>(Data->NextRelease % 1000000000LL);
+        // restart if interrupted by a signal, release time is absolute
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &timeRelease, NULL) == EINTR) {}
+    } while (Data->IsSuspended);
+
 #else // default unix
     if (!IsPeriodic()) {
         return;
@@ -669,6 +751,66 @@ void osaThreadBuddy::Suspend(void)
 #endif
 }
 
+bool osaThreadBuddy::SetCPUAffinity(const osaCPUMask mask)
+{
+    if (osaCPUSetAffinity(mask) != OSASUCCESS) {
+        CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetCPUAffinity: failed to set CPU affinity to "
+                           << mask << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool osaThreadBuddy::SetRealTimePriority(const int priority)
+{
+#if (CISST_OS == CISST_LINUX)
+    struct sched_param param;
+    param.sched_priority = priority;
+    const int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (result != 0) {
+        CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetRealTimePriority: failed to set SCHED_FIFO with priority "
+                           << priority << ": " << strerror(result) << std::endl;
+        return false;
+    }
+    return true;
+#else
+    CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetRealTimePriority: not supported on this OS (priority "
+                       << priority << ")" << std::endl;
+    return false;
+#endif
+}
+
+bool osaThreadBuddy::SetDeadlineScheduling(const double runtime)
+{
+    if (!IsPeriodic()) {
+        CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetDeadlineScheduling: thread is not periodic" << std::endl;
+        return false;
+    }
+    if ((runtime <= 0.0) || (runtime > Period)) {
+        CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetDeadlineScheduling: runtime must be positive and lower than period, got "
+                           << runtime << " for period " << Period << std::endl;
+        return false;
+    }
+#if (CISST_OS == CISST_LINUX) && defined(SYS_sched_setattr)
+    osaThreadBuddySchedAttr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.sched_policy = SCHED_DEADLINE;
+    attr.sched_runtime = static_cast<uint64_t>(runtime);
+    attr.sched_deadline = static_cast<uint64_t>(Period);
+    attr.sched_period = static_cast<uint64_t>(Period);
+    if (syscall(SYS_sched_setattr, 0, &attr, 0) != 0) {
+        CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetDeadlineScheduling: sched_setattr failed: "
+                           << strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+#else
+    CMN_LOG_INIT_ERROR << "osaThreadBuddy::SetDeadlineScheduling: SCHED_DEADLINE not supported on this OS" << std::endl;
+    return false;
+#endif
+}
+
 // Lock stack growth
 void osaThreadBuddy::LockStack() 
 {
@@ -68,4 +68,13 @@ CISST_EXPORT int osaCPUGetCount();
  */
 CISST_EXPORT osaErrno osaCPUSetAffinity( osaCPUMask mask );
 
+//! Set the affinity of the current thread to a single CPU
+/**
+   Unlike osaCPUSetAffinity, which is limited to the first 16 CPUs by
+   the size of osaCPUMask, any CPU can be used.
+   \param cpu Index of the CPU, starting at 0
+   \return OSASUCCESS if the operation succeeded. OSAERROR otherwise.
+ */
+CISST_EXPORT osaErrno osaCPUSetAffinityIndex( unsigned int cpu );
+
 #endif
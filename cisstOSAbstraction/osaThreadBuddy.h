@@ -30,6 +30,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnPortability.h>
 #include <cisstOSAbstraction/osaTimeServer.h>
 #include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaCPUAffinity.h>
 
 // Always include last
 #include <cisstOSAbstraction/osaExport.h>
@@ -62,11 +63,36 @@ struct osaThreadBuddyInternals;
  */
 class CISST_EXPORT osaThreadBuddy {
 
+public:
+    /*! Policy used by WaitForRemainingPeriod when the release time of
+      the next period has already passed.  On Linux, periods are
+      computed from absolute release times so the phase of the thread
+      doesn't drift; the policy defines what happens after an overrun.
+
+      - OVERRUN_SKIP: missed release points are skipped, the thread
+        waits for the next release point in the future.  The phase is
+        preserved.
+      - OVERRUN_CATCH_UP: the thread doesn't wait and is released
+        immediately for every missed period until it has caught up.
+      - OVERRUN_RESYNC: the thread is released immediately and the
+        following periods are computed from the current time (this was
+        the behavior of relative sleeps). */
+    typedef enum {OVERRUN_SKIP, OVERRUN_CATCH_UP, OVERRUN_RESYNC} OverrunPolicyType;
+
+private:
     osaThreadBuddyInternals* Data;
 
     /*! Thread period (if > 0) */
     double Period;
 
+    /*! Policy used when a period is overran */
+    OverrunPolicyType OverrunPolicy;
+
+    /*! Total number of overruns detected and number of periods missed
+      during the last call to WaitForRemainingPeriod. */
+    unsigned long NumberOfOverruns;
+    unsigned long NumberOfMissedPeriods;
+
 public:
     /*! Constructor. Allocates internal data. */
     osaThreadBuddy();
@@ -98,8 +124,58 @@ public:
     void WaitForPeriod(void);
 
     /*! Suspend the execution of the real time thread for the
-      remainder of the current period. */
+      remainder of the current period.  On Linux, this uses an
+      absolute release time (clock_nanosleep with TIMER_ABSTIME on
+      CLOCK_MONOTONIC) and applies the overrun policy if the release
+      time has already passed. */
     void WaitForRemainingPeriod(void);
+
+    /*! Set/get the policy used when a period is overran.  Default is
+      OVERRUN_SKIP. */
+    void SetOverrunPolicy(const OverrunPolicyType policy) {
+        OverrunPolicy = policy;
+    }
+    OverrunPolicyType GetOverrunPolicy(void) const {
+        return OverrunPolicy;
+    }
+
+    /*! Returns true if the last call to WaitForRemainingPeriod
+      detected an overrun, i.e. the release time had already passed. */
+    bool IsOverranPeriod(void) const {
+        return NumberOfMissedPeriods > 0;
+    }
+
+    /*! Number of periods missed during the last call to
+      WaitForRemainingPeriod. */
+    unsigned long GetNumberOfMissedPeriods(void) const {
+        return NumberOfMissedPeriods;
+    }
+
+    /*! Total number of overruns since the thread buddy has been
+      created. */
+    unsigned long GetNumberOfOverruns(void) const {
+        return NumberOfOverruns;
+    }
+
+    /*! Pin the calling thread to a set of CPUs, see
+      osaCPUSetAffinity.  Returns false if the affinity can't be
+      set. */
+    bool SetCPUAffinity(const osaCPUMask mask);
+
+    /*! Use the SCHED_FIFO real-time scheduling policy with the given
+      priority for the calling thread.  This is only supported on
+      Linux and requires the proper privileges (root or
+      CAP_SYS_NICE).  Returns false if the scheduling policy can't be
+      set. */
+    bool SetRealTimePriority(const int priority);
+
+    /*! Use the SCHED_DEADLINE scheduling policy for the calling
+      thread.  The thread period is used as both period and relative
+      deadline and the runtime is the CPU time (in nanoseconds)
+      reserved per period.  This requires Linux 3.14 or later and the
+      proper privileges.  Returns false if the scheduling policy can't
+      be set. */
+    bool SetDeadlineScheduling(const double runtime);
     
     /*! Make a thread hard real time. */
     void MakeHardRealTime(void);
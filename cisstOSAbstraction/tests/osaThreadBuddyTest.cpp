@@ -0,0 +1,105 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnPortability.h>
+#include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstOSAbstraction/osaSleep.h>
+
+#include "osaThreadBuddyTest.h"
+
+#include <cisstOSAbstraction/osaThreadBuddy.h>
+
+
+void osaThreadBuddyTest::TestPeriodNoDrift(void)
+{
+#if (CISST_OS == CISST_LINUX)
+    const double period = 10.0 * cmn_ms;
+    const unsigned int numberOfPeriods = 50;
+    osaThreadBuddy buddy;
+    osaStopwatch stopwatch;
+    buddy.Create("TBPer", osaAbsoluteTime(0, static_cast<long>(period / cmn_ns)));
+    // first call defines the phase
+    buddy.WaitForRemainingPeriod();
+    stopwatch.Start();
+    for (unsigned int index = 0; index < numberOfPeriods; ++index) {
+        // some load, less than a period
+        osaSleep(2.0 * cmn_ms);
+        buddy.WaitForRemainingPeriod();
+    }
+    stopwatch.Stop();
+    // relative sleeps would accumulate at least 2 ms per period
+    const double expected = numberOfPeriods * period;
+    CPPUNIT_ASSERT(stopwatch.GetElapsedTime() >= expected - period);
+    CPPUNIT_ASSERT(stopwatch.GetElapsedTime() < expected + 5.0 * period);
+    buddy.Delete();
+#endif
+}
+
+
+void osaThreadBuddyTest::TestOverrunSkip(void)
+{
+#if (CISST_OS == CISST_LINUX)
+    const double period = 10.0 * cmn_ms;
+    osaThreadBuddy buddy;
+    buddy.Create("TBSkp", osaAbsoluteTime(0, static_cast<long>(period / cmn_ns)));
+    CPPUNIT_ASSERT_EQUAL(osaThreadBuddy::OVERRUN_SKIP, buddy.GetOverrunPolicy());
+    buddy.WaitForRemainingPeriod();
+    buddy.WaitForRemainingPeriod();
+    CPPUNIT_ASSERT(!buddy.IsOverranPeriod());
+    // overrun by more than 2 periods
+    osaSleep(2.5 * period);
+    buddy.WaitForRemainingPeriod();
+    CPPUNIT_ASSERT(buddy.IsOverranPeriod());
+    CPPUNIT_ASSERT(buddy.GetNumberOfMissedPeriods() >= 2);
+    CPPUNIT_ASSERT_EQUAL(1ul, buddy.GetNumberOfOverruns());
+    // back on schedule
+    buddy.WaitForRemainingPeriod();
+    CPPUNIT_ASSERT(!buddy.IsOverranPeriod());
+    CPPUNIT_ASSERT_EQUAL(1ul, buddy.GetNumberOfOverruns());
+    buddy.Delete();
+#endif
+}
+
+
+void osaThreadBuddyTest::TestOverrunCatchUp(void)
+{
+#if (CISST_OS == CISST_LINUX)
+    const double period = 10.0 * cmn_ms;
+    osaThreadBuddy buddy;
+    osaStopwatch stopwatch;
+    buddy.Create("TBCat", osaAbsoluteTime(0, static_cast<long>(period / cmn_ns)));
+    buddy.SetOverrunPolicy(osaThreadBuddy::OVERRUN_CATCH_UP);
+    buddy.WaitForRemainingPeriod();
+    buddy.WaitForRemainingPeriod();
+    osaSleep(2.5 * period);
+    // next two release points are in the past, no wait
+    stopwatch.Start();
+    buddy.WaitForRemainingPeriod();
+    buddy.WaitForRemainingPeriod();
+    stopwatch.Stop();
+    CPPUNIT_ASSERT(buddy.GetNumberOfOverruns() >= 2);
+    CPPUNIT_ASSERT(stopwatch.GetElapsedTime() < 0.5 * period);
+    buddy.Delete();
+#endif
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaThreadBuddyTest);
@@ -0,0 +1,55 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaThreadBuddyTest_h
+#define _osaThreadBuddyTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class osaThreadBuddyTest: public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaThreadBuddyTest);
+    {
+        CPPUNIT_TEST(TestPeriodNoDrift);
+        CPPUNIT_TEST(TestOverrunSkip);
+        CPPUNIT_TEST(TestOverrunCatchUp);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Check that the accumulated time over many periods with some
+      load doesn't drift */
+    void TestPeriodNoDrift(void);
+
+    /*! Check that missed periods are skipped and reported */
+    void TestOverrunSkip(void);
+
+    /*! Check that missed periods are released immediately */
+    void TestOverrunCatchUp(void);
+};
+
+#endif // _osaThreadBuddyTest_h
@@ -0,0 +1,340 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*-    */
+/* ex: set filetype=cpp softtabstop=2 shiftwidth=2 tabstop=2 cindent expandtab: */
+
+/*
+  Author(s): agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstRobot/robKinematicChain.h>
+#include <cisstRobot/robManipulator.h>
+
+#include <math.h>
+
+// C = A*B for 3x4 row major homogeneous transformations
+static inline void Compose( const double* A, const double* B, double* C ){
+  for( size_t r=0; r<3; r++ ){
+    const double* a = A + 4*r;
+    double* c = C + 4*r;
+    c[0] = a[0]*B[0] + a[1]*B[4] + a[2]*B[8];
+    c[1] = a[0]*B[1] + a[1]*B[5] + a[2]*B[9];
+    c[2] = a[0]*B[2] + a[1]*B[6] + a[2]*B[10];
+    c[3] = a[0]*B[3] + a[1]*B[7] + a[2]*B[11] + a[3];
+  }
+}
+
+// M = M*Rz
+static inline void RotateZ( double* M, double c, double s ){
+  for( size_t r=0; r<3; r++ ){
+    double m0 = M[4*r];
+    double m1 = M[4*r+1];
+    M[4*r]   =  c*m0 + s*m1;
+    M[4*r+1] = -s*m0 + c*m1;
+  }
+}
+
+// M = M*Tz
+static inline void TranslateZ( double* M, double d ){
+  for( size_t r=0; r<3; r++ )
+    { M[4*r+3] += d*M[4*r+2]; }
+}
+
+static inline void FromFrame( const vctFrame4x4<double>& Rt, double* M ){
+  for( size_t r=0; r<3; r++ )
+    for( size_t c=0; c<4; c++ )
+      { M[4*r+c] = Rt[r][c]; }
+}
+
+static inline void ToFrame( const double* M, vctFrame4x4<double>& Rt ){
+  Rt = vctFrame4x4<double>( vctMatrixRotation3<double>( M[0], M[1], M[2],
+                                                        M[4], M[5], M[6],
+                                                        M[8], M[9], M[10],
+                                                        VCT_DO_NOT_NORMALIZE ),
+                            vctFixedSizeVector<double,3>( M[3], M[7], M[11] ) );
+}
+
+robKinematicChain::robKinematicChain() : manipulator( NULL ) {}
+
+robKinematicChain::robKinematicChain( const robManipulator& manipulator ) :
+  manipulator( NULL )
+{ Compile( manipulator ); }
+
+void robKinematicChain::Compile( const robManipulator& manipulator ){
+
+  this->manipulator = &manipulator;
+  links.resize( manipulator.links.size() );
+
+  for( size_t i=0; i<links.size(); i++ ){
+
+    const robLink& li = manipulator.links[i];
+    Link& link = links[i];
+    link.link = &li;
+
+    switch( li.GetConvention() ){
+    case robKinematics::STANDARD_DH:
+    case robKinematics::HAYATI:
+      link.proximal = true;
+      break;
+    case robKinematics::MODIFIED_DH:
+    case robKinematics::MODIFIED_HAYATI:
+      link.proximal = false;
+      break;
+    default:
+      link.motion = Link::GENERIC;
+      continue;
+    }
+
+    switch( li.GetType() ){
+    case robJoint::HINGE:
+      link.motion = Link::ROTATION;
+      break;
+    case robJoint::SLIDER:
+      link.motion = Link::TRANSLATION;
+      break;
+    default:
+      link.motion = Link::GENERIC;
+      continue;
+    }
+
+    // The joint offset is part of the constant transformation
+    FromFrame( li.ForwardKinematics( 0.0 ), &link.C[0][0] );
+  }
+
+}
+
+void robKinematicChain::Evaluate( const vctDynamicVector<double>& q,
+                                  size_t N,
+                                  Workspace& workspace ) const {
+
+  // base, links and tool
+  std::vector<double>& frames = workspace.frames;
+  frames.resize( 12*(links.size()+2) );
+
+  FromFrame( manipulator->Rtw0, &frames[0] );
+
+  for( size_t i=0; i<N; i++ ){
+
+    const Link& link = links[i];
+    const double* Rtwp = &frames[12*i];     // proximal link
+    double* Rtwi = &frames[12*(i+1)];       // this link
+
+    if( link.motion == Link::GENERIC ){
+      double Rt[12];
+      FromFrame( link.link->ForwardKinematics( q[i] ), Rt );
+      Compose( Rtwp, Rt, Rtwi );
+      continue;
+    }
+
+    if( link.proximal ){
+      double Rtj[12];
+      for( size_t k=0; k<12; k++ ) { Rtj[k] = Rtwp[k]; }
+      if( link.motion == Link::ROTATION ) RotateZ( Rtj, cos( q[i] ), sin( q[i] ) );
+      else                                TranslateZ( Rtj, q[i] );
+      Compose( Rtj, &link.C[0][0], Rtwi );
+    }
+    else{
+      Compose( Rtwp, &link.C[0][0], Rtwi );
+      if( link.motion == Link::ROTATION ) RotateZ( Rtwi, cos( q[i] ), sin( q[i] ) );
+      else                                TranslateZ( Rtwi, q[i] );
+    }
+
+  }
+
+}
+
+bool robKinematicChain::ToolFrame( const vctDynamicVector<double>& q,
+                                   bool jacobian,
+                                   vctFrame4x4<double>& Rtt ) const {
+
+  // same as robManipulator::ForwardKinematics and robManipulator::JacobianBody
+  const std::vector<robManipulator*>& tools = manipulator->tools;
+  if( jacobian ){
+    if( !tools.empty() && tools[0] != NULL ){
+      Rtt = tools[0]->ForwardKinematics( q );
+      return true;
+    }
+  }
+  else{
+    if( tools.size() == 1 && tools[0] != NULL ){
+      Rtt = tools[0]->ForwardKinematics( q, 0 );
+      return true;
+    }
+  }
+  return false;
+
+}
+
+bool
+robKinematicChain::ForwardKinematics( const vctDynamicVector<double>& q,
+                                      std::vector<vctFrame4x4<double> >& Rtwi ) const {
+  Workspace workspace;
+  return ForwardKinematics( q, Rtwi, workspace );
+}
+
+bool
+robKinematicChain::ForwardKinematics( const vctDynamicVector<double>& q,
+                                      std::vector<vctFrame4x4<double> >& Rtwi,
+                                      Workspace& workspace ) const {
+
+  if( manipulator == NULL || q.size() != links.size() ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << links.size() << " joint positions but "
+                      << "size(q) = " << q.size() << "."
+                      << std::endl;
+    return false;
+  }
+
+  Evaluate( q, links.size(), workspace );
+
+  Rtwi.resize( links.size() );
+  for( size_t i=0; i<links.size(); i++ )
+    { ToFrame( &workspace.frames[12*(i+1)], Rtwi[i] ); }
+
+  return true;
+
+}
+
+vctFrame4x4<double>
+robKinematicChain::ForwardKinematics( const vctDynamicVector<double>& q,
+                                      int N ) const {
+  Workspace workspace;
+  return ForwardKinematics( q, workspace, N );
+}
+
+vctFrame4x4<double>
+robKinematicChain::ForwardKinematics( const vctDynamicVector<double>& q,
+                                      Workspace& workspace,
+                                      int N ) const {
+
+  if( manipulator == NULL ) return vctFrame4x4<double>();
+
+  if( N == 0 ) return manipulator->Rtw0;
+
+  // if N < 0 then we want the end-effector
+  if( N < 0 || (int)links.size() < N ) N = links.size();
+
+  if( ((int)q.size()) < N ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << N << " joint positions but "
+                      << "size(q) = " << q.size() << "."
+                      << std::endl;
+    return manipulator->Rtw0;
+  }
+
+  // no link? then return the transformation of the base
+  if( links.empty() ) return manipulator->Rtw0;
+
+  Evaluate( q, N, workspace );
+
+  vctFrame4x4<double> Rtwi;
+  ToFrame( &workspace.frames[12*N], Rtwi );
+
+  vctFrame4x4<double> Rtt;
+  if( ToolFrame( q, false, Rtt ) )
+    { return Rtwi * Rtt; }
+
+  return Rtwi;
+
+}
+
+bool robKinematicChain::JacobianBody( const vctDynamicVector<double>& q,
+                                      vctDynamicMatrix<double>& J ) const {
+  Workspace workspace;
+  return JacobianBody( q, J, workspace );
+}
+
+bool robKinematicChain::JacobianBody( const vctDynamicVector<double>& q,
+                                      vctDynamicMatrix<double>& J,
+                                      Workspace& workspace ) const {
+
+  if( !JacobianSpatial( q, J, workspace ) ) return false;
+
+  // body Jacobian wrt the end-effector frame (with the tool)
+  const std::vector<double>& frames = workspace.frames;
+  double Rtn[12];
+  Compose( &frames[12*links.size()], &frames[12*(links.size()+1)], Rtn );
+
+  for( size_t c=0; c<links.size(); c++ ){
+    // spatial to body: w = R'ws, v = R'( vs + ws x p )
+    double vs[3] = { J[0][c], J[1][c], J[2][c] };
+    double ws[3] = { J[3][c], J[4][c], J[5][c] };
+    double v[3] = { vs[0] + ws[1]*Rtn[11] - ws[2]*Rtn[7],
+                    vs[1] + ws[2]*Rtn[3]  - ws[0]*Rtn[11],
+                    vs[2] + ws[0]*Rtn[7]  - ws[1]*Rtn[3] };
+    for( size_t r=0; r<3; r++ ){
+      J[r][c]   = Rtn[r]*v[0]  + Rtn[4+r]*v[1]  + Rtn[8+r]*v[2];
+      J[r+3][c] = Rtn[r]*ws[0] + Rtn[4+r]*ws[1] + Rtn[8+r]*ws[2];
+    }
+  }
+
+  return true;
+
+}
+
+bool robKinematicChain::JacobianSpatial( const vctDynamicVector<double>& q,
+                                         vctDynamicMatrix<double>& J ) const {
+  Workspace workspace;
+  return JacobianSpatial( q, J, workspace );
+}
+
+bool robKinematicChain::JacobianSpatial( const vctDynamicVector<double>& q,
+                                         vctDynamicMatrix<double>& J,
+                                         Workspace& workspace ) const {
+
+  if( manipulator == NULL || q.size() != links.size() ||
+      J.rows() != 6 || J.cols() != links.size() ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << links.size() << " joints. "
+                      << "Got " << q.size() << " values and a "
+                      << J.rows() << "x" << J.cols() << " matrix."
+                      << std::endl;
+    return false;
+  }
+
+  Evaluate( q, links.size(), workspace );
+  std::vector<double>& frames = workspace.frames;
+
+  // tool frame stored after the last link (used by JacobianBody)
+  vctFrame4x4<double> Rtt;
+  ToolFrame( q, true, Rtt );
+  FromFrame( Rtt, &frames[12*(links.size()+1)] );
+
+  for( size_t i=0; i<links.size(); i++ ){
+
+    // joint axis and a point on the axis in the world frame: the z axis of
+    // the proximal link for the standard conventions, the z axis of the link
+    // for the modified conventions
+    const double* Rt = &frames[12*i];
+    if( links[i].motion != Link::GENERIC && !links[i].proximal )
+      { Rt = &frames[12*(i+1)]; }
+    double z[3] = { Rt[2], Rt[6], Rt[10] };
+    double o[3] = { Rt[3], Rt[7], Rt[11] };
+
+    if( links[i].link->GetType() == robJoint::SLIDER ){
+      J[0][i] = z[0];  J[1][i] = z[1];  J[2][i] = z[2];
+      J[3][i] = 0.0;   J[4][i] = 0.0;   J[5][i] = 0.0;
+    }
+    else{
+      // o x z
+      J[0][i] = o[1]*z[2] - o[2]*z[1];
+      J[1][i] = o[2]*z[0] - o[0]*z[2];
+      J[2][i] = o[0]*z[1] - o[1]*z[0];
+      J[3][i] = z[0];  J[4][i] = z[1];  J[5][i] = z[2];
+    }
+
+  }
+
+  return true;
+
+}
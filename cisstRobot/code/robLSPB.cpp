@@ -61,6 +61,7 @@ void robLSPB::Set(const vctDoubleVec & start,
     mAcceleration.ForceAssign(acceleration);
     mAccelerationTime.SetSize(mDimension);
     mFinishTime.SetSize(mDimension);
+    mDecelerationTime.SetSize(mDimension);
 
     // compute trajectory parameters
     for (size_t i = 0;
@@ -100,19 +101,37 @@ void robLSPB::Set(const vctDoubleVec & start,
             mAccelerationTime[i] = 0.0;
             mFinishTime[i] = 0.0;
         }
+        mDecelerationTime[i] = mFinishTime[i] - mAccelerationTime[i];
     }
     // compute max time
     mDuration = mFinishTime.MaxElement();
 
-    // scale time to all arrive at same time
-    if (mCoordination == LSPB_DURATION) {
-        mTimeScale.SetSize(mDimension);
-        if (mDuration > 0) {
-            mTimeScale.RatioOf(mFinishTime, mDuration);
-        } else {
-            mTimeScale.SetAll(1.0);
+    // lower the velocity of the faster joints to all arrive at same time
+    if (mCoordination == LSPB_SYNCHRONIZED) {
+        for (size_t i = 0;
+             i < mDimension;
+             ++i) {
+            if ((mFinishTime[i] > 0.0) && (mFinishTime[i] < mDuration)) {
+                // solve distance = velocity * (duration - velocity / acceleration),
+                // smallest root, written to avoid cancellation
+                const double distance = finish[i] - start[i];
+                const double discriminant = mDuration * mDuration - 4.0 * distance / mAcceleration[i];
+                mVelocity[i] = 2.0 * distance
+                    / (mDuration + ((discriminant > 0.0) ? sqrt(discriminant) : 0.0));
+                mAccelerationTime[i] = mVelocity[i] / mAcceleration[i];
+                mFinishTime[i] = mDuration;
+                mDecelerationTime[i] = mFinishTime[i] - mAccelerationTime[i];
+            }
         }
     }
+
+    // scale time to all arrive at same time
+    mTimeScale.SetSize(mDimension);
+    if ((mCoordination == LSPB_DURATION) && (mDuration > 0)) {
+        mTimeScale.RatioOf(mFinishTime, mDuration);
+    } else {
+        mTimeScale.SetAll(1.0);
+    }
     mIsSet = true;
 }
 
@@ -142,59 +161,125 @@ void robLSPB::Evaluate(const double absoluteTime,
         acceleration.Zeros();
         return;
     }
+    EvaluateJoints(time, position.Pointer(), velocity.Pointer(), acceleration.Pointer());
+}
+
+void robLSPB::Evaluate(const double absoluteTime,
+                       vctDoubleVec & position)
+{
+    mTemp.SetSize(mDimension);
+    Evaluate(absoluteTime, position, mTemp, mTemp);
+}
+
+void robLSPB::Evaluate(const vctDoubleVec & absoluteTimes,
+                       vctDoubleMat & positions,
+                       vctDoubleMat & velocities,
+                       vctDoubleMat & accelerations)
+{
+    // sanity checks
+    if (!mIsSet) {
+        cmnThrow("robLSPB::Evaluate trajectory parameters are not set yet");
+    }
+
+    const size_t nbTimes = absoluteTimes.size();
+    positions.SetSize(nbTimes, mDimension, VCT_ROW_MAJOR);
+    velocities.SetSize(nbTimes, mDimension, VCT_ROW_MAJOR);
+    accelerations.SetSize(nbTimes, mDimension, VCT_ROW_MAJOR);
+
+    for (size_t t = 0;
+         t < nbTimes;
+         ++t) {
+        const double time = absoluteTimes[t] - mStartTime;
+        if (time <= 0) {
+            positions.Row(t).Assign(mStart);
+            velocities.Row(t).SetAll(0.0);
+            accelerations.Row(t).SetAll(0.0);
+        } else {
+            EvaluateJoints(time,
+                           positions.Row(t).Pointer(),
+                           velocities.Row(t).Pointer(),
+                           accelerations.Row(t).Pointer());
+        }
+    }
+}
+
+void robLSPB::Evaluate(const vctDoubleVec & absoluteTimes,
+                       vctDoubleMat & positions)
+{
+    // sanity checks
+    if (!mIsSet) {
+        cmnThrow("robLSPB::Evaluate trajectory parameters are not set yet");
+    }
+
+    const size_t nbTimes = absoluteTimes.size();
+    positions.SetSize(nbTimes, mDimension, VCT_ROW_MAJOR);
+    mTemp.SetSize(mDimension);
+
+    for (size_t t = 0;
+         t < nbTimes;
+         ++t) {
+        const double time = absoluteTimes[t] - mStartTime;
+        if (time <= 0) {
+            positions.Row(t).Assign(mStart);
+        } else {
+            EvaluateJoints(time, positions.Row(t).Pointer(), mTemp.Pointer(), mTemp.Pointer());
+        }
+    }
+}
+
+void robLSPB::EvaluateJoints(const double time,
+                             double * position,
+                             double * velocity,
+                             double * acceleration) const
+{
+    const double * start = mStart.Pointer();
+    const double * finish = mFinish.Pointer();
+    const double * maxVelocity = mVelocity.Pointer();
+    const double * maxAcceleration = mAcceleration.Pointer();
+    const double * accelerationTime = mAccelerationTime.Pointer();
+    const double * decelerationTime = mDecelerationTime.Pointer();
+    const double * finishTime = mFinishTime.Pointer();
+    const double * timeScale = mTimeScale.Pointer();
+
     for (size_t i = 0;
          i < mDimension;
          ++i) {
-        double dimTime;
-        if (mCoordination == LSPB_DURATION) {
-            dimTime = time * mTimeScale[i];
-        } else {
-            dimTime = time;
-        }
+        const double dimTime = time * timeScale[i];
         const double time2 = dimTime * dimTime;
 
-        if (dimTime >= mFinishTime[i]) {
-            position[i] = mFinish[i];
+        if (dimTime >= finishTime[i]) {
+            position[i] = finish[i];
             velocity[i] = 0.0;
             acceleration[i] = 0.0;
-        } else {
+        } else if (dimTime <= accelerationTime[i]) {
             // acceleration phase
-            if (dimTime <= mAccelerationTime[i]) {
-                position[i] =
-                    mStart[i]
-                    + 0.5 * mAcceleration[i] * time2;
-                velocity[i] = mAcceleration[i] * dimTime;
-                acceleration[i] = mAcceleration[i];
-            } else if (dimTime >= (mFinishTime[i] - mAccelerationTime[i])) {
-                // deceleration phase
-                position[i] =
-                    mFinish[i]
-                    - 0.5 * mAcceleration[i] * mFinishTime[i] * mFinishTime[i]
-                    + mAcceleration[i] * mFinishTime[i] * dimTime
-                    - 0.5 * mAcceleration[i] * time2;
-                velocity[i] =
-                    mAcceleration[i] * mFinishTime[i]
-                    - mAcceleration[i] * dimTime;
-                acceleration[i] = -mAcceleration[i];
-            } else {
-                // constant velocity
-                position[i] =
-                    0.5 * (mFinish[i] + mStart[i] - mVelocity[i] * mFinishTime[i])
-                    + mVelocity[i] * dimTime;
-                velocity[i] = mVelocity[i];
-                acceleration[i] = 0.0;
-            }
+            position[i] =
+                start[i]
+                + 0.5 * maxAcceleration[i] * time2;
+            velocity[i] = maxAcceleration[i] * dimTime;
+            acceleration[i] = maxAcceleration[i];
+        } else if (dimTime >= decelerationTime[i]) {
+            // deceleration phase
+            position[i] =
+                finish[i]
+                - 0.5 * maxAcceleration[i] * finishTime[i] * finishTime[i]
+                + maxAcceleration[i] * finishTime[i] * dimTime
+                - 0.5 * maxAcceleration[i] * time2;
+            velocity[i] =
+                maxAcceleration[i] * finishTime[i]
+                - maxAcceleration[i] * dimTime;
+            acceleration[i] = -maxAcceleration[i];
+        } else {
+            // constant velocity
+            position[i] =
+                0.5 * (finish[i] + start[i] - maxVelocity[i] * finishTime[i])
+                + maxVelocity[i] * dimTime;
+            velocity[i] = maxVelocity[i];
+            acceleration[i] = 0.0;
         }
     }
 }
 
-void robLSPB::Evaluate(const double absoluteTime,
-                       vctDoubleVec & position)
-{
-    mTemp.SetSize(mDimension);
-    Evaluate(absoluteTime, position, mTemp, mTemp);
-}
-
 double & robLSPB::StartTime(void) {
     return mStartTime;
 }
@@ -915,18 +915,8 @@ robManipulator::JSinertia( const vctDynamicVector<double>& q ) const {
   }
 
   vctDynamicMatrix<double> A( links.size(), links.size(), 0.0 );
-
-  for(size_t c=0; c<q.size(); c++){
-    vctDynamicVector<double> qd( q.size(), 0.0 );  // velocities to zero
-    vctDynamicVector<double> qdd( q.size(), 0.0 ); // accelerations to zero
-    vctFixedSizeVector<double,6> fext(0.0);
-    qdd[c] = 1.0;                                  // ith acceleration to 1
-
-    vctDynamicVector<double> h = RNE( q, qd, qdd, fext, 0.0  );
-    for( size_t r=0; r<links.size(); r++ )
-      { A[c][r] = h[r]; }
-  }
-
+  DynamicsWorkspace workspace;
+  CompositeRigidBodyInertia( A, q, workspace );
   return A;
 
 }
@@ -941,19 +931,409 @@ void robManipulator::JSinertia( double **A,
     return;
   }
 
-  for(size_t c=0; c<links.size(); c++){
-    vctDynamicVector<double> qd( q.size(), 0.0 ); // velocities to zero
-    vctDynamicVector<double> qdd(q.size(), 0.0 ); // accelerations to zero
-    vctFixedSizeVector<double,6> fext(0.0);
-    qdd[c] = 1.0;                                 // ith acceleration to 1
-
-    vctDynamicVector<double> h = RNE( q, qd, qdd, fext, 0  );
+  // the rows of A are not necessarily contiguous
+  vctDynamicMatrix<double> M( links.size(), links.size(), 0.0 );
+  DynamicsWorkspace workspace;
+  CompositeRigidBodyInertia( M, q, workspace );
+  for( size_t c=0; c<links.size(); c++ )
     for( size_t r=0; r<links.size(); r++ )
-      A[c][r] = h[r];
+      A[c][r] = M[r][c];
+
+}
+
+bool robManipulator::JSinertia( vctDynamicMatrix<double>& A,
+                                const vctDynamicVector<double>& q ) const {
+  DynamicsWorkspace workspace;
+  return JSinertia( A, q, workspace );
+}
+
+bool robManipulator::JSinertia( vctDynamicMatrix<double>& A,
+                                const vctDynamicVector<double>& q,
+                                DynamicsWorkspace& workspace ) const {
+
+  if( q.size() != links.size() ||
+      A.rows() != links.size() || A.cols() != links.size() ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << links.size() << " joints. "
+                      << "Got " << q.size() << " values and a "
+                      << A.rows() << "x" << A.cols() << " matrix."
+                      << std::endl;
+    return false;
+  }
+
+  CompositeRigidBodyInertia( A, q, workspace );
+  return true;
+
+}
+
+//////////////////////////////////////
+//         SPATIAL ALGEBRA
+//////////////////////////////////////
+
+// 6D vectors are [angular; linear] and expressed in the link coordinate frame
+// with the link origin as reference point. Featherstone, Rigid Body Dynamics
+// Algorithms, 2008.
+
+// spatial inertia of a link wrt its origin, using the same link model as RNE
+static vctFixedSizeMatrix<double,6,6> SpatialInertia( const robLink& link ){
+
+  double m = link.Mass();
+  vctFixedSizeVector<double,3> s = link.CenterOfMass();
+  vctFixedSizeMatrix<double,3,3> I = link.MomentOfInertia();
+
+  // [s] skew-symmetric matrix of the center of mass
+  vctFixedSizeMatrix<double,3,3> S(  0.0, -s[2],  s[1],
+                                    s[2],   0.0, -s[0],
+                                   -s[1],  s[0],   0.0 );
+  vctFixedSizeMatrix<double,3,3> ISS = I + m * S * S.Transpose();
+
+  vctFixedSizeMatrix<double,6,6> Is( 0.0 );
+  for( size_t r=0; r<3; r++ ){
+    for( size_t c=0; c<3; c++ ){
+      Is[r][c]     = ISS[r][c];
+      Is[r][c+3]   = m*S[r][c];
+      Is[r+3][c]   = m*S[c][r];
+    }
+    Is[r+3][r+3] = m;
+  }
+  return Is;
+}
+
+// X*m: motion vector from the proximal link to the link
+static inline vctFixedSizeVector<double,6>
+TransformMotion( const vctFixedSizeMatrix<double,6,6>& X,
+                 const vctFixedSizeVector<double,6>& m )
+{ return X * m; }
+
+// X'*f: force vector from the link to the proximal link
+static inline vctFixedSizeVector<double,6>
+TransformForce( const vctFixedSizeMatrix<double,6,6>& X,
+                const vctFixedSizeVector<double,6>& f )
+{ return X.TransposeRef() * f; }
+
+// X'*I*X: inertia from the link to the proximal link
+static inline vctFixedSizeMatrix<double,6,6>
+TransformInertia( const vctFixedSizeMatrix<double,6,6>& X,
+                  const vctFixedSizeMatrix<double,6,6>& I )
+{ return X.TransposeRef() * ( I * X ); }
+
+// v x m
+static inline vctFixedSizeVector<double,6>
+CrossMotion( const vctFixedSizeVector<double,6>& v,
+             const vctFixedSizeVector<double,6>& m ){
+  vctFixedSizeVector<double,3> w( v[0], v[1], v[2] ), vl( v[3], v[4], v[5] );
+  vctFixedSizeVector<double,3> mw( m[0], m[1], m[2] ), ml( m[3], m[4], m[5] );
+  vctFixedSizeVector<double,3> rw = w % mw;
+  vctFixedSizeVector<double,3> rl = ( w % ml ) + ( vl % mw );
+  return vctFixedSizeVector<double,6>( rw[0], rw[1], rw[2], rl[0], rl[1], rl[2] );
+}
+
+// v x* f
+static inline vctFixedSizeVector<double,6>
+CrossForce( const vctFixedSizeVector<double,6>& v,
+            const vctFixedSizeVector<double,6>& f ){
+  vctFixedSizeVector<double,3> w( v[0], v[1], v[2] ), vl( v[3], v[4], v[5] );
+  vctFixedSizeVector<double,3> fn( f[0], f[1], f[2] ), fl( f[3], f[4], f[5] );
+  vctFixedSizeVector<double,3> rn = ( w % fn ) + ( vl % fl );
+  vctFixedSizeVector<double,3> rl = w % fl;
+  return vctFixedSizeVector<double,6>( rn[0], rn[1], rn[2], rl[0], rl[1], rl[2] );
+}
+
+void robManipulator::DynamicsWorkspace::Resize( size_t N ){
+  if( X.size() == N ) return;
+  X.resize( N );  S.resize( N );  I.resize( N );
+  v.resize( N );  c.resize( N );  p.resize( N );  U.resize( N );
+  D.resize( N );  u.resize( N );
+  a.resize( N );  f.resize( N );
+  dv.resize( N ); da.resize( N ); df.resize( N );
+}
+
+void
+robManipulator::DynamicsTransformations( const vctDynamicVector<double>& q,
+                                         DynamicsWorkspace& dynamics ) const {
+
+  dynamics.Resize( links.size() );
+
+  vctFixedSizeVector<double,3> z0( 0.0, 0.0, 1.0 );
+
+  for( size_t i=0; i<links.size(); i++ ){
+
+    // evaluate the link transformation once
+    vctFrame4x4<double> Rt = links[i].ForwardKinematics( q[i] );
+    vctMatrixRotation3<double> A( Rt[0][0], Rt[1][0], Rt[2][0],   // iA(i-1)
+                                  Rt[0][1], Rt[1][1], Rt[2][1],
+                                  Rt[0][2], Rt[1][2], Rt[2][2] );
+    vctFixedSizeVector<double,3> ps = A * vctFixedSizeVector<double,3>( Rt[0][3],
+                                                                        Rt[1][3],
+                                                                        Rt[2][3] );
+
+    // X = [ A 0 ; -[ps]A A ]
+    vctFixedSizeMatrix<double,6,6>& X = dynamics.X[i];
+    X.SetAll( 0.0 );
+    for( size_t r=0; r<3; r++ ){
+      for( size_t c=0; c<3; c++ ){
+        X[r][c] = A[r][c];
+        X[r+3][c+3] = A[r][c];
+      }
+    }
+    for( size_t c=0; c<3; c++ ){
+      vctFixedSizeVector<double,3> Ac( A[0][c], A[1][c], A[2][c] );
+      vctFixedSizeVector<double,3> pAc = ps % Ac;
+      X[3][c] = -pAc[0];
+      X[4][c] = -pAc[1];
+      X[5][c] = -pAc[2];
+    }
+
+    // joint axis and a point on the axis in the link coordinate frame
+    vctFixedSizeVector<double,3> z, o;
+    if( links[i].GetConvention() == robKinematics::MODIFIED_DH ||
+        links[i].GetConvention() == robKinematics::MODIFIED_HAYATI ){
+      z = z0;                        // z axis of the link
+      o.SetAll( 0.0 );               // through the origin of the link
+    }
+    else{
+      z = A * z0;                    // z axis of the proximal link
+      o = -ps;                       // through the origin of the proximal link
+    }
+
+    vctFixedSizeVector<double,6>& S = dynamics.S[i];
+    if( links[i].GetType() == robJoint::SLIDER ){
+      S.Assign( 0.0, 0.0, 0.0, z[0], z[1], z[2] );
+    }
+    else{
+      vctFixedSizeVector<double,3> zo = z % ( -o );
+      S.Assign( z[0], z[1], z[2], zo[0], zo[1], zo[2] );
+    }
   }
 
 }
 
+void
+robManipulator::CompositeRigidBodyInertia( vctDynamicMatrixRef<double> A,
+                                           const vctDynamicVector<double>& q,
+                                           DynamicsWorkspace& dynamics ) const {
+
+  if( links.empty() ) return;
+
+  DynamicsTransformations( q, dynamics );
+
+  // composite inertias from the distal links
+  for( size_t i=0; i<links.size(); i++ )
+    { dynamics.I[i] = SpatialInertia( links[i] ); }
+  for( size_t i=links.size()-1; 0<i; i-- )
+    { dynamics.I[i-1] += TransformInertia( dynamics.X[i], dynamics.I[i] ); }
+
+  for( size_t i=0; i<links.size(); i++ ){
+    vctFixedSizeVector<double,6> F = dynamics.I[i] * dynamics.S[i];
+    A[i][i] = vctDotProduct( dynamics.S[i], F );
+    for( size_t j=i; 0<j; j-- ){
+      F = TransformForce( dynamics.X[j], F );
+      A[i][j-1] = A[j-1][i] = vctDotProduct( dynamics.S[j-1], F );
+    }
+  }
+
+}
+
+bool
+robManipulator::ForwardDynamics( vctDynamicVector<double>& qdd,
+                                 const vctDynamicVector<double>& q,
+                                 const vctDynamicVector<double>& qd,
+                                 const vctDynamicVector<double>& tau,
+                                 const vctFixedSizeVector<double,6>& fext,
+                                 double g ) const {
+  DynamicsWorkspace workspace;
+  return ForwardDynamics( qdd, q, qd, tau, fext, workspace, g );
+}
+
+bool
+robManipulator::ForwardDynamics( vctDynamicVector<double>& qdd,
+                                 const vctDynamicVector<double>& q,
+                                 const vctDynamicVector<double>& qd,
+                                 const vctDynamicVector<double>& tau,
+                                 const vctFixedSizeVector<double,6>& fext,
+                                 DynamicsWorkspace& dynamics,
+                                 double g ) const {
+
+  size_t N = links.size();
+  if( q.size() != N || qd.size() != N || tau.size() != N || qdd.size() != N ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << N << " values."
+                      << std::endl;
+    return false;
+  }
+  if( N == 0 ) return true;
+
+  DynamicsTransformations( q, dynamics );
+
+  // Forward recursion: velocities, velocity products and bias forces
+  vctFixedSizeVector<double,6> v( 0.0 );
+  for( size_t i=0; i<N; i++ ){
+    vctFixedSizeVector<double,6> vJ = dynamics.S[i] * qd[i];
+    v = TransformMotion( dynamics.X[i], v ) + vJ;
+    dynamics.v[i] = v;
+    dynamics.c[i] = CrossMotion( v, vJ );
+    dynamics.I[i] = SpatialInertia( links[i] );
+    dynamics.p[i] = CrossForce( v, dynamics.I[i] * v );
+  }
+
+  // external force/moment applied by the TCP (as in RNE)
+  dynamics.p[N-1] += vctFixedSizeVector<double,6>( fext[3], fext[4], fext[5],
+                                                   fext[0], fext[1], fext[2] );
+
+  // Backward recursion: articulated body inertias and bias forces
+  for( int i=(int)N-1; 0<=i; i-- ){
+    dynamics.U[i] = dynamics.I[i] * dynamics.S[i];
+    dynamics.D[i] = vctDotProduct( dynamics.S[i], dynamics.U[i] );
+    dynamics.u[i] = tau[i] - vctDotProduct( dynamics.S[i], dynamics.p[i] );
+    if( 0 < i ){
+      vctFixedSizeMatrix<double,6,6> Ia;
+      Ia.OuterProductOf( dynamics.U[i], dynamics.U[i] );
+      Ia = dynamics.I[i] - Ia * ( 1.0 / dynamics.D[i] );
+      vctFixedSizeVector<double,6> pa = ( dynamics.p[i]
+                                          + Ia * dynamics.c[i]
+                                          + dynamics.U[i] * ( dynamics.u[i] / dynamics.D[i] ) );
+      dynamics.I[i-1] += TransformInertia( dynamics.X[i], Ia );
+      dynamics.p[i-1] += TransformForce( dynamics.X[i], pa );
+    }
+  }
+
+  // Forward recursion: accelerations
+  // the gravity is a fictitious acceleration of the base (as in RNE)
+  vctFixedSizeVector<double,3> z0( 0.0, 0.0, 1.0 );
+  vctMatrixRotation3<double> R( Rtw0[0][0], Rtw0[0][1], Rtw0[0][2],
+                                Rtw0[1][0], Rtw0[1][1], Rtw0[1][2],
+                                Rtw0[2][0], Rtw0[2][1], Rtw0[2][2] );
+  vctFixedSizeVector<double,3> vd0 = R.Transpose() * z0 * g;
+  vctFixedSizeVector<double,6> a( 0.0, 0.0, 0.0, vd0[0], vd0[1], vd0[2] );
+  for( size_t i=0; i<N; i++ ){
+    a = TransformMotion( dynamics.X[i], a ) + dynamics.c[i];
+    qdd[i] = ( dynamics.u[i] - vctDotProduct( dynamics.U[i], a ) ) / dynamics.D[i];
+    a += dynamics.S[i] * qdd[i];
+  }
+
+  return true;
+
+}
+
+bool
+robManipulator::RNEDerivatives( vctDynamicVector<double>& tau,
+                                vctDynamicMatrix<double>& dtaudq,
+                                vctDynamicMatrix<double>& dtaudqd,
+                                const vctDynamicVector<double>& q,
+                                const vctDynamicVector<double>& qd,
+                                const vctDynamicVector<double>& qdd,
+                                const vctFixedSizeVector<double,6>& fext,
+                                double g ) const {
+  DynamicsWorkspace workspace;
+  return RNEDerivatives( tau, dtaudq, dtaudqd, q, qd, qdd, fext, workspace, g );
+}
+
+bool
+robManipulator::RNEDerivatives( vctDynamicVector<double>& tau,
+                                vctDynamicMatrix<double>& dtaudq,
+                                vctDynamicMatrix<double>& dtaudqd,
+                                const vctDynamicVector<double>& q,
+                                const vctDynamicVector<double>& qd,
+                                const vctDynamicVector<double>& qdd,
+                                const vctFixedSizeVector<double,6>& fext,
+                                DynamicsWorkspace& dynamics,
+                                double g ) const {
+
+  size_t N = links.size();
+  if( q.size() != N || qd.size() != N || qdd.size() != N || tau.size() != N ||
+      dtaudq.rows()  != N || dtaudq.cols()  != N ||
+      dtaudqd.rows() != N || dtaudqd.cols() != N ){
+    CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                      << ": Expected " << N << " values."
+                      << std::endl;
+    return false;
+  }
+  if( N == 0 ) return true;
+
+  DynamicsTransformations( q, dynamics );
+
+  // the gravity is a fictitious acceleration of the base (as in RNE)
+  vctFixedSizeVector<double,3> z0( 0.0, 0.0, 1.0 );
+  vctMatrixRotation3<double> R( Rtw0[0][0], Rtw0[0][1], Rtw0[0][2],
+                                Rtw0[1][0], Rtw0[1][1], Rtw0[1][2],
+                                Rtw0[2][0], Rtw0[2][1], Rtw0[2][2] );
+  vctFixedSizeVector<double,3> vd0 = R.Transpose() * z0 * g;
+  vctFixedSizeVector<double,6> a0( 0.0, 0.0, 0.0, vd0[0], vd0[1], vd0[2] );
+
+  // Forward recursion: velocities, accelerations and link forces
+  for( size_t i=0; i<N; i++ ){
+    vctFixedSizeVector<double,6> vJ = dynamics.S[i] * qd[i];
+    vctFixedSizeVector<double,6> vp = ( i == 0 ) ? vctFixedSizeVector<double,6>( 0.0 ) : dynamics.v[i-1];
+    vctFixedSizeVector<double,6> ap = ( i == 0 ) ? a0 : dynamics.a[i-1];
+    dynamics.v[i] = TransformMotion( dynamics.X[i], vp ) + vJ;
+    dynamics.a[i] = ( TransformMotion( dynamics.X[i], ap )
+                      + dynamics.S[i] * qdd[i]
+                      + CrossMotion( dynamics.v[i], vJ ) );
+    dynamics.I[i] = SpatialInertia( links[i] );
+    dynamics.f[i] = ( dynamics.I[i] * dynamics.a[i]
+                      + CrossForce( dynamics.v[i], dynamics.I[i] * dynamics.v[i] ) );
+  }
+
+  // external force/moment applied by the TCP (as in RNE)
+  dynamics.f[N-1] += vctFixedSizeVector<double,6>( fext[3], fext[4], fext[5],
+                                                   fext[0], fext[1], fext[2] );
+
+  // Backward recursion: joint forces/torques
+  for( size_t i=N-1; ; i-- ){
+    tau[i] = vctDotProduct( dynamics.S[i], dynamics.f[i] );
+    if( i == 0 ) break;
+    dynamics.f[i-1] += TransformForce( dynamics.X[i], dynamics.f[i] );
+  }
+
+  // Derivatives wrt q[j] and qd[j]. Joint j only affects the links j..N-1
+  // in the forward recursion. With S expressed in the link frame,
+  // d(X[j]*m)/dq[j] = -S[j] x (X[j]*m) and d(X[j]'*f)/dq[j] = X[j]'*(S[j] x* f)
+  for( size_t j=0; j<N; j++ ){
+    for( int wrtqd=0; wrtqd<2; wrtqd++ ){
+
+      for( size_t i=j; i<N; i++ ){
+        vctFixedSizeVector<double,6> vJ = dynamics.S[i] * qd[i];
+        if( i == j ){
+          if( !wrtqd ){
+            vctFixedSizeVector<double,6> vp = ( i == 0 ) ? vctFixedSizeVector<double,6>( 0.0 ) : dynamics.v[i-1];
+            vctFixedSizeVector<double,6> ap = ( i == 0 ) ? a0 : dynamics.a[i-1];
+            dynamics.dv[i] = -CrossMotion( dynamics.S[i], TransformMotion( dynamics.X[i], vp ) );
+            dynamics.da[i] = ( -CrossMotion( dynamics.S[i], TransformMotion( dynamics.X[i], ap ) )
+                               + CrossMotion( dynamics.dv[i], vJ ) );
+          }
+          else{
+            dynamics.dv[i] = dynamics.S[i];
+            dynamics.da[i] = CrossMotion( dynamics.v[i], dynamics.S[i] );
+          }
+        }
+        else{
+          dynamics.dv[i] = TransformMotion( dynamics.X[i], dynamics.dv[i-1] );
+          dynamics.da[i] = ( TransformMotion( dynamics.X[i], dynamics.da[i-1] )
+                             + CrossMotion( dynamics.dv[i], vJ ) );
+        }
+        dynamics.df[i] = ( dynamics.I[i] * dynamics.da[i]
+                           + CrossForce( dynamics.dv[i], dynamics.I[i] * dynamics.v[i] )
+                           + CrossForce( dynamics.v[i], dynamics.I[i] * dynamics.dv[i] ) );
+      }
+
+      vctDynamicMatrix<double>& dtau = wrtqd ? dtaudqd : dtaudq;
+      vctFixedSizeVector<double,6> df( 0.0 );
+      for( size_t i=N-1; ; i-- ){
+        if( j <= i ) df += dynamics.df[i];
+        dtau[i][j] = vctDotProduct( dynamics.S[i], df );
+        if( i == 0 ) break;
+        if( i == j && !wrtqd )
+          { df += CrossForce( dynamics.S[i], dynamics.f[i] ); }
+        df = TransformForce( dynamics.X[i], df );
+      }
+
+    }
+  }
+
+  return true;
+
+}
+
 // Ac is column major!
 void robManipulator::OSinertia( double Ac[6][6],
                                 const vctDynamicVector<double>& q ) const {
@@ -42,9 +42,7 @@ robQuintic::robQuintic( double t1,
                           << std::endl;
     }
 
-    for( int i=0; i<3; i++ )
-        X.push_back( ComputeParameters( 0    , q1[i], q1d[i], q1dd[i],
-                                        t2-t1, q2[i], q2d[i], q2dd[i] ) );
+    ComputeParameters( t2-t1 );
 
 }
 
@@ -69,7 +67,7 @@ void robQuintic::Set( double t1,
                       const vctDynamicVector<double>& q2dd ){
     robFunctionRn::Set( t1, q1, q1d, q1dd, t2, q2, q2d, q2dd );
 
-    X.clear();
+    X.SetSize( 0, 0 );
     IsSet = false;
     bool problem = false;
 
@@ -85,10 +83,7 @@ void robQuintic::Set( double t1,
         y1.size() == y2.size()   &&
         y1.size() == y2d.size()  &&
         y1.size() == y2dd.size() ){
-
-        for( size_t i=0; i<y1.size(); i++ )
-            X.push_back( ComputeParameters( 0    , y1[i], y1d[i], y1dd[i],
-                                            t2-t1, y2[i], y2d[i], y2dd[i] ) );
+        ComputeParameters( t2-t1 );
     }
     else{
         problem = true;
@@ -175,15 +170,13 @@ void robQuintic::Evaluate( double t,
 
     // Evaluate the N quintics
     if( t1 <= t && t <=t2 ){
-        if( X.size() == 3 ){
-            for( size_t i=0; i<3; i++ ){
-                EvaluateQuintic( t-t1, X[i], y[i], yd[i], ydd[i] );
-            }
+        if( X.cols() == 3 ){
+            EvaluateQuintics( t-t1, y.Pointer(), yd.Pointer(), ydd.Pointer() );
         }
         else{
             CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
                               << ": Not an R3 trajectory. The function contains "
-                              << X.size() << " quintics."
+                              << X.cols() << " quintics."
                               << std::endl;
         }
     }
@@ -240,12 +233,11 @@ void robQuintic::Evaluate( double t,
     // Evaluate the N quintics
     if( t1 <= t && t <=t2 ){
 
-        y.SetSize( X.size() );
-        yd.SetSize( X.size() );
-        ydd.SetSize( X.size() );
+        y.SetSize( X.cols() );
+        yd.SetSize( X.cols() );
+        ydd.SetSize( X.cols() );
 
-        for( size_t i=0; i<X.size(); i++ )
-            { EvaluateQuintic( t-t1, X[i], y[i], yd[i], ydd[i] ); }
+        EvaluateQuintics( t-t1, y.Pointer(), yd.Pointer(), ydd.Pointer() );
     }
 
     // Clip the trajectory at the final values
@@ -270,50 +262,49 @@ void robQuintic::Evaluate( double t,
 
 
 
-vctFixedSizeVector<double,6>
-robQuintic::ComputeParameters( double t1, double q1, double q1d, double q1dd,
-                               double t2, double q2, double q2d, double q2dd ){
-
-    double t10 = 1.0;
-    double t11 = t10*t1;
-    double t12 = t11*t11;
-    double t13 = t12*t11;
-    double t14 = t13*t11;
-    double t15 = t14*t11;
-
-    double t20 = 1.0;
-    double t21 = t20*t2;
-    double t22 = t21*t21;
-    double t23 = t22*t21;
-    double t24 = t23*t21;
-    double t25 = t24*t21;
-
-    vctFixedSizeMatrix<double,6,6,VCT_ROW_MAJOR> A;
+void robQuintic::Evaluate( const vctDynamicVector<double>& t,
+                           vctDynamicMatrix<double>& y,
+                           vctDynamicMatrix<double>& yd,
+                           vctDynamicMatrix<double>& ydd ){
+    if( !IsSet ){
+        CMN_LOG_RUN_ERROR << CMN_LOG_DETAILS
+                          << ": parameters not set"
+                          << std::endl;
+        return;
+    }
 
-    A[0][0]=t10; A[0][1]=t11; A[0][2]=1.0*t12; A[0][3]=1.0*t13; A[0][4]= 1.0*t14; A[0][5]= 1.0*t15;
-    A[1][0]=0.0; A[1][1]=t10; A[1][2]=2.0*t11; A[1][3]=3.0*t12; A[1][4]= 4.0*t13; A[1][5]= 5.0*t14;
-    A[2][0]=0.0; A[2][1]=0.0; A[2][2]=2.0*t10; A[2][3]=6.0*t11; A[2][4]=12.0*t12; A[2][5]=20.0*t13;
-    A[3][0]=t20; A[3][1]=t21; A[3][2]=1.0*t22; A[3][3]=1.0*t23; A[3][4]= 1.0*t24; A[3][5]= 1.0*t25;
-    A[4][0]=0.0; A[4][1]=t20; A[4][2]=2.0*t21; A[4][3]=3.0*t22; A[4][4]= 4.0*t23; A[4][5]= 5.0*t24;
-    A[5][0]=0.0; A[5][1]=0.0; A[5][2]=2.0*t20; A[5][3]=6.0*t21; A[5][4]=12.0*t22; A[5][5]=20.0*t23;
+    y.SetSize( t.size(), X.cols(), VCT_ROW_MAJOR );
+    yd.SetSize( t.size(), X.cols(), VCT_ROW_MAJOR );
+    ydd.SetSize( t.size(), X.cols(), VCT_ROW_MAJOR );
 
-    vctFixedSizeVector<double,6> b;
-    b[0] = q1;   b[1] = q1d;   b[2] = q1dd;
-    b[3] = q2;   b[4] = q2d;   b[5] = q2dd;
+    for( size_t k=0; k<t.size(); k++ ){
 
-    nmrInverseFixedSizeData<6,VCT_ROW_MAJOR> data;
-    nmrInverse( A, data );
+        // Clip the trajectory at the initial and final values
+        if( t[k] < t1 ){
+            y.Row( k ).Assign( y1 );
+            yd.Row( k ).Assign( y1d );
+            ydd.Row( k ).Assign( y1dd );
+        }
+        else if( t2 < t[k] ){
+            y.Row( k ).Assign( y2 );
+            yd.Row( k ).Assign( y2d );
+            ydd.Row( k ).Assign( y2dd );
+        }
+        else{
+            EvaluateQuintics( t[k]-t1,
+                              y.Row( k ).Pointer(),
+                              yd.Row( k ).Pointer(),
+                              ydd.Row( k ).Pointer() );
+        }
 
-    return A*b;
+    }
 
 }
 
 
 
 
-void robQuintic::EvaluateQuintic( double t,
-                                  const vctFixedSizeVector<double,6>& x,
-                                  double& y, double& yd, double& ydd){
+void robQuintic::ComputeParameters( double t ){
 
     double t1 = t;
     double t2 = t1*t1;
@@ -321,8 +312,55 @@ void robQuintic::EvaluateQuintic( double t,
     double t4 = t3*t1;
     double t5 = t4*t1;
 
-    y   =    x[5]*t5 +    x[4]*t4 +   x[3]*t3 +   x[2]*t2 + x[1]*t1 + x[0];
-    yd  =  5*x[5]*t4 +  4*x[4]*t3 + 3*x[3]*t2 + 2*x[2]*t1 + x[1];
-    ydd = 20*x[5]*t3 + 12*x[4]*t2 + 6*x[3]*t1 + 2*x[2];
+    // The system is the same for all the quintics: invert it once
+    vctFixedSizeMatrix<double,6,6,VCT_ROW_MAJOR> A( 0.0 );
+
+    A[0][0]=1.0;
+    A[1][1]=1.0;
+    A[2][2]=2.0;
+    A[3][0]=1.0; A[3][1]=t1;  A[3][2]=    t2; A[3][3]=    t3; A[3][4]=     t4; A[3][5]=     t5;
+    A[4][0]=0.0; A[4][1]=1.0; A[4][2]=2.0*t1; A[4][3]=3.0*t2; A[4][4]= 4.0*t3; A[4][5]= 5.0*t4;
+    A[5][0]=0.0; A[5][1]=0.0; A[5][2]=2.0;    A[5][3]=6.0*t1; A[5][4]=12.0*t2; A[5][5]=20.0*t3;
+
+    nmrInverseFixedSizeData<6,VCT_ROW_MAJOR> data;
+    nmrInverse( A, data );
+
+    const double* b[6] = { y1.Pointer(), y1d.Pointer(), y1dd.Pointer(),
+                           y2.Pointer(), y2d.Pointer(), y2dd.Pointer() };
+
+    X.SetSize( 6, y1.size(), VCT_ROW_MAJOR );
+    X.SetAll( 0.0 );
+    for( size_t k=0; k<6; k++ ){
+        double* x = X.Pointer( k, 0 );
+        for( size_t j=0; j<6; j++ ){
+            const double a = A[k][j];
+            const double* bj = b[j];
+            for( size_t i=0; i<X.cols(); i++ )
+                { x[i] += a*bj[i]; }
+        }
+    }
+
+}
+
+
+
+
+void robQuintic::EvaluateQuintics( double t,
+                                   double* y, double* yd, double* ydd ) const {
+
+    const size_t N = X.cols();
+    const double* x0 = X.Pointer( 0, 0 );
+    const double* x1 = X.Pointer( 1, 0 );
+    const double* x2 = X.Pointer( 2, 0 );
+    const double* x3 = X.Pointer( 3, 0 );
+    const double* x4 = X.Pointer( 4, 0 );
+    const double* x5 = X.Pointer( 5, 0 );
+
+    // Horner's scheme over contiguous coefficients
+    for( size_t i=0; i<N; i++ ){
+        y[i]   = ((((x5[i]*t + x4[i])*t + x3[i])*t + x2[i])*t + x1[i])*t + x0[i];
+        yd[i]  = (((5.0*x5[i]*t + 4.0*x4[i])*t + 3.0*x3[i])*t + 2.0*x2[i])*t + x1[i];
+        ydd[i] = ((20.0*x5[i]*t + 12.0*x4[i])*t + 6.0*x3[i])*t + 2.0*x2[i];
+    }
 
 }
@@ -0,0 +1,165 @@
+/* -*- Mode: C++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*-    */
+/* ex: set filetype=cpp softtabstop=2 shiftwidth=2 tabstop=2 cindent expandtab: */
+
+/*
+  Author(s): agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _robKinematicChain_h
+#define _robKinematicChain_h
+
+#include <vector>
+
+#include <cisstVector/vctTransformationTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+#include <cisstVector/vctDynamicVectorTypes.h>
+
+#include <cisstRobot/robExport.h>
+
+class robManipulator;
+class robLink;
+
+//! Compiled kinematic chain of a manipulator
+/**
+   The transformation of each link is split into a constant part, evaluated
+   once when the chain is compiled, and the joint motion (rotation about or
+   translation along a z axis). For the standard conventions (DH, Hayati) the
+   joint motion is on the proximal side of the constant part and for the
+   modified conventions (modified DH, modified Hayati) it is on the distal
+   side. The chain only composes the joint motions with the constant parts,
+   without virtual calls or temporary frames. Links with other conventions
+   are evaluated through their kinematics.
+
+   The chain is an alternative backend for the forward kinematics and the
+   Jacobians of robManipulator: results are the same as
+   robManipulator::ForwardKinematics, robManipulator::JacobianBody and
+   robManipulator::JacobianSpatial. The base transformation (Rtw0) and the
+   attached tool are read from the manipulator at each evaluation but the
+   chain must be compiled again if the links of the manipulator change. The
+   manipulator must outlive the chain.
+
+   The link frames are evaluated in a workspace. The methods with a
+   workspace argument don't allocate memory once the workspace has been
+   resized, the other ones use a temporary workspace. The chain itself is
+   not modified by the evaluations, so it can be used by several threads
+   as long as each one uses its own workspace.
+*/
+class CISST_EXPORT robKinematicChain {
+
+ public:
+
+  //! Default constructor
+  robKinematicChain();
+
+  //! Compile the kinematic chain of a manipulator
+  robKinematicChain( const robManipulator& manipulator );
+
+  //! Compile the kinematic chain of a manipulator
+  void Compile( const robManipulator& manipulator );
+
+  //! Number of links in the chain
+  size_t size() const { return links.size(); }
+
+  //! Base, link and tool frames wrt the world frame
+  class CISST_EXPORT Workspace{
+  public:
+    //! 3x4 row major frames
+    std::vector<double> frames;
+  };
+
+  //! Evaluate the forward kinematics of every link
+  /**
+     \param[input] q The vector of joint positions
+     \param[output] Rtwi The position and orientation of each link wrt to the
+                         world frame (resized to the number of links)
+     \param workspace The memory used for the evaluation
+     \return false if q does not match the number of links
+  */
+  bool ForwardKinematics( const vctDynamicVector<double>& q,
+                          std::vector<vctFrame4x4<double> >& Rtwi,
+                          Workspace& workspace ) const;
+
+  //! Same as above with a temporary workspace
+  bool ForwardKinematics( const vctDynamicVector<double>& q,
+                          std::vector<vctFrame4x4<double> >& Rtwi ) const;
+
+  //! Evaluate the forward kinematics
+  /**
+     \param[input] q The vector of joint positions
+     \param workspace The memory used for the evaluation
+     \param[input] N The link number (0 => base, negative => end-effector)
+     \return The position and orientation, as a 4x4 frame
+  */
+  vctFrame4x4<double>
+  ForwardKinematics( const vctDynamicVector<double>& q,
+                     Workspace& workspace,
+                     int N = -1 ) const;
+
+  //! Same as above with a temporary workspace
+  vctFrame4x4<double>
+  ForwardKinematics( const vctDynamicVector<double>& q, int N = -1 ) const;
+
+  //! Evaluate the body Jacobian (6xN, linear velocity first)
+  /**
+     \return false if q or J do not match the number of links
+  */
+  bool JacobianBody( const vctDynamicVector<double>& q,
+                     vctDynamicMatrix<double>& J,
+                     Workspace& workspace ) const;
+
+  //! Same as above with a temporary workspace
+  bool JacobianBody( const vctDynamicVector<double>& q,
+                     vctDynamicMatrix<double>& J ) const;
+
+  //! Evaluate the spatial Jacobian (6xN, linear velocity first)
+  /**
+     \return false if q or J do not match the number of links
+  */
+  bool JacobianSpatial( const vctDynamicVector<double>& q,
+                        vctDynamicMatrix<double>& J,
+                        Workspace& workspace ) const;
+
+  //! Same as above with a temporary workspace
+  bool JacobianSpatial( const vctDynamicVector<double>& q,
+                        vctDynamicMatrix<double>& J ) const;
+
+ private:
+
+  //! Constant part and joint motion of a link
+  struct Link{
+    //! Type of joint motion
+    enum Motion{ ROTATION, TRANSLATION, GENERIC };
+    Motion motion;
+    //! True if the joint motion is on the proximal side of the constant part
+    bool proximal;
+    //! Constant part (3x4 row major)
+    double C[3][4];
+    //! Kinematics evaluated when the convention is not supported
+    const robLink* link;
+  };
+
+  const robManipulator* manipulator;
+  std::vector<Link> links;
+
+  //! Evaluate the base frame and the frames of the first N links
+  void Evaluate( const vctDynamicVector<double>& q, size_t N,
+                 Workspace& workspace ) const;
+
+  //! Frame of the tool wrt the last link (identity if there's no tool)
+  bool ToolFrame( const vctDynamicVector<double>& q, bool jacobian,
+                  vctFrame4x4<double>& Rtt ) const;
+
+};
+
+#endif // _robKinematicChain_h
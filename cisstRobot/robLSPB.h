@@ -20,6 +20,7 @@ http://www.cisst.org/cisst/license.txt.
 #define _robLSPB_h
 
 #include <cisstVector/vctDynamicVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
 
 
 // Always include last
@@ -37,22 +38,33 @@ http://www.cisst.org/cisst/license.txt.
 
  It can operate on multiple joints and the user must choose how to
  coordinate the motion.  Current options to coordinate the joint
- trajectories are LSPB_NONE and LSPB_DURATION.  With LSPB_NONE, each
- joint moves as fast as possible.  With LSPB_DURATION, the
- trajectories are scaled so they start and end at the same time based
- on the slowest joint.  It's important to note that acceleration,
- constant velocities and decelaration phases are not coordinated.
+ trajectories are LSPB_NONE, LSPB_DURATION and LSPB_SYNCHRONIZED.
+ With LSPB_NONE, each joint moves as fast as possible.  With
+ LSPB_DURATION, the trajectories are scaled so they start and end at
+ the same time based on the slowest joint.  It's important to note
+ that acceleration, constant velocities and decelaration phases are
+ not coordinated.  With LSPB_SYNCHRONIZED, all joints also finish with
+ the slowest joint but keep their maximum acceleration; the constant
+ velocity of the faster joints is lowered so their motion lasts
+ exactly as long as the slowest joint's.  This is the fastest
+ synchronized motion within the velocity and acceleration limits.
 
  If the user attempt to evaluate a point before the start time, the
  generator returns the start point.  For any time after the end time,
  the generator returns the end point.
 
+ The parameters of all the joints are stored as contiguous arrays,
+ including the start of the deceleration phase and the time scale
+ (1.0 without coordination), and evaluated in a single pass.  A whole
+ trajectory can be evaluated at once over a vector of times (e.g. to
+ preview or plot it) without temporary vectors.
+
  \ingroup cisstRobot
 */
 class CISST_EXPORT robLSPB {
 
  public:
-    typedef enum {LSPB_NONE, LSPB_DURATION} CoordinationType;
+    typedef enum {LSPB_NONE, LSPB_DURATION, LSPB_SYNCHRONIZED} CoordinationType;
 
  protected:
     bool mIsSet;        /*!< To ensure we don't evaluate if the parameters are not set */
@@ -69,9 +81,17 @@ class CISST_EXPORT robLSPB {
         mAcceleration,
         mAccelerationTime,
         mFinishTime,
-        mTimeScale,
+        mDecelerationTime,  /*!< Start of the deceleration phase */
+        mTimeScale,         /*!< 1.0 for all joints unless coordinated */
         mTemp;
 
+    /*! Evaluate all the joints at a given time relative to the start
+      time, output arrays must have mDimension elements. */
+    void EvaluateJoints(const double time,
+                        double * position,
+                        double * velocity,
+                        double * acceleration) const;
+
  public:
     robLSPB(void);
     robLSPB(const vctDoubleVec & start,
@@ -108,6 +128,20 @@ class CISST_EXPORT robLSPB {
     void Evaluate(const double time,
                   vctDoubleVec & position);
 
+    /*! \brief Evaluate the trajectory at multiple times.  Output
+      matrices are resized to one row per time and one column per
+      joint (row major).
+
+      \param times Absolute times, in any order
+    */
+    void Evaluate(const vctDoubleVec & times,
+                  vctDoubleMat & positions,
+                  vctDoubleMat & velocities,
+                  vctDoubleMat & accelerations);
+
+    void Evaluate(const vctDoubleVec & times,
+                  vctDoubleMat & positions);
+
     //! Return start time
     double & StartTime(void);
 
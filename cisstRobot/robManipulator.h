@@ -33,6 +33,8 @@ http://www.cisst.org/cisst/license.txt.
 
 class CISST_EXPORT robManipulator{
 
+  friend class robKinematicChain;
+
  protected:
 
   //! A vector of tools
@@ -153,6 +155,30 @@ class CISST_EXPORT robManipulator{
                     const vctDynamicVector<double>& qd ) const;
 
 
+  //! Per link quantities of the recursive dynamics algorithms
+  /**
+     Spatial (6D) quantities are expressed in the link coordinate frame with
+     the angular part first. A workspace can be passed to the dynamics
+     methods to avoid memory allocations in control loops. It is resized on
+     the first call and must not be shared by concurrent calls.
+  */
+  class CISST_EXPORT DynamicsWorkspace{
+  public:
+    //! Spatial transformations from the proximal link
+    std::vector<vctFixedSizeMatrix<double,6,6> > X;
+    //! Joint motion subspaces
+    std::vector<vctFixedSizeVector<double,6> > S;
+    //! Composite or articulated body inertias
+    std::vector<vctFixedSizeMatrix<double,6,6> > I;
+    //! Velocities, velocity products, bias forces and I*S
+    std::vector<vctFixedSizeVector<double,6> > v, c, p, U;
+    //! S'*I*S and articulated joint forces/torques
+    std::vector<double> D, u;
+    //! Accelerations, forces and their derivatives
+    std::vector<vctFixedSizeVector<double,6> > a, f, dv, da, df;
+    void Resize( size_t N );
+  };
+
   //! Compute the NxN manipulator inertia matrix
   /**
      \param[input] A A pointer to an NxN matrix
@@ -162,6 +188,97 @@ class CISST_EXPORT robManipulator{
 
   vctDynamicMatrix<double> JSinertia( const vctDynamicVector<double>& q ) const;
 
+  //! Compute the NxN manipulator inertia matrix in a preallocated matrix
+  /**
+     Evaluate the joint space inertia matrix with the composite rigid body
+     algorithm (Featherstone, Rigid Body Dynamics Algorithms, 2008). The link
+     transformations are evaluated once and no memory is allocated once the
+     workspace is initialized.
+     \param[output] A The NxN manipulator inertia matrix
+     \param[input] q The joint positions
+     \param workspace The memory used by the algorithm
+     \return false if q or A do not match the number of links
+  */
+  bool JSinertia( vctDynamicMatrix<double>& A,
+                  const vctDynamicVector<double>& q,
+                  DynamicsWorkspace& workspace ) const;
+
+  //! Same as above with a temporary workspace
+  bool JSinertia( vctDynamicMatrix<double>& A,
+                  const vctDynamicVector<double>& q ) const;
+
+  //! Forward dynamics
+  /**
+     Evaluate the joint accelerations resulting from the given joint
+     forces/torques with the articulated body algorithm (Featherstone, Rigid
+     Body Dynamics Algorithms, 2008). This is the inverse of RNE and its cost
+     is linear in the number of links: the joint space inertia matrix is
+     neither evaluated nor factorized.
+     \param[output] qdd The joint accelerations (must have N elements)
+     \param q The joint positions
+     \param qd The joint velocities
+     \param tau The joint forces/torques
+     \param fext An external force/moment acting on the tool control point
+     \param workspace The memory used by the algorithm
+     \param g The gravity acceleration
+     \return false if the vectors do not match the number of links
+  */
+  bool ForwardDynamics( vctDynamicVector<double>& qdd,
+                        const vctDynamicVector<double>& q,
+                        const vctDynamicVector<double>& qd,
+                        const vctDynamicVector<double>& tau,
+                        const vctFixedSizeVector<double,6>& fext,
+                        DynamicsWorkspace& workspace,
+                        double g = 9.81 ) const;
+
+  //! Same as above with a temporary workspace
+  bool ForwardDynamics( vctDynamicVector<double>& qdd,
+                        const vctDynamicVector<double>& q,
+                        const vctDynamicVector<double>& qd,
+                        const vctDynamicVector<double>& tau,
+                        const vctFixedSizeVector<double,6>& fext,
+                        double g = 9.81 ) const;
+
+  //! Recursive Newton-Euler algorithm and its derivatives
+  /**
+     Evaluate the inverse dynamics, as RNE, and its partial derivatives with
+     respect to the joint positions and velocities in the same recursion.
+     The derivatives are propagated analytically through the link
+     velocities, accelerations and forces (O(N^2) operations instead of 2N
+     extra evaluations of RNE for finite differences). The derivative with
+     respect to the joint accelerations is the inertia matrix (see
+     JSinertia).
+     \param[output] tau The joint forces/torques (must have N elements)
+     \param[output] dtaudq The NxN matrix of derivatives wrt q
+     \param[output] dtaudqd The NxN matrix of derivatives wrt qd
+     \param q The joint positions
+     \param qd The joint velocities
+     \param qdd The joint accelerations
+     \param fext An external force/moment acting on the tool control point
+     \param workspace The memory used by the algorithm
+     \param g The gravity acceleration
+     \return false if the vectors or matrices do not match the number of links
+  */
+  bool RNEDerivatives( vctDynamicVector<double>& tau,
+                       vctDynamicMatrix<double>& dtaudq,
+                       vctDynamicMatrix<double>& dtaudqd,
+                       const vctDynamicVector<double>& q,
+                       const vctDynamicVector<double>& qd,
+                       const vctDynamicVector<double>& qdd,
+                       const vctFixedSizeVector<double,6>& fext,
+                       DynamicsWorkspace& workspace,
+                       double g = 9.81 ) const;
+
+  //! Same as above with a temporary workspace
+  bool RNEDerivatives( vctDynamicVector<double>& tau,
+                       vctDynamicMatrix<double>& dtaudq,
+                       vctDynamicMatrix<double>& dtaudqd,
+                       const vctDynamicVector<double>& q,
+                       const vctDynamicVector<double>& qd,
+                       const vctDynamicVector<double>& qdd,
+                       const vctFixedSizeVector<double,6>& fext,
+                       double g = 9.81 ) const;
+
 
   //! Compute the 6x6 manipulator inertia matrix in operation space
   /**
@@ -178,6 +295,17 @@ class CISST_EXPORT robManipulator{
     AddIdentificationColumn( vctDynamicMatrix<double>& J,
                              vctFixedSizeMatrix<double,4,4>& delRt ) const;
 
+protected:
+
+  //! Evaluate the spatial transformations and motion subspaces of each link
+  void DynamicsTransformations( const vctDynamicVector<double>& q,
+                                DynamicsWorkspace& dynamics ) const;
+
+  //! Composite rigid body algorithm
+  void CompositeRigidBodyInertia( vctDynamicMatrixRef<double> A,
+                                  const vctDynamicVector<double>& q,
+                                  DynamicsWorkspace& dynamics ) const;
+
 public:
 
   enum LinkID{ L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, LN };
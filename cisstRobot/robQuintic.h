@@ -21,6 +21,7 @@ http://www.cisst.org/cisst/license.txt.
 #define _robQuintic_h
 
 //#include <cisstVector/vctFixedSizeVector.h>
+#include <cisstVector/vctDynamicMatrix.h>
 #include <cisstRobot/robFunctionRn.h>
 #include <cisstRobot/robExport.h>
 
@@ -29,15 +30,16 @@ class CISST_EXPORT robQuintic : public robFunctionRn {
  private:
 
     bool IsSet;
-    std::vector< vctFixedSizeVector<double,6> > X;     // the quintic parameters
+    // the quintic parameters (6xN, row major): row k holds the coefficients
+    // of t^k of all the quintics
+    vctDynamicMatrix<double> X;
 
-    vctFixedSizeVector<double,6>
-        ComputeParameters( double t1, double y1, double y1d, double y1dd,
-                           double t2, double y2, double y2d, double y2dd );
+    // compute the parameters of all the quintics from y1, y1d, y1dd, y2, y2d
+    // and y2dd for a duration of t
+    void ComputeParameters( double t );
 
-    void EvaluateQuintic( double t,
-                          const vctFixedSizeVector<double,6>& x,
-                          double& y, double& yd, double& ydd);
+    // evaluate all the quintics at time t (relative to t1)
+    void EvaluateQuintics( double t, double* y, double* yd, double* ydd ) const;
 
  public:
 
@@ -72,6 +74,8 @@ class CISST_EXPORT robQuintic : public robFunctionRn {
        Define a N 5th order polynomials passing throuh \f$(t_1,{y}_1^i)\f$ and
        \f$(t_2,{y}_2^i)\f$. The final time \f$t_2\f$ is determined by the
        maximum velocities.  The function is bounded by \f$[t_1, t_2]\f$.
+       All the quintics share \f$[t_1, t_2]\f$: the axes start and finish
+       together.
        \param t1 The initial time
        \param y1 The value \f$\mathbf{y}_1 = Q(t_1)\f$
        \param y1d The value \f$\mathbf{y}'_1 = Q(t_1)\f$
@@ -111,6 +115,17 @@ class CISST_EXPORT robQuintic : public robFunctionRn {
                    vctDynamicVector<double>& yd,
                    vctDynamicVector<double>& ydd );
 
+    //! Evaluate the N quintics at multiple times
+    /**
+       The output matrices are resized to one row per time and one column per
+       quintic (row major). Times outside of [t1, t2] are clipped like for
+       Evaluate.
+       \param t The times
+    */
+    void Evaluate( const vctDynamicVector<double>& t,
+                   vctDynamicMatrix<double>& y,
+                   vctDynamicMatrix<double>& yd,
+                   vctDynamicMatrix<double>& ydd );
 
     void Blend( robFunction* function,
                 const vctDynamicVector<double>& qdmax,
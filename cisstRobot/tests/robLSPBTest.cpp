@@ -0,0 +1,102 @@
+#include <cisstRobot/robLSPB.h>
+
+#include "robLSPBTest.h"
+
+static void SetLSPBTestParameters( vctDoubleVec& start,
+                                   vctDoubleVec& finish,
+                                   vctDoubleVec& velocity,
+                                   vctDoubleVec& acceleration ){
+  start.SetSize( 4 );
+  finish.SetSize( 4 );
+  velocity.SetSize( 4 );
+  acceleration.SetSize( 4 );
+  // short triangular move, trapezoidal moves (one backward) and a joint
+  // that doesn't move
+  start.Assign(        0.0, 1.0,  2.0, 3.0 );
+  finish.Assign(       1.0, 1.5, -2.0, 3.0 );
+  velocity.Assign(     1.0, 1.0,  2.0, 1.0 );
+  acceleration.Assign( 2.0, 1.0,  4.0, 1.0 );
+}
+
+void robLSPBTest::TestBoundaryConditions( robLSPB::CoordinationType coordination ){
+
+  vctDoubleVec start, finish, velocity, acceleration;
+  SetLSPBTestParameters( start, finish, velocity, acceleration );
+
+  const double t0 = 2.0;
+  robLSPB lspb( start, finish, velocity, acceleration, t0, coordination );
+  const double tf = t0 + lspb.Duration();
+
+  vctDoubleVec q( 4 ), qd( 4 ), qdd( 4 );
+
+  lspb.Evaluate( t0, q, qd, qdd );
+  CPPUNIT_ASSERT( q.AlmostEqual( start, 1e-12 ) );
+  CPPUNIT_ASSERT( qd.AlmostEqual( vctDoubleVec( 4, 0.0 ), 1e-12 ) );
+  CPPUNIT_ASSERT( qdd.AlmostEqual( vctDoubleVec( 4, 0.0 ), 1e-12 ) );
+
+  lspb.Evaluate( tf, q, qd, qdd );
+  CPPUNIT_ASSERT( q.AlmostEqual( finish, 1e-12 ) );
+  CPPUNIT_ASSERT( qd.AlmostEqual( vctDoubleVec( 4, 0.0 ), 1e-12 ) );
+  CPPUNIT_ASSERT( qdd.AlmostEqual( vctDoubleVec( 4, 0.0 ), 1e-12 ) );
+
+  // the batch evaluation matches
+  vctDoubleVec times( 2 );
+  times.Assign( t0, tf );
+  vctDoubleMat Q, Qd, Qdd;
+  lspb.Evaluate( times, Q, Qd, Qdd );
+  CPPUNIT_ASSERT( Q.Row( 0 ).AlmostEqual( start, 1e-12 ) );
+  CPPUNIT_ASSERT( Q.Row( 1 ).AlmostEqual( finish, 1e-12 ) );
+  CPPUNIT_ASSERT( Qd.AlmostEqual( vctDoubleMat( 2, 4, 0.0 ), 1e-12 ) );
+  CPPUNIT_ASSERT( Qdd.AlmostEqual( vctDoubleMat( 2, 4, 0.0 ), 1e-12 ) );
+
+}
+
+void robLSPBTest::TestBoundaryConditions(){
+  TestBoundaryConditions( robLSPB::LSPB_NONE );
+  TestBoundaryConditions( robLSPB::LSPB_SYNCHRONIZED );
+}
+
+void robLSPBTest::TestSynchronized(){
+
+  vctDoubleVec start, finish, velocity, acceleration;
+  SetLSPBTestParameters( start, finish, velocity, acceleration );
+
+  robLSPB fastest( start, finish, velocity, acceleration, 0.0, robLSPB::LSPB_NONE );
+  robLSPB lspb( start, finish, velocity, acceleration, 0.0, robLSPB::LSPB_SYNCHRONIZED );
+
+  // the slowest joint sets the duration
+  const double T = lspb.Duration();
+  CPPUNIT_ASSERT_DOUBLES_EQUAL( fastest.Duration(), T, 1e-12 );
+
+  vctDoubleVec q( 4 ), qd( 4 ), qdd( 4 );
+  vctDoubleVec qp( 4 ), qm( 4 );
+  const double h = 1e-6;
+
+  for( size_t k=1; k<1000; k++ ){
+    const double t = T * k / 1000.0;
+    lspb.Evaluate( t, q, qd, qdd );
+    lspb.Evaluate( t + h, qp );
+    lspb.Evaluate( t - h, qm );
+    for( size_t i=0; i<4; i++ ){
+      // within the limits
+      CPPUNIT_ASSERT( fabs( qd[i] ) <= velocity[i] + 1e-12 );
+      CPPUNIT_ASSERT( fabs( qdd[i] ) <= acceleration[i] + 1e-12 );
+      // the velocity is the derivative of the position
+      CPPUNIT_ASSERT_DOUBLES_EQUAL( qd[i], ( qp[i] - qm[i] ) / ( 2.0 * h ), 1e-5 );
+    }
+  }
+
+  // every joint that moves keeps its maximum acceleration and is still
+  // moving just before the end
+  lspb.Evaluate( 1e-3 * T, q, qd, qdd );
+  for( size_t i=0; i<3; i++ )
+    { CPPUNIT_ASSERT_DOUBLES_EQUAL( acceleration[i], fabs( qdd[i] ), 1e-12 ); }
+  lspb.Evaluate( ( 1.0 - 1e-3 ) * T, q, qd, qdd );
+  for( size_t i=0; i<3; i++ ){
+    CPPUNIT_ASSERT( q[i] != finish[i] );
+    CPPUNIT_ASSERT( qd[i] != 0.0 );
+  }
+
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( robLSPBTest );
@@ -0,0 +1,24 @@
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstRobot/robLSPB.h>
+
+class robLSPBTest : public CppUnit::TestFixture {
+
+private:
+
+  CPPUNIT_TEST_SUITE( robLSPBTest );
+
+  CPPUNIT_TEST(TestBoundaryConditions);
+  CPPUNIT_TEST(TestSynchronized);
+
+  CPPUNIT_TEST_SUITE_END();
+
+  void TestBoundaryConditions( robLSPB::CoordinationType coordination );
+
+public:
+
+  void TestBoundaryConditions();
+  void TestSynchronized();
+
+};
@@ -2,6 +2,8 @@
 
 #include <cisstCommon/cmnPath.h>
 #include <cisstRobot/robManipulator.h>
+#include <cisstRobot/robKinematicChain.h>
+#include <cisstRobot/robModifiedDH.h>
 #include "robManipulatorTest.h"
 
 #include "robRobotsKinematics.h"
@@ -79,4 +81,215 @@ void robManipulatorTest::TestInverseDynamics(){
 
 }
 
+void robManipulatorTest::TestJSinertia(){
+    cmnPath path;
+    path.AddRelativeToCisstShare("/models/WAM");
+    std::string fname = path.Find("wam7.rob", cmnPath::READ);
+
+    robManipulator WAM7( fname );
+    robManipulator::DynamicsWorkspace workspace;
+
+  for( size_t i=0; i<10; i++ ){
+
+    vctDynamicVector<double> q = RandomWAMVector();
+
+    // each column of the inertia matrix is RNE with a unit acceleration
+    vctDynamicMatrix<double> A( 7, 7, 0.0 );
+    for( size_t c=0; c<7; c++ ){
+      vctDynamicVector<double> qd( 7, 0.0 ), qdd( 7, 0.0 );
+      qdd[c] = 1.0;
+      vctDynamicVector<double> h = WAM7.RNE( q, qd, qdd, vctFixedSizeVector<double,6>(0.0), 0.0 );
+      for( size_t r=0; r<7; r++ ) { A[r][c] = h[r]; }
+    }
+
+    vctDynamicMatrix<double> M( 7, 7, 0.0 );
+    CPPUNIT_ASSERT( WAM7.JSinertia( M, q ) );
+    CPPUNIT_ASSERT( M.AlmostEqual( A, 1e-9 ) );
+    CPPUNIT_ASSERT( M.AlmostEqual( M.Transpose(), 1e-12 ) );
+    CPPUNIT_ASSERT( WAM7.JSinertia( q ).AlmostEqual( A, 1e-9 ) );
+
+    // rows allocated separately
+    std::vector<vctDynamicVector<double> > rows( 7, vctDynamicVector<double>( 7, 0.0 ) );
+    double* Ap[7];
+    for( size_t r=0; r<7; r++ ) { Ap[r] = rows[r].Pointer(); }
+    WAM7.JSinertia( Ap, q );
+    for( size_t r=0; r<7; r++ )
+      for( size_t c=0; c<7; c++ )
+        { CPPUNIT_ASSERT_DOUBLES_EQUAL( A[r][c], Ap[r][c], 1e-9 ); }
+
+    // reused workspace
+    M.SetAll( 0.0 );
+    CPPUNIT_ASSERT( WAM7.JSinertia( M, q, workspace ) );
+    CPPUNIT_ASSERT( M.AlmostEqual( A, 1e-9 ) );
+  }
+
+  vctDynamicMatrix<double> M( 6, 7, 0.0 );
+  CPPUNIT_ASSERT( !WAM7.JSinertia( M, RandomWAMVector() ) );
+
+}
+
+void robManipulatorTest::TestForwardDynamics(){
+    cmnPath path;
+    path.AddRelativeToCisstShare("/models/WAM");
+    std::string fname = path.Find("wam7.rob", cmnPath::READ);
+
+    robManipulator WAM7( fname );
+    robManipulator::DynamicsWorkspace workspace;
+
+  for( size_t i=0; i<10; i++ ){
+
+    vctDynamicVector<double> q = RandomWAMVector();
+    vctDynamicVector<double> qd = RandomWAMVector();
+    vctDynamicVector<double> tau = RandomWAMVector();
+    vctFixedSizeVector<double,6> ft( 1.0, -2.0, 3.0, 0.1, 0.2, -0.3 );
+
+    // RNE of the accelerations must give back the torques
+    vctDynamicVector<double> qdd( 7, 0.0 );
+    CPPUNIT_ASSERT( WAM7.ForwardDynamics( qdd, q, qd, tau, ft ) );
+    CPPUNIT_ASSERT( WAM7.RNE( q, qd, qdd, ft ).AlmostEqual( tau, 1e-9 ) );
+
+    // reused workspace
+    vctDynamicVector<double> qddw( 7, 0.0 );
+    CPPUNIT_ASSERT( WAM7.ForwardDynamics( qddw, q, qd, tau, ft, workspace ) );
+    CPPUNIT_ASSERT( qddw.AlmostEqual( qdd, 1e-12 ) );
+  }
+
+  vctDynamicVector<double> qdd( 6, 0.0 );
+  CPPUNIT_ASSERT( !WAM7.ForwardDynamics( qdd,
+                                         RandomWAMVector(),
+                                         RandomWAMVector(),
+                                         RandomWAMVector(),
+                                         vctFixedSizeVector<double,6>(0.0) ) );
+
+}
+
+void robManipulatorTest::TestRNEDerivatives(){
+    cmnPath path;
+    path.AddRelativeToCisstShare("/models/WAM");
+    std::string fname = path.Find("wam7.rob", cmnPath::READ);
+
+    robManipulator WAM7( fname );
+    robManipulator::DynamicsWorkspace workspace;
+
+  for( size_t i=0; i<10; i++ ){
+
+    vctDynamicVector<double> q = RandomWAMVector();
+    vctDynamicVector<double> qd = RandomWAMVector();
+    vctDynamicVector<double> qdd = RandomWAMVector();
+    vctFixedSizeVector<double,6> ft( 1.0, -2.0, 3.0, 0.1, 0.2, -0.3 );
+
+    vctDynamicVector<double> tau( 7, 0.0 );
+    vctDynamicMatrix<double> dtaudq( 7, 7, 0.0 ), dtaudqd( 7, 7, 0.0 );
+    CPPUNIT_ASSERT( WAM7.RNEDerivatives( tau, dtaudq, dtaudqd, q, qd, qdd, ft ) );
+    CPPUNIT_ASSERT( WAM7.RNE( q, qd, qdd, ft ).AlmostEqual( tau, 1e-9 ) );
+
+    // reused workspace
+    vctDynamicVector<double> tauw( 7, 0.0 );
+    vctDynamicMatrix<double> dtaudqw( 7, 7, 0.0 ), dtaudqdw( 7, 7, 0.0 );
+    CPPUNIT_ASSERT( WAM7.RNEDerivatives( tauw, dtaudqw, dtaudqdw, q, qd, qdd, ft, workspace ) );
+    CPPUNIT_ASSERT( tauw.AlmostEqual( tau, 1e-12 ) );
+    CPPUNIT_ASSERT( dtaudqw.AlmostEqual( dtaudq, 1e-12 ) );
+    CPPUNIT_ASSERT( dtaudqdw.AlmostEqual( dtaudqd, 1e-12 ) );
+
+    // central finite differences of RNE
+    const double h = 1e-6;
+    for( size_t c=0; c<7; c++ ){
+      vctDynamicVector<double> qp( q ), qm( q ), qdp( qd ), qdm( qd );
+      qp[c] += h;  qm[c] -= h;
+      qdp[c] += h; qdm[c] -= h;
+      vctDynamicVector<double> dq  = ( WAM7.RNE( qp, qd, qdd, ft ) -
+                                       WAM7.RNE( qm, qd, qdd, ft ) ) / ( 2.0*h );
+      vctDynamicVector<double> dqd = ( WAM7.RNE( q, qdp, qdd, ft ) -
+                                       WAM7.RNE( q, qdm, qdd, ft ) ) / ( 2.0*h );
+      for( size_t r=0; r<7; r++ ){
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( dq[r],  dtaudq[r][c],  1e-6 );
+        CPPUNIT_ASSERT_DOUBLES_EQUAL( dqd[r], dtaudqd[r][c], 1e-6 );
+      }
+    }
+  }
+
+}
+
+void robManipulatorTest::TestKinematicChain(){
+    cmnPath path;
+    path.AddRelativeToCisstShare("/models/WAM");
+    std::string fname = path.Find("wam7.rob", cmnPath::READ);
+
+    robManipulator WAM7( fname );
+
+  // chain with both conventions and sliders
+  std::vector<robKinematics*> kinematics;
+  robJoint hinge( robJoint::HINGE, robJoint::ACTIVE, 0.1, -3.0, 3.0, 100.0 );
+  robJoint slider( robJoint::SLIDER, robJoint::ACTIVE, 0.2, -1.0, 1.0, 100.0 );
+  kinematics.push_back( new robDH( -cmnPI_2, 0.1, 0.0, 0.3, hinge ) );
+  kinematics.push_back( new robModifiedDH( cmnPI_2, 0.2, 0.3, 0.1, hinge ) );
+  kinematics.push_back( new robModifiedDH( 0.4, 0.05, 0.1, 0.0, slider ) );
+  kinematics.push_back( new robDH( -0.7, 0.1, 0.2, 0.0, slider ) );
+  kinematics.push_back( new robDH( 0.0, 0.0, 0.0, 0.1, hinge ) );
+  vctFrame4x4<double> Rtw0( vctMatrixRotation3<double>( vctAxisAngleRotation3<double>( vctFixedSizeVector<double,3>( 0.0, 0.6, 0.8 ), 0.4 ) ),
+                            vctFixedSizeVector<double,3>( 0.1, 0.2, 0.3 ) );
+  robManipulator mixed( kinematics, Rtw0 );
+
+  // tool attached to each manipulator after testing it without the tool
+  robManipulator tool( vctFrame4x4<double>( vctMatrixRotation3<double>( vctAxisAngleRotation3<double>( vctFixedSizeVector<double,3>( 1.0, 0.0, 0.0 ), 0.3 ) ),
+                                            vctFixedSizeVector<double,3>( 0.0, 0.0, 0.1 ) ) );
+
+  robManipulator* manipulators[2] = { &WAM7, &mixed };
+  for( size_t m=0; m<2; m++ ){
+  for( size_t t=0; t<2; t++ ){
+
+    robManipulator& manipulator = *manipulators[m];
+    if( t == 1 ) { manipulator.Attach( &tool ); }
+
+    robKinematicChain chain( manipulator );
+    robKinematicChain::Workspace workspace;
+    size_t N = manipulator.links.size();
+    CPPUNIT_ASSERT( chain.size() == N );
+
+    for( size_t i=0; i<10; i++ ){
+
+      vctDynamicVector<double> q( N, 0.0 );
+      for( size_t j=0; j<N; j++ )
+        { q[j] = 2.0 * ((double)rand()) / ( (double) RAND_MAX ) - 1.0; }
+
+      for( int n=-1; n<=(int)N; n++ ){
+        CPPUNIT_ASSERT( chain.ForwardKinematics( q, n ).AlmostEqual( manipulator.ForwardKinematics( q, n ), 1e-12 ) );
+      }
+
+      // the frames of the links don't include the tool
+      std::vector<vctFrame4x4<double> > Rtwi;
+      CPPUNIT_ASSERT( chain.ForwardKinematics( q, Rtwi ) );
+      CPPUNIT_ASSERT( Rtwi.size() == N );
+      if( t == 0 ){
+        for( size_t j=0; j<N; j++ )
+          { CPPUNIT_ASSERT( Rtwi[j].AlmostEqual( manipulator.ForwardKinematics( q, j+1 ), 1e-12 ) ); }
+      }
+
+      vctDynamicMatrix<double> J( 6, N, 0.0 ), Jc( 6, N, 0.0 );
+      manipulator.JacobianBody( q, J );
+      CPPUNIT_ASSERT( chain.JacobianBody( q, Jc ) );
+      CPPUNIT_ASSERT( Jc.AlmostEqual( J, 1e-12 ) );
+      manipulator.JacobianSpatial( q, J );
+      CPPUNIT_ASSERT( chain.JacobianSpatial( q, Jc ) );
+      CPPUNIT_ASSERT( Jc.AlmostEqual( J, 1e-12 ) );
+
+      // reused workspace
+      CPPUNIT_ASSERT( chain.JacobianSpatial( q, Jc, workspace ) );
+      CPPUNIT_ASSERT( Jc.AlmostEqual( J, 1e-12 ) );
+      manipulator.JacobianBody( q, J );
+      CPPUNIT_ASSERT( chain.JacobianBody( q, Jc, workspace ) );
+      CPPUNIT_ASSERT( Jc.AlmostEqual( J, 1e-12 ) );
+      CPPUNIT_ASSERT( chain.ForwardKinematics( q, workspace ).AlmostEqual( manipulator.ForwardKinematics( q ), 1e-12 ) );
+    }
+
+    vctDynamicMatrix<double> J( 6, N+1, 0.0 );
+    CPPUNIT_ASSERT( !chain.JacobianBody( vctDynamicVector<double>( N, 0.0 ), J ) );
+    std::vector<vctFrame4x4<double> > Rtwi;
+    CPPUNIT_ASSERT( !chain.ForwardKinematics( vctDynamicVector<double>( N+1, 0.0 ), Rtwi ) );
+
+  }
+  }
+
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION( robManipulatorTest );
@@ -14,6 +14,11 @@ private:
   CPPUNIT_TEST(TestInverseKinematics);
 
   //CPPUNIT_TEST(TestInverseDynamics);
+  CPPUNIT_TEST(TestJSinertia);
+  CPPUNIT_TEST(TestForwardDynamics);
+  CPPUNIT_TEST(TestRNEDerivatives);
+
+  CPPUNIT_TEST(TestKinematicChain);
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -26,5 +31,11 @@ public:
   
   void TestInverseDynamics();
 
+  void TestJSinertia();
+  void TestForwardDynamics();
+  void TestRNEDerivatives();
+
+  void TestKinematicChain();
+
 };
 
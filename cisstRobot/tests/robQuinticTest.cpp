@@ -0,0 +1,61 @@
+#include <cisstRobot/robQuintic.h>
+
+#include "robQuinticTest.h"
+
+static robQuintic QuinticTestFunction(){
+  vctDynamicVector<double> y1( 4 ), y1d( 4 ), y1dd( 4 );
+  vctDynamicVector<double> y2( 4 ), y2d( 4 ), y2dd( 4 );
+  y1.Assign(   0.0, 1.0, -1.0,  2.0 );
+  y1d.Assign(  0.5, 0.0, -0.2,  0.0 );
+  y1dd.Assign( 0.0, 0.1,  0.0, -0.3 );
+  y2.Assign(   1.0,-1.0,  2.0,  2.0 );
+  y2d.Assign(  0.0, 0.3,  0.0, -0.1 );
+  y2dd.Assign( 0.2, 0.0,  0.0,  0.0 );
+  return robQuintic( 1.0, y1, y1d, y1dd, 3.0, y2, y2d, y2dd );
+}
+
+void robQuinticTest::TestBoundaryConditions(){
+
+  robQuintic quintic = QuinticTestFunction();
+
+  vctDynamicVector<double> y1, y1d, y1dd, y2, y2d, y2dd;
+  quintic.InitialState( y1, y1d, y1dd );
+  quintic.FinalState( y2, y2d, y2dd );
+
+  vctDynamicVector<double> y, yd, ydd;
+
+  quintic.Evaluate( 1.0, y, yd, ydd );
+  CPPUNIT_ASSERT( y.AlmostEqual( y1, 1e-9 ) );
+  CPPUNIT_ASSERT( yd.AlmostEqual( y1d, 1e-9 ) );
+  CPPUNIT_ASSERT( ydd.AlmostEqual( y1dd, 1e-9 ) );
+
+  quintic.Evaluate( 3.0, y, yd, ydd );
+  CPPUNIT_ASSERT( y.AlmostEqual( y2, 1e-9 ) );
+  CPPUNIT_ASSERT( yd.AlmostEqual( y2d, 1e-9 ) );
+  CPPUNIT_ASSERT( ydd.AlmostEqual( y2dd, 1e-9 ) );
+
+}
+
+void robQuinticTest::TestBatchEvaluate(){
+
+  robQuintic quintic = QuinticTestFunction();
+
+  // before, at the bounds, inside and after
+  vctDynamicVector<double> t( 6 );
+  t.Assign( 0.5, 1.0, 1.7, 2.4, 3.0, 3.5 );
+
+  vctDynamicMatrix<double> Y, Yd, Ydd;
+  quintic.Evaluate( t, Y, Yd, Ydd );
+  CPPUNIT_ASSERT( Y.rows() == 6 && Y.cols() == 4 );
+
+  vctDynamicVector<double> y, yd, ydd;
+  for( size_t k=0; k<t.size(); k++ ){
+    quintic.Evaluate( t[k], y, yd, ydd );
+    CPPUNIT_ASSERT( Y.Row( k ).AlmostEqual( y, 1e-12 ) );
+    CPPUNIT_ASSERT( Yd.Row( k ).AlmostEqual( yd, 1e-12 ) );
+    CPPUNIT_ASSERT( Ydd.Row( k ).AlmostEqual( ydd, 1e-12 ) );
+  }
+
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( robQuinticTest );
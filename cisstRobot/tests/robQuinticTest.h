@@ -0,0 +1,22 @@
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstRobot/robQuintic.h>
+
+class robQuinticTest : public CppUnit::TestFixture {
+
+private:
+
+  CPPUNIT_TEST_SUITE( robQuinticTest );
+
+  CPPUNIT_TEST(TestBoundaryConditions);
+  CPPUNIT_TEST(TestBatchEvaluate);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  void TestBoundaryConditions();
+  void TestBatchEvaluate();
+
+};
@@ -21,6 +21,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstStereoVision/svlBufferImage.h>
 #include <cisstStereoVision/svlConverters.h>
+#include "svlTripleBufferIndex.h"
 #include <cisstOSAbstraction/osaSleep.h>
 #include <string.h> // for memcpy
 
@@ -43,9 +44,7 @@ svlBufferImage::svlBufferImage(unsigned int width, unsigned int height)
     cvSetData(OCVImage[2], Buffer[2].Pointer(), width * 3);
 #endif // CISST_SVL_HAS_OPENCV
 
-    Latest = 0;
-    Next = 1;
-    Locked = 2;
+    Index = new svlTripleBufferIndex;
     InitializationCounter = 60;
 }
 
@@ -56,6 +55,8 @@ svlBufferImage::~svlBufferImage()
     cvReleaseImageHeader(&(OCVImage[1]));
     cvReleaseImageHeader(&(OCVImage[2]));
 #endif // CISST_SVL_HAS_OPENCV
+
+    delete Index;
 }
 
 unsigned int svlBufferImage::GetWidth()
@@ -75,31 +76,18 @@ unsigned int svlBufferImage::GetDataSize()
 
 unsigned char* svlBufferImage::GetPushBuffer()
 {
-    return Buffer[Next].Pointer();
+    return Buffer[Index->GetNext()].Pointer();
 }
 
 unsigned char* svlBufferImage::GetPushBuffer(unsigned int& size)
 {
     size = GetDataSize();
-    return Buffer[Next].Pointer();
+    return Buffer[Index->GetNext()].Pointer();
 }
 
 void svlBufferImage::Push()
 {
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Next = InterlockedExchange(&Latest, Next);
-#endif
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Next;
-        Next = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
-
-    NewFrameEvent.Raise();
+    Index->Publish();
 }
 
 bool svlBufferImage::Push(const unsigned char* buffer, unsigned int size, bool topdown)
@@ -110,23 +98,11 @@ bool svlBufferImage::Push(const unsigned char* buffer, unsigned int size, bool t
     bool ret = true;
 
     // Copy image to buffer
-    if (topdown) ret = TopDownCopy(Buffer[Next].Pointer(), buffer);
-    else memcpy(Buffer[Next].Pointer(), buffer, datasize);
-
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Next = InterlockedExchange(&Latest, Next);
-#endif
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Next;
-        Next = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
+    unsigned char* next = Buffer[Index->GetNext()].Pointer();
+    if (topdown) ret = TopDownCopy(next, buffer);
+    else memcpy(next, buffer, datasize);
 
-    NewFrameEvent.Raise();
+    Index->Publish();
 
     return ret;
 }
@@ -183,9 +159,10 @@ bool svlBufferImage::PushIplImage(IplImage* image)
 
 svlImageRGB* svlBufferImage::Pull(bool waitfornew, double timeout)
 {
-    if (!waitfornew) return &(Buffer[Latest]);
+    // Without waiting: peek at the latest frame, nothing is consumed
+    if (!waitfornew) return &(Buffer[Index->GetLatest()]);
 
-    if (!NewFrameEvent.Wait(0.0)) {
+    if (!Index->IsNewAvailable()) {
         if (InitializationCounter > 0) {
             // It might take some time to start up the stream in the beginning.
             // Let the method return with a blank image while waiting for
@@ -194,7 +171,7 @@ svlImageRGB* svlBufferImage::Pull(bool waitfornew, double timeout)
             osaSleep(0.033);
         }
         else {
-            if (!NewFrameEvent.Wait(timeout)) return 0;
+            if (!Index->Wait(timeout)) return 0;
         }
     }
     else {
@@ -202,30 +179,31 @@ svlImageRGB* svlBufferImage::Pull(bool waitfornew, double timeout)
         InitializationCounter = 0;
     }
 
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Locked = InterlockedExchange(&Latest, Locked);
-#endif
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Locked;
-        Locked = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
+    // Returns the last frame pulled if there is still no new one
+    Index->Acquire();
 
-    return &(Buffer[Locked]);
+    return &(Buffer[Index->GetLocked()]);
 }
 
 #if CISST_SVL_HAS_OPENCV
 IplImage* svlBufferImage::PullIplImage(bool waitfornew, double timeout)
 {
-    if (Pull(waitfornew, timeout) == 0) return 0;
-    return OCVImage[Locked];
+    svlImageRGB* image = Pull(waitfornew, timeout);
+    if (image == 0) return 0;
+    return OCVImage[image - Buffer];
 }
 #endif // CISST_SVL_HAS_OPENCV
 
+unsigned int svlBufferImage::GetOverwriteCount() const
+{
+    return Index->GetOverwriteCount();
+}
+
+unsigned int svlBufferImage::GetWaitCount() const
+{
+    return Index->GetWaitCount();
+}
+
 bool svlBufferImage::TopDownCopy(unsigned char *targetbuffer, const unsigned char *sourcebuffer)
 {
     if (targetbuffer == 0 ||
@@ -20,6 +20,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlBufferSample.h>
+#include "svlTripleBufferIndex.h"
 
 
 /*********************************/
@@ -32,9 +33,7 @@ svlBufferSample::svlBufferSample(svlStreamType type)
     Buffer[1] = svlSample::GetNewFromType(type);
     Buffer[2] = svlSample::GetNewFromType(type);
 
-    Latest = 0;
-    Next = 1;
-    Locked = 2;
+    Index = new svlTripleBufferIndex;
 }
 
 svlBufferSample::svlBufferSample(const svlSample &sample)
@@ -47,9 +46,7 @@ svlBufferSample::svlBufferSample(const svlSample &sample)
     Buffer[1]->SetSize(sample);
     Buffer[2]->SetSize(sample);
 
-    Latest = 0;
-    Next = 1;
-    Locked = 2;
+    Index = new svlTripleBufferIndex;
 }
 
 svlBufferSample::~svlBufferSample()
@@ -57,6 +54,7 @@ svlBufferSample::~svlBufferSample()
     delete Buffer[0];
     delete Buffer[1];
     delete Buffer[2];
+    delete Index;
 }
 
 svlStreamType svlBufferSample::GetType() const
@@ -66,68 +64,40 @@ svlStreamType svlBufferSample::GetType() const
 
 int svlBufferSample::Push(const svlSample* sample)
 {
-    int ret = Buffer[Next]->CopyOf(sample);
-
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Next = InterlockedExchange(&Latest, Next);
-#endif
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Next;
-        Next = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
-
-    NewSampleEvent.Raise();
-
+    int ret = Buffer[Index->GetNext()]->CopyOf(sample);
+    Index->Publish();
     return ret;
 }
 
 svlSample* svlBufferSample::Pull(bool waitfornew, double timeout)
 {
-    if (!waitfornew) return Buffer[Latest];
-
-    if (!NewSampleEvent.Wait(timeout)) return 0;
+    // Without waiting: peek at the latest sample, nothing is consumed
+    if (!waitfornew) return Buffer[Index->GetLatest()];
 
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Locked = InterlockedExchange(&Latest, Locked);
-#endif
+    if (!Index->Wait(timeout)) return 0;
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Locked;
-        Locked = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
+    Index->Acquire();
 
-    return Buffer[Locked];
+    return Buffer[Index->GetLocked()];
 }
 
 svlSample* svlBufferSample::GetPushBuffer()
 {
-    return Buffer[Next];
+    return Buffer[Index->GetNext()];
 }
 
 void svlBufferSample::Push()
 {
-    // Atomic exchange of values
-#if (CISST_OS == CISST_WINDOWS)
-    Next = InterlockedExchange(&Latest, Next);
-#endif
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    CS.Enter();
-        int ti = Next;
-        Next = Latest;
-        Latest = ti;
-    CS.Leave();
-#endif
-
-    NewSampleEvent.Raise();
+    Index->Publish();
+}
+
+unsigned int svlBufferSample::GetOverwriteCount() const
+{
+    return Index->GetOverwriteCount();
+}
+
+unsigned int svlBufferSample::GetWaitCount() const
+{
+    return Index->GetWaitCount();
 }
 
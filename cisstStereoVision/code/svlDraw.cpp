@@ -684,7 +684,8 @@ svlDraw::WarpMT::WarpMT(unsigned int thread_count)
 
 void svlDraw::WarpMT::SetThreadCount(unsigned int thread_count)
 {
-    if (thread_count > Internals.size()) Internals.SetSize(thread_count);
+    // Rows are distributed based on the number of internals
+    if (thread_count != Internals.size()) Internals.SetSize(thread_count);
 }
 
 void svlDraw::WarpMT::WarpTriangle(unsigned int thread_id,
@@ -0,0 +1,166 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include "svlFileMapping.h"
+
+#include <algorithm>
+
+#if (CISST_OS == CISST_WINDOWS)
+    #include <windows.h>
+#else // CISST_OS != CISST_WINDOWS
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif // CISST_OS
+
+
+/****************************/
+/*** svlFileMapping class ***/
+/****************************/
+
+svlFileMapping::svlFileMapping() :
+    Data(0),
+    Length(0),
+#if (CISST_OS == CISST_WINDOWS)
+    FileHandle(INVALID_HANDLE_VALUE),
+    MappingHandle(0)
+#else // CISST_OS != CISST_WINDOWS
+    FileDescriptor(-1)
+#endif // CISST_OS
+{
+}
+
+svlFileMapping::svlFileMapping(const svlFileMapping& CMN_UNUSED(file)) :
+    Data(0),
+    Length(0),
+#if (CISST_OS == CISST_WINDOWS)
+    FileHandle(INVALID_HANDLE_VALUE),
+    MappingHandle(0)
+#else // CISST_OS != CISST_WINDOWS
+    FileDescriptor(-1)
+#endif // CISST_OS
+{
+}
+
+svlFileMapping::~svlFileMapping()
+{
+    Close();
+}
+
+int svlFileMapping::Open(const std::string& filepath)
+{
+    if (Data) return SVL_FAIL;
+
+#if (CISST_OS == CISST_WINDOWS)
+
+    FileHandle = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, 0);
+    if (FileHandle == INVALID_HANDLE_VALUE) return SVL_FAIL;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(FileHandle, &size) || size.QuadPart < 1 ||
+        static_cast<unsigned long long int>(size.QuadPart) > static_cast<SIZE_T>(-1)) {
+        Close();
+        return SVL_FAIL;
+    }
+    Length = size.QuadPart;
+
+    MappingHandle = CreateFileMappingA(FileHandle, 0, PAGE_READONLY, 0, 0, 0);
+    if (MappingHandle) Data = reinterpret_cast<unsigned char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+#else // CISST_OS != CISST_WINDOWS
+
+    FileDescriptor = open(filepath.c_str(), O_RDONLY);
+    if (FileDescriptor < 0) return SVL_FAIL;
+
+    struct stat info;
+    if (fstat(FileDescriptor, &info) != 0 || info.st_size < 1 ||
+        static_cast<unsigned long long int>(info.st_size) > static_cast<size_t>(-1)) {
+        Close();
+        return SVL_FAIL;
+    }
+    Length = info.st_size;
+
+    void* data = mmap(0, static_cast<size_t>(Length), PROT_READ, MAP_SHARED, FileDescriptor, 0);
+    if (data != MAP_FAILED) {
+        Data = reinterpret_cast<unsigned char*>(data);
+        // Frames are not necessarily accessed sequentially: read-ahead
+        // is requested explicitly with WillNeed()
+        madvise(data, static_cast<size_t>(Length), MADV_RANDOM);
+    }
+
+#endif // CISST_OS
+
+    if (!Data) {
+        Close();
+        return SVL_FAIL;
+    }
+
+    return SVL_OK;
+}
+
+void svlFileMapping::Close()
+{
+#if (CISST_OS == CISST_WINDOWS)
+    if (Data) UnmapViewOfFile(Data);
+    if (MappingHandle) CloseHandle(MappingHandle);
+    if (FileHandle != INVALID_HANDLE_VALUE) CloseHandle(FileHandle);
+    MappingHandle = 0;
+    FileHandle = INVALID_HANDLE_VALUE;
+#else // CISST_OS != CISST_WINDOWS
+    if (Data) munmap(Data, static_cast<size_t>(Length));
+    if (FileDescriptor >= 0) close(FileDescriptor);
+    FileDescriptor = -1;
+#endif // CISST_OS
+
+    Data = 0;
+    Length = 0;
+}
+
+bool svlFileMapping::IsOpen() const
+{
+    return (Data != 0);
+}
+
+long long int svlFileMapping::GetLength() const
+{
+    return Length;
+}
+
+const unsigned char* svlFileMapping::GetPointer(const long long int offset, const long long int length) const
+{
+    if (!Data || offset < 0 || length < 0 || offset > Length - length) return 0;
+    return Data + offset;
+}
+
+void svlFileMapping::WillNeed(const long long int offset, const long long int length) const
+{
+    if (!Data || offset < 0 || length < 1 || offset >= Length) return;
+
+#if (CISST_OS == CISST_WINDOWS)
+    // Pages are touched by the prefetching thread
+#else // CISST_OS != CISST_WINDOWS
+    const long long int pagesize = sysconf(_SC_PAGESIZE);
+    const long long int start = (offset / pagesize) * pagesize;
+    const long long int end = std::min(offset + length, Length);
+    madvise(Data + start, static_cast<size_t>(end - start), MADV_WILLNEED);
+#endif // CISST_OS
+}
@@ -0,0 +1,64 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlFileMapping_h
+#define _svlFileMapping_h
+
+#include <cisstStereoVision/svlTypes.h>
+
+
+// Read-only memory mapping of a whole file.  Mapping fails if the
+// file doesn't fit in the address space (e.g. large files on 32-bit
+// systems), callers shall fall back to svlFile in that case.
+class svlFileMapping
+{
+public:
+    svlFileMapping();
+    // Copies are not mapped
+    svlFileMapping(const svlFileMapping& file);
+    ~svlFileMapping();
+
+    int Open(const std::string& filepath);
+    void Close();
+    bool IsOpen() const;
+
+    long long int GetLength() const;
+    // Returns null if the range is outside of the file
+    const unsigned char* GetPointer(const long long int offset, const long long int length) const;
+
+    // Hint: the range will be accessed soon (e.g. frames ahead in
+    // the playback direction, including reverse playback)
+    void WillNeed(const long long int offset, const long long int length) const;
+
+private:
+    unsigned char* Data;
+    long long int Length;
+
+    // OS handles
+#if (CISST_OS == CISST_WINDOWS)
+    void* FileHandle;
+    void* MappingHandle;
+#else // CISST_OS != CISST_WINDOWS
+    int FileDescriptor;
+#endif // CISST_OS
+};
+
+#endif // _svlFileMapping_h
@@ -33,7 +33,11 @@ CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterImageFileWriter, svlFilterBase)
 
 svlFilterImageFileWriter::svlFilterImageFileWriter() :
     svlFilterBase(),
-    TimestampsEnabled(false)
+    TimestampsEnabled(false),
+    AsyncEnabled(false),
+    AsyncThreads(2),
+    AsyncQueueSize(8),
+    AsyncPolicy(svlImageIOAsync::QueueBlock)
 {
     AddInput("input", true);
     AddInputType("input", svlTypeImageRGB);
@@ -76,6 +80,11 @@ int svlFilterImageFileWriter::Initialize(svlSample* syncInput, svlSample* &syncO
         }
     }
 
+    if (AsyncEnabled && AsyncIO.Start(AsyncThreads, AsyncQueueSize, AsyncPolicy) != SVL_OK) {
+        Release();
+        return SVL_FAIL;
+    }
+
     syncOutput = syncInput;
 
     return SVL_OK;
@@ -110,7 +119,13 @@ int svlFilterImageFileWriter::Process(svlProcInfo* procInfo, svlSample* syncInpu
 
         path << "." << Extension[idx];
 
-        if (ImageCodec[idx]->Write(*img, idx, path.str(), Compression[idx]) != SVL_OK) return SVL_FAIL;
+        if (AsyncIO.IsRunning()) {
+            // Image is copied, encoding and writing happen in the background
+            if (AsyncIO.Write(*img, idx, path.str(), Compression[idx]) != SVL_OK) return SVL_FAIL;
+        }
+        else {
+            if (ImageCodec[idx]->Write(*img, idx, path.str(), Compression[idx]) != SVL_OK) return SVL_FAIL;
+        }
     }
 
     _SynchronizeThreads(procInfo);
@@ -125,6 +140,9 @@ int svlFilterImageFileWriter::Process(svlProcInfo* procInfo, svlSample* syncInpu
 
 int svlFilterImageFileWriter::Release()
 {
+    // Waits for pending files to be written
+    AsyncIO.Stop();
+
     for (unsigned int i = 0; i < ImageCodec.size(); i ++) {
         svlImageIO::ReleaseCodec(ImageCodec[i]);
         ImageCodec[i] = 0;
@@ -180,6 +198,26 @@ void svlFilterImageFileWriter::EnableTimestamps(bool enable)
     TimestampsEnabled = enable;
 }
 
+int svlFilterImageFileWriter::EnableAsync(bool enable, unsigned int threadcount, unsigned int queuesize, svlImageIOAsync::QueuePolicy policy)
+{
+    if (IsInitialized() == true)
+        return SVL_ALREADY_INITIALIZED;
+    if (threadcount < 1 || queuesize < 1)
+        return SVL_FAIL;
+
+    AsyncEnabled = enable;
+    AsyncThreads = threadcount;
+    AsyncQueueSize = queuesize;
+    AsyncPolicy = policy;
+
+    return SVL_OK;
+}
+
+void svlFilterImageFileWriter::GetAsyncStatistics(svlImageIOAsync::Statistics & stats) const
+{
+    AsyncIO.GetStatistics(stats);
+}
+
 void svlFilterImageFileWriter::Pause()
 {
     CaptureLength = 0;
@@ -401,12 +401,13 @@ int svlFilterImageOverlay::Process(svlProcInfo* procInfo, svlSample* syncInput,
         TransformCS.Leave();
 
         _SampleCacheMap::iterator itersample;
-        svlSampleImage* src_image = dynamic_cast<svlSampleImage*>(syncInput);
         svlOverlayInput* overlayinput = 0;
         svlFilterInput* input = 0;
         svlSample* ovrlsample = 0;
         svlOverlay* t_overlay = 0;
 
+        DrawList.clear();
+
         overlay = FirstOverlay;
         while (overlay) {
 
@@ -440,7 +441,7 @@ int svlFilterImageOverlay::Process(svlProcInfo* procInfo, svlSample* syncInput,
                             if (EnableInputSync && overlayinput->GetInputSynchronized()) {
                                 if (ovrlsample->GetTimestamp() >= current_time) {
                                 // Sample is most recent
-                                    overlay->Draw(src_image, ovrlsample);
+                                    AddToDrawList(overlay, ovrlsample, procInfo->count);
                                 }
                                 else {
                                 // Sample is not recent
@@ -452,11 +453,11 @@ int svlFilterImageOverlay::Process(svlProcInfo* procInfo, svlSample* syncInput,
                                            EnableInputSync &&
                                            overlayinput->GetInputSynchronized() &&
                                            (!ovrlsample || ovrlsample->GetTimestamp() < current_time));
-                                    if (IsRunning()) overlay->Draw(src_image, ovrlsample);
+                                    if (IsRunning()) AddToDrawList(overlay, ovrlsample, procInfo->count);
                                 }
                             }
                             else {
-                                overlay->Draw(src_image, ovrlsample);
+                                AddToDrawList(overlay, ovrlsample, procInfo->count);
                             }
                         }
                     }
@@ -464,16 +465,51 @@ int svlFilterImageOverlay::Process(svlProcInfo* procInfo, svlSample* syncInput,
             }
             else {
             // Overlays without input
-                overlay->Draw(src_image, 0);
+                AddToDrawList(overlay, 0, procInfo->count);
             }
 
             overlay = overlay->Next;
         }
     }
 
+    _SynchronizeThreads(procInfo);
+
+    // Overlays are drawn in order: overlays supporting parallel drawing
+    // are drawn by all threads, the others by a single thread
+    svlSampleImage* src_image = dynamic_cast<svlSampleImage*>(syncInput);
+    const unsigned int count = static_cast<unsigned int>(DrawList.size());
+    unsigned int i = 0;
+
+    while (i < count) {
+        if (DrawList[i].parallel) {
+            DrawList[i].overlay->DrawParallel(src_image, DrawList[i].sample, procInfo->count, procInfo->ID);
+            i ++;
+        }
+        else {
+            _OnSingleThread(procInfo)
+            {
+                for (unsigned int j = i; j < count && !DrawList[j].parallel; j ++) {
+                    DrawList[j].overlay->Draw(src_image, DrawList[j].sample);
+                }
+            }
+            while (i < count && !DrawList[i].parallel) i ++;
+        }
+        // Each overlay may distribute its work differently among threads
+        if (i < count) _SynchronizeThreads(procInfo);
+    }
+
     return SVL_OK;
 }
 
+void svlFilterImageOverlay::AddToDrawList(svlOverlay* overlay, svlSample* sample, unsigned int thread_count)
+{
+    DrawItem item;
+    item.overlay  = overlay;
+    item.sample   = sample;
+    item.parallel = overlay->GetVisible() && overlay->PrepareDrawParallel(sample, thread_count);
+    DrawList.push_back(item);
+}
+
 void svlFilterImageOverlay::OnStop()
 {
     // Remove overlay objects that we didn't have a chance to remove earlier
@@ -0,0 +1,405 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlFilterImagePointOperations.h>
+#include <cisstStereoVision/svlConverters.h>
+#include "svlImageProcessingHelper.h"
+
+#include <string.h>
+
+
+/*********************************************************/
+/*** svlFilterImagePointOperations::Operation class ******/
+/*********************************************************/
+
+class svlFilterImagePointOperations::Operation
+{
+public:
+    enum TypeEnum {
+        Curve,
+        Swap,
+        Conversion
+    };
+
+    Operation(TypeEnum type) :
+        Type(type),
+        Channel(-1),
+        ColorSpace(svlColorSpaceRGB)
+    {
+        Source[0] = 0; Source[1] = 1; Source[2] = 2;
+    }
+
+    TypeEnum Type;
+    unsigned char Table[256];
+    int Channel;
+    unsigned int Source[3];
+    svlColorSpace ColorSpace;
+};
+
+
+/*****************************************************/
+/*** svlFilterImagePointOperations::Stage class ******/
+/*****************************************************/
+
+class svlFilterImagePointOperations::Stage
+{
+public:
+    // Look-up: output channel i = Table[i][input channel Source[i]]
+    Stage() :
+        Type(Operation::Curve),
+        ColorSpace(svlColorSpaceRGB)
+    {
+        for (unsigned int c = 0; c < 3; c ++) {
+            Source[c] = c;
+            for (unsigned int i = 0; i < 256; i ++) Table[c][i] = static_cast<unsigned char>(i);
+        }
+    }
+
+    Stage(svlColorSpace colorspace) :
+        Type(Operation::Conversion),
+        ColorSpace(colorspace)
+    {
+    }
+
+    bool IsIdentity() const
+    {
+        for (unsigned int c = 0; c < 3; c ++) {
+            if (Source[c] != c) return false;
+            for (unsigned int i = 0; i < 256; i ++) if (Table[c][i] != i) return false;
+        }
+        return true;
+    }
+
+    bool IsSwapped() const
+    {
+        return (Source[0] != 0 || Source[1] != 1 || Source[2] != 2);
+    }
+
+    Operation::TypeEnum Type;
+    unsigned char Table[3][256];
+    unsigned int Source[3];
+    svlColorSpace ColorSpace;
+};
+
+
+/*************************************************/
+/*** svlFilterImagePointOperations class *********/
+/*************************************************/
+
+CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterImagePointOperations, svlFilterBase)
+
+svlFilterImagePointOperations::svlFilterImagePointOperations() :
+    svlFilterBase(),
+    Modified(false),
+    PixelType(svlPixelRGB)
+{
+    AddInput("input", true);
+    AddInputType("input", svlTypeImageRGB);
+    AddInputType("input", svlTypeImageRGBStereo);
+    AddInputType("input", svlTypeImageRGBA);
+    AddInputType("input", svlTypeImageRGBAStereo);
+    AddInputType("input", svlTypeImageMono8);
+    AddInputType("input", svlTypeImageMono8Stereo);
+
+    AddOutput("output", true);
+    SetAutomaticOutputType(true);
+}
+
+svlFilterImagePointOperations::~svlFilterImagePointOperations()
+{
+    Clear();
+    ClearProgram();
+}
+
+void svlFilterImagePointOperations::Clear()
+{
+    CS.Enter();
+        for (unsigned int i = 0; i < Operations.size(); i ++) delete Operations[i];
+        Operations.clear();
+        Modified = true;
+    CS.Leave();
+}
+
+unsigned int svlFilterImagePointOperations::GetOperationCount() const
+{
+    return static_cast<unsigned int>(Operations.size());
+}
+
+int svlFilterImagePointOperations::AddExposure(double brightness, double contrast, double gamma, int channel)
+{
+    if (channel > 2) return SVL_FAIL;
+
+    svlImageProcessingHelper::ExposureInternals exposure;
+    exposure.SetBrightness(brightness);
+    exposure.SetContrast(contrast);
+    exposure.SetGamma(gamma);
+    exposure.CalculateCurve();
+
+    Operation* operation = new Operation(Operation::Curve);
+    for (unsigned int i = 0; i < 256; i ++) operation->Table[i] = exposure.Curve[i];
+    operation->Channel = channel;
+
+    return AddOperation(operation);
+}
+
+int svlFilterImagePointOperations::AddCurve(const vctDynamicVector<unsigned char> & curve, int channel)
+{
+    if (curve.size() != 256 || channel > 2) return SVL_FAIL;
+
+    Operation* operation = new Operation(Operation::Curve);
+    for (unsigned int i = 0; i < 256; i ++) operation->Table[i] = curve[i];
+    operation->Channel = channel;
+
+    return AddOperation(operation);
+}
+
+int svlFilterImagePointOperations::AddThreshold(unsigned int threshold, int channel)
+{
+    if (channel > 2) return SVL_FAIL;
+
+    // Same as svlFilterImageThresholding
+    Operation* operation = new Operation(Operation::Curve);
+    for (unsigned int i = 0; i < 256; i ++) operation->Table[i] = (i < threshold) ? 0 : 255;
+    operation->Channel = channel;
+
+    return AddOperation(operation);
+}
+
+int svlFilterImagePointOperations::AddChannelSwap(unsigned int ch1, unsigned int ch2, unsigned int ch3)
+{
+    if (ch1 > 2 || ch2 > 2 || ch3 > 2) return SVL_FAIL;
+
+    Operation* operation = new Operation(Operation::Swap);
+    operation->Source[0] = ch1;
+    operation->Source[1] = ch2;
+    operation->Source[2] = ch3;
+
+    return AddOperation(operation);
+}
+
+int svlFilterImagePointOperations::AddColorConversion(svlColorSpace output)
+{
+    Operation* operation = new Operation(Operation::Conversion);
+    operation->ColorSpace = output;
+
+    return AddOperation(operation);
+}
+
+int svlFilterImagePointOperations::AddOperation(Operation* operation)
+{
+    // Channel swaps and conversions require RGB images
+    if (IsInitialized() && operation->Type != Operation::Curve && PixelType != svlPixelRGB) {
+        delete operation;
+        return SVL_FAIL;
+    }
+
+    CS.Enter();
+        Operations.push_back(operation);
+        Modified = true;
+    CS.Leave();
+
+    return SVL_OK;
+}
+
+int svlFilterImagePointOperations::Initialize(svlSample* syncInput, svlSample* &syncOutput)
+{
+    syncOutput = syncInput;
+
+    svlSampleImage* img = dynamic_cast<svlSampleImage*>(syncInput);
+    if (!img) return SVL_FAIL;
+
+    PixelType = img->GetPixelType();
+    if (PixelType != svlPixelRGB) {
+        for (unsigned int i = 0; i < Operations.size(); i ++) {
+            if (Operations[i]->Type != Operation::Curve) {
+                CMN_LOG_CLASS_INIT_ERROR << "Initialize: channel swaps and color conversions require RGB images" << std::endl;
+                return SVL_FAIL;
+            }
+        }
+    }
+
+    Modified = true;
+
+    return SVL_OK;
+}
+
+int svlFilterImagePointOperations::Process(svlProcInfo* procInfo, svlSample* syncInput, svlSample* &syncOutput)
+{
+    syncOutput = syncInput;
+    _SkipIfAlreadyProcessed(syncInput, syncOutput);
+    _SkipIfDisabled();
+
+    _OnSingleThread(procInfo)
+    {
+        if (Modified) Compile();
+    }
+
+    _SynchronizeThreads(procInfo);
+
+    if (Program.empty()) return SVL_OK;
+
+    svlSampleImage* img = dynamic_cast<svlSampleImage*>(syncInput);
+    const unsigned int videochannels = img->GetVideoChannels();
+    const unsigned int pixelstride = img->GetDataChannels();
+    const unsigned int datachannels = (img->GetAlphaChannel() >= 0) ? pixelstride - 1 : pixelstride;
+    unsigned int vch, height, width, from, to, y;
+
+    // Rows are distributed over threads
+    for (vch = 0; vch < videochannels; vch ++) {
+        width  = img->GetWidth(vch);
+        height = img->GetHeight(vch);
+
+        _GetParallelSubRange(procInfo, height, from, to);
+
+        for (y = from; y < to; y ++) {
+            ProcessRow(img->GetUCharPointer(vch, 0, y), width, datachannels, pixelstride);
+        }
+    }
+
+    return SVL_OK;
+}
+
+void svlFilterImagePointOperations::Compile()
+{
+    ClearProgram();
+
+    CS.Enter();
+
+    Stage* lut = 0;
+    Operation* operation;
+    unsigned char table[3][256];
+    unsigned int source[3];
+    unsigned int c, i, first, last;
+
+    for (unsigned int op = 0; op < Operations.size(); op ++) {
+        operation = Operations[op];
+
+        if (operation->Type == Operation::Conversion) {
+            // Conversion can't be merged with tables
+            if (lut) {
+                if (lut->IsIdentity()) delete lut;
+                else Program.push_back(lut);
+                lut = 0;
+            }
+            Program.push_back(new Stage(operation->ColorSpace));
+            continue;
+        }
+
+        if (!lut) lut = new Stage;
+
+        if (operation->Type == Operation::Curve) {
+            // Curve applied on top of current table
+            if (operation->Channel < 0) { first = 0; last = 2; }
+            else first = last = operation->Channel;
+            for (c = first; c <= last; c ++) {
+                for (i = 0; i < 256; i ++) lut->Table[c][i] = operation->Table[lut->Table[c][i]];
+            }
+        }
+        else {
+            // Swap: permute tables and their sources
+            memcpy(table, lut->Table, sizeof(table));
+            memcpy(source, lut->Source, sizeof(source));
+            for (c = 0; c < 3; c ++) {
+                memcpy(lut->Table[c], table[operation->Source[c]], 256);
+                lut->Source[c] = source[operation->Source[c]];
+            }
+        }
+    }
+
+    if (lut) {
+        if (lut->IsIdentity()) delete lut;
+        else Program.push_back(lut);
+    }
+
+    Modified = false;
+
+    CS.Leave();
+
+    CMN_LOG_CLASS_RUN_VERBOSE << "Compile: " << Operations.size() << " operation(s) compiled into "
+                              << Program.size() << " stage(s)" << std::endl;
+}
+
+void svlFilterImagePointOperations::ClearProgram()
+{
+    for (unsigned int i = 0; i < Program.size(); i ++) delete Program[i];
+    Program.clear();
+}
+
+void svlFilterImagePointOperations::ProcessRow(unsigned char* row, const unsigned int width, const unsigned int datachannels, const unsigned int pixelstride)
+{
+    const unsigned int stagecount = static_cast<unsigned int>(Program.size());
+    unsigned char *ptr, *end = row + width * pixelstride;
+    unsigned char v0, v1, v2;
+
+    for (unsigned int s = 0; s < stagecount; s ++) {
+        const Stage* stage = Program[s];
+
+        if (stage->Type == Operation::Conversion) {
+            // Only RGB images
+            switch (stage->ColorSpace) {
+                case svlColorSpaceHSV:
+                    svlConverter::RGB24toHSV24(row, row, width);
+                break;
+
+                case svlColorSpaceHSL:
+                    svlConverter::RGB24toHSL24(row, row, width);
+                break;
+
+                case svlColorSpaceYUV:
+                    svlConverter::RGB24toYUV444(row, row, width);
+                break;
+
+                case svlColorSpaceRGB:
+                    // NOP
+                break;
+            }
+            continue;
+        }
+
+        const unsigned char* t0 = stage->Table[0];
+        const unsigned char* t1 = stage->Table[1];
+        const unsigned char* t2 = stage->Table[2];
+
+        if (datachannels == 1) {
+            for (ptr = row; ptr < end; ptr += pixelstride) *ptr = t0[*ptr];
+        }
+        else if (!stage->IsSwapped()) {
+            for (ptr = row; ptr < end; ptr += pixelstride) {
+                ptr[0] = t0[ptr[0]];
+                ptr[1] = t1[ptr[1]];
+                ptr[2] = t2[ptr[2]];
+            }
+        }
+        else {
+            const unsigned int s0 = stage->Source[0];
+            const unsigned int s1 = stage->Source[1];
+            const unsigned int s2 = stage->Source[2];
+            for (ptr = row; ptr < end; ptr += pixelstride) {
+                v0 = ptr[s0];
+                v1 = ptr[s1];
+                v2 = ptr[s2];
+                ptr[0] = t0[v0];
+                ptr[1] = t1[v1];
+                ptr[2] = t2[v2];
+            }
+        }
+    }
+}
@@ -202,11 +202,11 @@ int svlFilterImageResizer::Process(svlProcInfo* procInfo, svlSample* syncInput,
 
     svlSampleImage* id = dynamic_cast<svlSampleImage*>(syncInput);
     unsigned int videochannels = id->GetVideoChannels();
-    unsigned int idx;
+    svlImageProcessing::RS_Method method = InterpolationEnabled ? svlImageProcessing::RS_Area : svlImageProcessing::RS_Nearest;
 
-    _ParallelLoop(procInfo, idx, videochannels)
-    {
-        svlImageProcessing::Resize(id, idx, OutputImage, idx, InterpolationEnabled, Internals[idx]);
+    // All threads work on each video channel; rows are distributed among threads
+    for (unsigned int idx = 0; idx < videochannels; idx ++) {
+        if (svlImageProcessing::Resize(id, idx, OutputImage, idx, method, Internals[idx], procInfo) != SVL_OK) return SVL_FAIL;
     }
 
     return SVL_OK;
@@ -0,0 +1,225 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlFilterSharedMemoryWriter.h>
+#include <cisstStereoVision/svlFilterInput.h>
+#include <cisstStereoVision/svlFilterOutput.h>
+#include "svlSharedMemoryRing.h"
+
+#include <string.h>
+#include <sstream>
+#include <algorithm>
+
+#define SHM_MIN_SLOT_SIZE   1048576
+
+
+/*******************************************/
+/*** svlFilterSharedMemoryWriter class *****/
+/*******************************************/
+
+CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterSharedMemoryWriter, svlFilterBase)
+
+svlFilterSharedMemoryWriter::svlFilterSharedMemoryWriter() :
+    svlFilterBase(),
+    Ring(0),
+    SlotCount(4),
+    SlotSize(0),
+    SampleCount(0)
+{
+    AddInput("input", true);
+    AddInputType("input", svlTypeImageRGB);
+    AddInputType("input", svlTypeImageRGBA);
+    AddInputType("input", svlTypeImageRGBStereo);
+    AddInputType("input", svlTypeImageRGBAStereo);
+    AddInputType("input", svlTypeImageMono8);
+    AddInputType("input", svlTypeImageMono8Stereo);
+    AddInputType("input", svlTypeImageMono16);
+    AddInputType("input", svlTypeImageMono16Stereo);
+    AddInputType("input", svlTypeImageMono32);
+    AddInputType("input", svlTypeImageMono32Stereo);
+    AddInputType("input", svlTypeImage3DMap);
+    AddInputType("input", svlTypeMatrixInt8);
+    AddInputType("input", svlTypeMatrixInt16);
+    AddInputType("input", svlTypeMatrixInt32);
+    AddInputType("input", svlTypeMatrixInt64);
+    AddInputType("input", svlTypeMatrixUInt8);
+    AddInputType("input", svlTypeMatrixUInt16);
+    AddInputType("input", svlTypeMatrixUInt32);
+    AddInputType("input", svlTypeMatrixUInt64);
+    AddInputType("input", svlTypeMatrixFloat);
+    AddInputType("input", svlTypeMatrixDouble);
+    AddInputType("input", svlTypeTransform3D);
+    AddInputType("input", svlTypeTargets);
+    AddInputType("input", svlTypeText);
+    AddInputType("input", svlTypeBlobs);
+
+    AddOutput("output", true);
+    SetAutomaticOutputType(true);
+}
+
+svlFilterSharedMemoryWriter::~svlFilterSharedMemoryWriter()
+{
+    Release();
+}
+
+int svlFilterSharedMemoryWriter::SetSegmentName(const std::string& name)
+{
+    if (IsInitialized()) return SVL_ALREADY_INITIALIZED;
+    if (name.empty() || name.find('/') != std::string::npos) return SVL_FAIL;
+    SegmentName = name;
+    return SVL_OK;
+}
+
+const std::string& svlFilterSharedMemoryWriter::GetSegmentName() const
+{
+    return SegmentName;
+}
+
+int svlFilterSharedMemoryWriter::SetSlotCount(const unsigned int count)
+{
+    if (IsInitialized()) return SVL_ALREADY_INITIALIZED;
+    if (count < 2) return SVL_FAIL;
+    SlotCount = count;
+    return SVL_OK;
+}
+
+unsigned int svlFilterSharedMemoryWriter::GetSlotCount() const
+{
+    return SlotCount;
+}
+
+int svlFilterSharedMemoryWriter::SetSlotSize(const unsigned int size)
+{
+    if (IsInitialized()) return SVL_ALREADY_INITIALIZED;
+    SlotSize = size;
+    return SVL_OK;
+}
+
+unsigned int svlFilterSharedMemoryWriter::GetSlotSize() const
+{
+    return SlotSize;
+}
+
+unsigned int svlFilterSharedMemoryWriter::GetSampleCount() const
+{
+    return SampleCount;
+}
+
+int svlFilterSharedMemoryWriter::Initialize(svlSample* syncInput, svlSample* &syncOutput)
+{
+    syncOutput = syncInput;
+
+    Release();
+
+    if (SegmentName.empty()) {
+        CMN_LOG_CLASS_INIT_ERROR << "Initialize: segment name not set" << std::endl;
+        return SVL_FAIL;
+    }
+
+    svlSampleImage* image = dynamic_cast<svlSampleImage*>(syncInput);
+    unsigned int slotsize = SlotSize;
+
+    if (image) {
+        if (image->GetVideoChannels() > svlSharedMemoryRing::MAX_VIDEO_CHANNELS) return SVL_FAIL;
+        // Images have a fixed size while the stream is running
+        slotsize = 0;
+        for (unsigned int vch = 0; vch < image->GetVideoChannels(); vch ++) slotsize += image->GetDataSize(vch);
+    }
+    else if (slotsize == 0) {
+        std::ostringstream stream;
+        syncInput->SerializeRaw(stream);
+        slotsize = std::max(static_cast<unsigned int>(stream.str().size()) * 2, static_cast<unsigned int>(SHM_MIN_SLOT_SIZE));
+    }
+
+    Ring = new svlSharedMemoryRing;
+    if (Ring->Create(SegmentName, syncInput->GetType(), slotsize, SlotCount) != SVL_OK) {
+        CMN_LOG_CLASS_INIT_ERROR << "Initialize: failed to create shared memory segment \"" << SegmentName << "\"" << std::endl;
+        Release();
+        return SVL_FAIL;
+    }
+
+    SampleCount = 0;
+
+    return SVL_OK;
+}
+
+int svlFilterSharedMemoryWriter::Process(svlProcInfo* procInfo, svlSample* syncInput, svlSample* &syncOutput)
+{
+    syncOutput = syncInput;
+    _SkipIfAlreadyProcessed(syncInput, syncOutput);
+
+    _OnSingleThread(procInfo)
+    {
+        svlSampleImage* image = dynamic_cast<svlSampleImage*>(syncInput);
+        std::string serialized;
+        unsigned int size;
+
+        if (image) {
+            size = 0;
+            for (unsigned int vch = 0; vch < image->GetVideoChannels(); vch ++) size += image->GetDataSize(vch);
+        }
+        else {
+            std::ostringstream stream;
+            syncInput->SerializeRaw(stream);
+            serialized = stream.str();
+            size = static_cast<unsigned int>(serialized.size());
+        }
+
+        if (size > Ring->GetSlotSize()) {
+            CMN_LOG_CLASS_RUN_WARNING << "Process: sample (" << size << " bytes) doesn't fit in slot ("
+                                      << Ring->GetSlotSize() << " bytes), skipping" << std::endl;
+        }
+        else {
+            svlSharedMemoryRing::Slot* slot;
+            unsigned char* data = Ring->BeginWrite(slot);
+
+            slot->DataSize  = size;
+            slot->Timestamp = syncInput->GetTimestamp();
+
+            if (image) {
+                const unsigned int videochannels = image->GetVideoChannels();
+                for (unsigned int vch = 0; vch < videochannels; vch ++) {
+                    slot->Width[vch]  = image->GetWidth(vch);
+                    slot->Height[vch] = image->GetHeight(vch);
+                    memcpy(data, image->GetUCharPointer(vch), image->GetDataSize(vch));
+                    data += image->GetDataSize(vch);
+                }
+            }
+            else {
+                memcpy(data, serialized.data(), size);
+            }
+
+            Ring->EndWrite();
+            SampleCount ++;
+        }
+    }
+
+    return SVL_OK;
+}
+
+int svlFilterSharedMemoryWriter::Release()
+{
+    if (Ring) {
+        delete Ring;
+        Ring = 0;
+    }
+    return SVL_OK;
+}
@@ -49,7 +49,10 @@ svlFilterSourceImageFile::svlFilterSourceImageFile() :
     NumberOfDigits(0),
     From(0),
     To(0),
-    FrameSet(false)
+    FrameSet(false),
+    AsyncEnabled(false),
+    AsyncThreads(2),
+    PrefetchCount(4)
 {
     CreateInterfaces();
 
@@ -64,7 +67,10 @@ svlFilterSourceImageFile::svlFilterSourceImageFile(unsigned int channelcount) :
     NumberOfDigits(0),
     From(0),
     To(0),
-    FrameSet(false)
+    FrameSet(false),
+    AsyncEnabled(false),
+    AsyncThreads(2),
+    PrefetchCount(4)
 {
     CreateInterfaces();
 
@@ -144,6 +150,14 @@ int svlFilterSourceImageFile::Initialize(svlSample* &syncOutput)
         OutputImage->SetSize(i, w, h);
     }
 
+    // Read-ahead is only useful for file sequences
+    if (AsyncEnabled && NumberOfDigits > 0 && From < To) {
+        if (AsyncIO.Start(AsyncThreads, PrefetchCount, svlImageIOAsync::QueueBlock) != SVL_OK) {
+            Release();
+            return SVL_FAIL;
+        }
+    }
+
     return SVL_OK;
 }
 
@@ -193,9 +207,17 @@ int svlFilterSourceImageFile::Process(svlProcInfo* procInfo, svlSample* &syncOut
         // constructing filename (counter ignored if NumberOfDigits is zero)
         BuildFilePath(idx, FileCounter);
 
-        // opening file
-        if (ImageCodec[idx]->Read(*OutputImage, idx, FilePath[idx], true) != SVL_OK)
-            return SVL_FAIL;
+        if (AsyncIO.IsRunning()) {
+            // Uses the prefetched image if available
+            if (AsyncIO.Read(*OutputImage, idx, FilePath[idx]) != SVL_OK)
+                return SVL_FAIL;
+            if (!FrameSet) PrefetchFiles(idx);
+        }
+        else {
+            // opening file
+            if (ImageCodec[idx]->Read(*OutputImage, idx, FilePath[idx], true) != SVL_OK)
+                return SVL_FAIL;
+        }
     }
 
     return SVL_OK;
@@ -203,6 +225,8 @@ int svlFilterSourceImageFile::Process(svlProcInfo* procInfo, svlSample* &syncOut
 
 int svlFilterSourceImageFile::Release()
 {
+    AsyncIO.Stop();
+
     for (unsigned int i = 0; i < ImageCodec.size(); i ++) {
         svlImageIO::ReleaseCodec(ImageCodec[i]);
         ImageCodec[i] = 0;
@@ -258,6 +282,13 @@ int svlFilterSourceImageFile::BuildFilePath(int videoch, unsigned int framecount
     if (OutputImage == 0)
         return SVL_FAIL;
 
+    BuildFilePath(FilePath[videoch], videoch, framecounter);
+
+    return SVL_OK;
+}
+
+void svlFilterSourceImageFile::BuildFilePath(std::string & filepath, int videoch, unsigned int framecounter) const
+{
     std::stringstream path;
 
     path << FilePathPrefix[videoch];
@@ -268,11 +299,45 @@ int svlFilterSourceImageFile::BuildFilePath(int videoch, unsigned int framecount
     }
 
     path << "." << Extension[videoch];
-    FilePath[videoch] = path.str();
+    filepath = path.str();
+}
+
+void svlFilterSourceImageFile::PrefetchFiles(unsigned int videoch)
+{
+    std::string path;
+    unsigned int counter = FileCounter;
+
+    for (unsigned int i = 0; i < PrefetchCount; i ++) {
+        counter ++;
+        if (counter > To) {
+            if (!GetLoop()) break;
+            counter = From;
+        }
+        BuildFilePath(path, videoch, counter);
+        // Stops when the queue is full
+        if (AsyncIO.Prefetch(*OutputImage, videoch, path) != SVL_OK) break;
+    }
+}
+
+int svlFilterSourceImageFile::EnableAsync(bool enable, unsigned int threadcount, unsigned int prefetch)
+{
+    if (IsInitialized() == true)
+        return SVL_ALREADY_INITIALIZED;
+    if (threadcount < 1 || prefetch < 1)
+        return SVL_FAIL;
+
+    AsyncEnabled = enable;
+    AsyncThreads = threadcount;
+    PrefetchCount = prefetch;
 
     return SVL_OK;
 }
 
+void svlFilterSourceImageFile::GetAsyncStatistics(svlImageIOAsync::Statistics & stats) const
+{
+    AsyncIO.GetStatistics(stats);
+}
+
 
 int svlFilterSourceImageFile::SetFrame(unsigned int numberofdigits, unsigned int frame)
 {
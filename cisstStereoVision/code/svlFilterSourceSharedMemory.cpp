@@ -0,0 +1,268 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlFilterSourceSharedMemory.h>
+#include <cisstStereoVision/svlFilterOutput.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include "svlSharedMemoryRing.h"
+
+#include <string.h>
+#include <sstream>
+
+#define SHM_POLL_INTERVAL       0.0005
+#define SHM_REOPEN_INTERVAL     0.01
+#define SHM_STALL_INTERVAL      1.0
+
+
+/*******************************************/
+/*** svlFilterSourceSharedMemory class *****/
+/*******************************************/
+
+CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterSourceSharedMemory, svlFilterSourceBase)
+
+svlFilterSourceSharedMemory::svlFilterSourceSharedMemory() :
+    svlFilterSourceBase(false),  // manual timestamp management
+    OutputSample(0),
+    Ring(0),
+    Timeout(5.0),
+    Sequence(0),
+    SkippedCount(0)
+{
+    AddOutput("output", true);
+    SetAutomaticOutputType(false);
+}
+
+svlFilterSourceSharedMemory::~svlFilterSourceSharedMemory()
+{
+    Release();
+    if (Ring) delete Ring;
+    if (OutputSample) delete OutputSample;
+}
+
+int svlFilterSourceSharedMemory::SetSegmentName(const std::string& name, const double timeout)
+{
+    if (IsInitialized()) return SVL_ALREADY_INITIALIZED;
+
+    SegmentName = name;
+    if (OpenSegment(timeout) != SVL_OK) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetSegmentName: failed to open shared memory segment \"" << name << "\"" << std::endl;
+        return SVL_FAIL;
+    }
+
+    svlStreamType type = Ring->GetType();
+    if (GetOutput()->SetType(type) != SVL_OK) return SVL_FAIL;
+
+    if (OutputSample) delete OutputSample;
+    OutputSample = svlSample::GetNewFromType(type);
+
+    return SVL_OK;
+}
+
+const std::string& svlFilterSourceSharedMemory::GetSegmentName() const
+{
+    return SegmentName;
+}
+
+void svlFilterSourceSharedMemory::SetTimeout(const double timeout)
+{
+    Timeout = timeout;
+}
+
+double svlFilterSourceSharedMemory::GetTimeout() const
+{
+    return Timeout;
+}
+
+unsigned int svlFilterSourceSharedMemory::GetSequence() const
+{
+    return Sequence;
+}
+
+unsigned int svlFilterSourceSharedMemory::GetSkippedCount() const
+{
+    return SkippedCount;
+}
+
+int svlFilterSourceSharedMemory::Initialize(svlSample* &syncOutput)
+{
+    if (!OutputSample || !Ring) return SVL_FAIL;
+
+    SkippedCount = 0;
+    if (ReadSample(Timeout) != SVL_OK) return SVL_FAIL;
+
+    syncOutput = OutputSample;
+    return SVL_OK;
+}
+
+int svlFilterSourceSharedMemory::Process(svlProcInfo* procInfo, svlSample* &syncOutput)
+{
+    if (!OutputSample || !Ring) return SVL_FAIL;
+
+    _OnSingleThread(procInfo)
+    {
+        if (ReadSample(Timeout) != SVL_OK) return SVL_FAIL;
+    }
+
+    syncOutput = OutputSample;
+    return SVL_OK;
+}
+
+int svlFilterSourceSharedMemory::Release()
+{
+    // The segment stays open: the output type is known until the
+    // segment name is changed
+    Sequence = 0;
+    return SVL_OK;
+}
+
+int svlFilterSourceSharedMemory::OpenSegment(const double timeout)
+{
+    if (Ring) delete Ring;
+    Ring = new svlSharedMemoryRing;
+    Sequence = 0;
+
+    const double start = osaGetTime();
+    while (Ring->Open(SegmentName) != SVL_OK) {
+        if (osaGetTime() - start >= timeout) {
+            delete Ring;
+            Ring = 0;
+            return SVL_FAIL;
+        }
+        osaSleep(SHM_REOPEN_INTERVAL);
+    }
+
+    return SVL_OK;
+}
+
+int svlFilterSourceSharedMemory::ReadSample(const double timeout)
+{
+    svlSampleImage* image = dynamic_cast<svlSampleImage*>(OutputSample);
+    const svlSharedMemoryRing::Slot* slot;
+    const unsigned char* data;
+    std::string serialized;
+    unsigned int latest, next, datasize, vch;
+    unsigned int width[svlSharedMemoryRing::MAX_VIDEO_CHANNELS], height[svlSharedMemoryRing::MAX_VIDEO_CHANNELS];
+    double timestamp;
+    bool valid;
+
+    const double start = osaGetTime();
+    double lastsample = start;
+
+    while (1) {
+        latest = Ring->GetLatestSequence();
+
+        if (latest != 0 && latest != Sequence) {
+            // Deliver samples in order unless the reader fell behind so
+            // much that the next one might be overwritten any time
+            next = Sequence + 1;
+            if (Sequence == 0 || latest - Sequence >= Ring->GetSlotCount()) next = latest;
+
+            slot = Ring->GetSlot(next, data);
+            valid = (slot != 0);
+
+            if (valid) {
+                // Copy the slot header and make sure the writer didn't
+                // start overwriting it before using the sizes
+                timestamp = slot->Timestamp;
+                datasize = slot->DataSize;
+                for (vch = 0; vch < svlSharedMemoryRing::MAX_VIDEO_CHANNELS; vch ++) {
+                    width[vch] = slot->Width[vch];
+                    height[vch] = slot->Height[vch];
+                }
+                valid = Ring->IsSlotValid(slot, next) && (datasize <= Ring->GetSlotSize());
+            }
+
+            if (valid) {
+                if (image) {
+                    const unsigned int videochannels = image->GetVideoChannels();
+                    unsigned long long int size = 0;
+                    for (vch = 0; vch < videochannels; vch ++) {
+                        size += static_cast<unsigned long long int>(image->GetBPP()) * width[vch] * height[vch];
+                    }
+                    valid = (size == datasize);
+                    for (vch = 0; valid && vch < videochannels; vch ++) {
+                        image->SetSize(vch, width[vch], height[vch]);
+                        memcpy(image->GetUCharPointer(vch), data, image->GetDataSize(vch));
+                        data += image->GetDataSize(vch);
+                    }
+                }
+                else {
+                    serialized.assign(reinterpret_cast<const char*>(data), datasize);
+                }
+
+                // The writer might have overwritten the slot while copying
+                valid = valid && Ring->IsSlotValid(slot, next);
+            }
+
+            if (valid && !image) {
+                std::istringstream stream(serialized);
+                try {
+                    OutputSample->DeSerializeRaw(stream);
+                }
+                catch (std::exception &) {
+                    valid = false;
+                }
+            }
+
+            if (valid) {
+                if (Sequence != 0 && next - Sequence > 1) SkippedCount += next - Sequence - 1;
+                Sequence = next;
+                OutputSample->SetTimestamp(timestamp);
+                return SVL_OK;
+            }
+
+            // Sample got overwritten: skip to the latest
+            if (Sequence != 0 && latest - Sequence > 1) {
+                SkippedCount += latest - Sequence - 1;
+                Sequence = latest - 1;
+            }
+        }
+
+        const double time = osaGetTime();
+
+        // Writer closed the segment or stopped publishing: check if it
+        // was restarted with a new segment under the same name
+        if (Ring->IsClosed() || time - lastsample >= SHM_STALL_INTERVAL) {
+            svlSharedMemoryRing* ring = new svlSharedMemoryRing;
+            if (ring->Open(SegmentName) == SVL_OK &&
+                ring->GetCreationTime() != Ring->GetCreationTime() &&
+                ring->GetType() == Ring->GetType()) {
+                delete Ring;
+                Ring = ring;
+                Sequence = 0;
+                CMN_LOG_CLASS_RUN_VERBOSE << "ReadSample: reopened shared memory segment \"" << SegmentName << "\"" << std::endl;
+                continue;
+            }
+            delete ring;
+            lastsample = time;
+        }
+
+        if (time - start >= timeout) {
+            CMN_LOG_CLASS_RUN_WARNING << "ReadSample: no new sample in shared memory segment \"" << SegmentName << "\"" << std::endl;
+            return SVL_FAIL;
+        }
+
+        osaSleep(Ring->IsClosed() ? SHM_REOPEN_INTERVAL : SHM_POLL_INTERVAL);
+    }
+
+    return SVL_FAIL;
+}
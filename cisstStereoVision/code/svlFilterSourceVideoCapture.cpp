@@ -140,6 +140,7 @@ svlFilterSourceVideoCapture::~svlFilterSourceVideoCapture()
         if (DeviceID) delete [] DeviceID;
         if (InputID) delete [] InputID;
         if (Trigger) delete [] Trigger;
+        if (BufferMode) delete [] BufferMode;
         if (Format) {
             for (i = 0; i < NumberOfChannels; i ++) {
                 if (Format[i]) delete Format[i];
@@ -306,6 +307,7 @@ int svlFilterSourceVideoCapture::SetChannelCount(unsigned int channelcount)
     Format = new ImageFormat*[NumberOfChannels];
     Properties = new ImageProperties*[NumberOfChannels];
     Trigger = new ExternalTrigger[NumberOfChannels];
+    BufferMode = new CaptureBufferMode[NumberOfChannels];
     DevSpecConfigBuffer = new unsigned char*[NumberOfChannels];
     DevSpecConfigBufferSize = new unsigned int[NumberOfChannels];
     APIChannelID = new int[NumberOfChannels];
@@ -318,6 +320,7 @@ int svlFilterSourceVideoCapture::SetChannelCount(unsigned int channelcount)
         Format[i] = 0;
         Properties[i] = 0;
         memset(&(Trigger[i]), 0, sizeof(ExternalTrigger));
+        BufferMode[i] = BufferCopy;
         DevSpecConfigBuffer[i] = 0;
         DevSpecConfigBufferSize[i] = 0;
         APIChannelID[i] = -1;
@@ -385,6 +388,15 @@ int svlFilterSourceVideoCapture::Initialize(svlSample* &syncOutput)
         DeviceObj[API[i]]->SetTrigger(Trigger[i], APIChannelID[i]);
     }
 
+    // Set buffer mode
+    for (i = 0; i < NumberOfChannels; i ++) {
+        if (DeviceObj[API[i]]->SetBufferMode(BufferMode[i], APIChannelID[i]) != SVL_OK) {
+            CMN_LOG_CLASS_INIT_WARNING << "Initialize: zero-copy buffer mode not supported for channel "
+                                       << i << ", frames will be copied" << std::endl;
+            DeviceObj[API[i]]->SetBufferMode(BufferCopy, APIChannelID[i]);
+        }
+    }
+
     // Open devices
     for (i = 0; i < NumberOfChannels; i ++) {
         if (DeviceObj[API[i]]->Open() != SVL_OK) {
@@ -1364,6 +1376,32 @@ int svlFilterSourceVideoCapture::GetTrigger(ExternalTrigger& trigger, unsigned i
     return SVL_OK;
 }
 
+int svlFilterSourceVideoCapture::SetBufferMode(CaptureBufferMode mode, unsigned int videoch)
+{
+    if (OutputImage == 0)
+        return SVL_FAIL;
+    if (IsInitialized() == true)
+        return SVL_ALREADY_INITIALIZED;
+    if (videoch >= NumberOfChannels)
+        return SVL_WRONG_CHANNEL;
+
+    BufferMode[videoch] = mode;
+
+    return SVL_OK;
+}
+
+int svlFilterSourceVideoCapture::GetBufferMode(CaptureBufferMode& mode, unsigned int videoch) const
+{
+    if (OutputImage == 0)
+        return SVL_FAIL;
+    if (videoch >= NumberOfChannels)
+        return SVL_WRONG_CHANNEL;
+
+    mode = BufferMode[videoch];
+
+    return SVL_OK;
+}
+
 int svlFilterSourceVideoCapture::SetImageProperties(const ImageProperties& properties, unsigned int videoch)
 {
     // Available only after initialization
@@ -2225,6 +2263,13 @@ int svlVidCapSrcBase::GetTrigger(svlFilterSourceVideoCapture::ExternalTrigger &
     return SVL_FAIL;
 }
 
+int svlVidCapSrcBase::SetBufferMode(svlFilterSourceVideoCapture::CaptureBufferMode mode, unsigned int CMN_UNUSED(videoch))
+{
+    // only capture APIs overloading this method support zero-copy
+    if (mode == svlFilterSourceVideoCapture::BufferCopy) return SVL_OK;
+    return SVL_FAIL;
+}
+
 
 /***********************************************/
 /*** svlVidCapSrcDialogThread class ************/
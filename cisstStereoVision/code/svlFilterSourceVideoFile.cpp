@@ -46,6 +46,7 @@ CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterSourceVideoFile, svlFilterSourceBase)
 svlFilterSourceVideoFile::svlFilterSourceVideoFile() :
     svlFilterSourceBase(false),  // manual timestamp management
     OutputImage(0),
+    FrameCacheSize(0),
     FirstTimestamp(-1.0),
     NativeFramerate(-1.0)
 {
@@ -58,6 +59,7 @@ svlFilterSourceVideoFile::svlFilterSourceVideoFile() :
 svlFilterSourceVideoFile::svlFilterSourceVideoFile(unsigned int channelcount) :
     svlFilterSourceBase(false),  // manual timestamp management
     OutputImage(0),
+    FrameCacheSize(0),
     FirstTimestamp(-1.0),
     NativeFramerate(-1.0)
 {
@@ -143,6 +145,10 @@ int svlFilterSourceVideoFile::Initialize(svlSample* &syncOutput)
         Length[i] = Codec[i]->GetEndPos() + 1;
         Position[i] = Codec[i]->GetPos();
 
+        if (FrameCacheSize > 0 && Codec[i]->SetFrameCacheSize(FrameCacheSize) != SVL_OK) {
+            CMN_LOG_CLASS_INIT_WARNING << "Initialize: codec doesn't support frame caching for file \"" << FilePath[i] << "\"" << std::endl;
+        }
+
         if (UseRange[i]) {
             if (Range[i][0] < 0) Range[i][0] = 0;
             if (Range[i][1] < 0) Range[i][1] = Length[i];
@@ -485,6 +491,21 @@ int svlFilterSourceVideoFile::GetLength(unsigned int videoch) const
     return (Codec[videoch]->GetEndPos() + 1);
 }
 
+int svlFilterSourceVideoFile::SetFrameCacheSize(const unsigned int frames)
+{
+    if (IsInitialized() == true) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrameCacheSize: filter has already been initialized" << std::endl;
+        return SVL_ALREADY_INITIALIZED;
+    }
+    FrameCacheSize = frames;
+    return SVL_OK;
+}
+
+unsigned int svlFilterSourceVideoFile::GetFrameCacheSize() const
+{
+    return FrameCacheSize;
+}
+
 unsigned int svlFilterSourceVideoFile::GetWidth(unsigned int videoch) const
 {
     if (!IsInitialized()) {
@@ -541,6 +562,7 @@ void svlFilterSourceVideoFile::CreateInterfaces()
         provided->AddCommandWrite(&svlFilterSourceVideoFile::SetRangeLCommand,      this, "SetRange");
         provided->AddCommandWrite(&svlFilterSourceVideoFile::SetRangeLCommand,      this, "SetLeftRange");
         provided->AddCommandWrite(&svlFilterSourceVideoFile::SetRangeRCommand,      this, "SetRightRange");
+        provided->AddCommandWrite(&svlFilterSourceVideoFile::SetFrameCacheSizeCommand, this, "SetFrameCacheSize");
         provided->AddCommandRead (&svlFilterSourceVideoFile::GetChannelsCommand,    this, "GetChannels");
         provided->AddCommandRead (&svlFilterSourceVideoFile::GetPathLCommand,       this, "GetFilename");
         provided->AddCommandRead (&svlFilterSourceVideoFile::GetPathLCommand,       this, "GetLeftFilename");
@@ -637,6 +659,13 @@ void svlFilterSourceVideoFile::SetRangeRCommand(const vctInt2& range)
     }
 }
 
+void svlFilterSourceVideoFile::SetFrameCacheSizeCommand(const int & frames)
+{
+    if (frames < 0 || SetFrameCacheSize(static_cast<unsigned int>(frames)) != SVL_OK) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrameCacheSizeCommand: \"SetFrameCacheSize(" << frames << ")\" returned error" << std::endl;
+    }
+}
+
 void svlFilterSourceVideoFile::GetChannelsCommand(int & channels) const
 {
     channels = static_cast<int>(Codec.size());
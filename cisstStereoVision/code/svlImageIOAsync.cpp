@@ -0,0 +1,450 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlImageIOAsync.h>
+#include <cisstStereoVision/svlImageIO.h>
+#include <cisstStereoVision/svlTypes.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+
+#include <string.h>
+
+
+/*****************************************/
+/*** svlImageIOAsync::Job class **********/
+/*****************************************/
+
+class svlImageIOAsync::Job
+{
+public:
+    enum StatusType {
+        Waiting,
+        Processing,
+        Done,
+        Failed
+    };
+
+    Job(svlSampleImage* image) :
+        Image(image),
+        VideoChannel(0),
+        Compression(-1),
+        IsWrite(false),
+        Discarded(false),
+        Status(Waiting),
+        SubmitTime(0.0)
+    {
+    }
+
+    ~Job()
+    {
+        delete Image;
+    }
+
+    svlSampleImage* Image;
+    unsigned int VideoChannel;
+    std::string FileName;
+    int Compression;
+    bool IsWrite;
+    bool Discarded;
+    StatusType Status;
+    double SubmitTime;
+};
+
+
+/*************************************************/
+/*** svlImageIOAsync::Statistics class ***********/
+/*************************************************/
+
+svlImageIOAsync::Statistics::Statistics() :
+    Submitted(0),
+    Completed(0),
+    Dropped(0),
+    Failed(0),
+    Pending(0),
+    AverageLatency(0.0),
+    MaximumLatency(0.0),
+    Throughput(0.0)
+{
+}
+
+
+/*************************************/
+/*** svlImageIOAsync class ***********/
+/*************************************/
+
+CMN_IMPLEMENT_SERVICES(svlImageIOAsync)
+
+svlImageIOAsync::svlImageIOAsync() :
+    cmnGenericObject(),
+    Running(false),
+    StopRequested(false),
+    QueueSize(0),
+    Policy(QueueBlock),
+    InFlight(0),
+    LatencySum(0.0),
+    StartTime(0.0)
+{
+}
+
+svlImageIOAsync::~svlImageIOAsync()
+{
+    Stop();
+
+    JobList::iterator iter;
+    for (iter = FreeJobs.begin(); iter != FreeJobs.end(); iter ++) delete *iter;
+    FreeJobs.clear();
+}
+
+int svlImageIOAsync::Start(unsigned int threadcount, unsigned int queuesize, QueuePolicy policy)
+{
+    if (Running) return SVL_FAIL;
+    if (threadcount < 1 || queuesize < 1) return SVL_FAIL;
+
+    QueueSize = queuesize;
+    Policy = policy;
+    StopRequested = false;
+    ResetStatistics();
+
+    Threads.resize(threadcount);
+    for (unsigned int i = 0; i < threadcount; i ++) {
+        Threads[i] = new osaThread;
+        Threads[i]->Create<svlImageIOAsync, unsigned int>(this, &svlImageIOAsync::WorkerProc, i, "svlImageIO");
+    }
+    Running = true;
+
+    return SVL_OK;
+}
+
+void svlImageIOAsync::Stop()
+{
+    if (!Running) return;
+
+    // Workers process all queued jobs before exiting
+    CS.Enter();
+        StopRequested = true;
+        RaiseAll(IdleWorkers);
+    CS.Leave();
+
+    for (unsigned int i = 0; i < Threads.size(); i ++) {
+        Threads[i]->Wait();
+        delete Threads[i];
+    }
+    Threads.clear();
+    Running = false;
+
+    CancelPrefetch();
+}
+
+bool svlImageIOAsync::IsRunning() const
+{
+    return Running;
+}
+
+int svlImageIOAsync::Write(const svlSampleImage &image, const unsigned int videoch, const std::string &filename, const int compression)
+{
+    if (videoch >= image.GetVideoChannels()) return SVL_FAIL;
+    if (!Running) return svlImageIO::Write(image, videoch, filename, compression);
+
+    CS.Enter();
+        while (InFlight >= QueueSize) {
+            if (Policy == QueueDrop) {
+                Stats.Dropped ++;
+                CS.Leave();
+                return SVL_OK;
+            }
+            WaitForJobDone();
+        }
+        Job* job = GetJob(image, videoch);
+        InFlight ++;
+    CS.Leave();
+
+    // Copy outside of the critical section
+    memcpy(job->Image->GetUCharPointer(videoch), image.GetUCharPointer(videoch), image.GetDataSize(videoch));
+    job->VideoChannel = videoch;
+    job->FileName = filename;
+    job->Compression = compression;
+    job->IsWrite = true;
+
+    CS.Enter();
+        job->SubmitTime = osaGetTime();
+        Stats.Submitted ++;
+        Queue.push_back(job);
+        WakeUpWorker();
+    CS.Leave();
+
+    return SVL_OK;
+}
+
+void svlImageIOAsync::Flush()
+{
+    CS.Enter();
+        while (InFlight > 0) {
+            WaitForJobDone();
+        }
+    CS.Leave();
+}
+
+int svlImageIOAsync::Prefetch(const svlSampleImage &image, const unsigned int videoch, const std::string &filename)
+{
+    if (!Running || videoch >= image.GetVideoChannels()) return SVL_FAIL;
+
+    // Never blocks: prefetching stops when the queue is full
+    CS.Enter();
+        JobList::iterator iter;
+        for (iter = Prefetched.begin(); iter != Prefetched.end(); iter ++) {
+            if ((*iter)->VideoChannel == videoch && (*iter)->FileName == filename) {
+                CS.Leave();
+                return SVL_OK;
+            }
+        }
+        if (InFlight >= QueueSize || Prefetched.size() >= QueueSize * image.GetVideoChannels()) {
+            CS.Leave();
+            return SVL_FAIL;
+        }
+
+        Job* job = GetJob(image, videoch);
+        job->VideoChannel = videoch;
+        job->FileName = filename;
+        job->IsWrite = false;
+        job->SubmitTime = osaGetTime();
+        InFlight ++;
+        Stats.Submitted ++;
+        Prefetched.push_back(job);
+        Queue.push_back(job);
+        WakeUpWorker();
+    CS.Leave();
+
+    return SVL_OK;
+}
+
+int svlImageIOAsync::Read(svlSampleImage &image, const unsigned int videoch, const std::string &filename)
+{
+    if (videoch >= image.GetVideoChannels()) return SVL_FAIL;
+
+    Job* found = 0;
+    Job* job;
+
+    CS.Enter();
+        JobList::iterator iter = Prefetched.begin();
+        while (iter != Prefetched.end()) {
+            job = *iter;
+            if (job->VideoChannel != videoch) {
+                iter ++;
+                continue;
+            }
+            // Earlier files were skipped and unknown files mean that
+            // playback moved: discard everything up to the file found
+            iter = Prefetched.erase(iter);
+            if (job->FileName == filename) {
+                found = job;
+                break;
+            }
+            RecycleJob(job);
+        }
+
+        if (found) {
+            while (found->Status == Job::Waiting || found->Status == Job::Processing) {
+                WaitForJobDone();
+            }
+        }
+    CS.Leave();
+
+    int ret = SVL_FAIL;
+    if (found) {
+        if (found->Status == Job::Done &&
+            found->Image->GetWidth(videoch) == image.GetWidth(videoch) &&
+            found->Image->GetHeight(videoch) == image.GetHeight(videoch)) {
+            memcpy(image.GetUCharPointer(videoch), found->Image->GetUCharPointer(videoch), image.GetDataSize(videoch));
+            ret = SVL_OK;
+        }
+        CS.Enter();
+            RecycleJob(found);
+        CS.Leave();
+    }
+
+    // Not prefetched or failed: read file synchronously
+    if (ret != SVL_OK) ret = svlImageIO::Read(image, videoch, filename, true);
+
+    return ret;
+}
+
+void svlImageIOAsync::CancelPrefetch()
+{
+    CS.Enter();
+        JobList::iterator iter;
+        for (iter = Prefetched.begin(); iter != Prefetched.end(); iter ++) RecycleJob(*iter);
+        Prefetched.clear();
+    CS.Leave();
+}
+
+void svlImageIOAsync::GetStatistics(Statistics &stats) const
+{
+    CS.Enter();
+        stats = Stats;
+        stats.Pending = InFlight;
+        const unsigned int completed = Stats.Completed + Stats.Failed;
+        if (completed > 0) stats.AverageLatency = LatencySum / completed;
+        const double elapsed = osaGetTime() - StartTime;
+        if (elapsed > 0.0) stats.Throughput = Stats.Completed / elapsed;
+    CS.Leave();
+}
+
+void svlImageIOAsync::ResetStatistics()
+{
+    CS.Enter();
+        Stats = Statistics();
+        LatencySum = 0.0;
+        StartTime = osaGetTime();
+    CS.Leave();
+}
+
+void* svlImageIOAsync::WorkerProc(unsigned int CMN_UNUSED(id))
+{
+    osaThreadSignal wakeup;
+    Job* job;
+    int ret;
+
+    while (1) {
+        job = 0;
+        CS.Enter();
+            IdleWorkers.remove(&wakeup);
+            if (!Queue.empty()) {
+                job = Queue.front();
+                Queue.pop_front();
+                job->Status = Job::Processing;
+            }
+            else if (StopRequested) {
+                CS.Leave();
+                break;
+            }
+            else IdleWorkers.push_back(&wakeup);
+        CS.Leave();
+
+        if (job == 0) {
+            wakeup.Wait();
+            continue;
+        }
+
+        if (job->IsWrite) ret = svlImageIO::Write(*(job->Image), job->VideoChannel, job->FileName, job->Compression);
+        else ret = svlImageIO::Read(*(job->Image), job->VideoChannel, job->FileName, false);
+
+        CompleteJob(job, ret == SVL_OK);
+    }
+
+    return 0;
+}
+
+svlImageIOAsync::Job* svlImageIOAsync::GetJob(const svlSampleImage &image, const unsigned int videoch)
+{
+    // Called from within the critical section
+    Job* job = 0;
+    JobList::iterator iter;
+    for (iter = FreeJobs.begin(); iter != FreeJobs.end(); iter ++) {
+        if ((*iter)->Image->GetType() == image.GetType()) {
+            job = *iter;
+            FreeJobs.erase(iter);
+            break;
+        }
+    }
+    if (job == 0) {
+        job = new Job(dynamic_cast<svlSampleImage*>(image.GetNewInstance()));
+    }
+
+    // Only the channel used by the job is allocated
+    job->Image->SetSize(videoch, image.GetWidth(videoch), image.GetHeight(videoch));
+    job->Status = Job::Waiting;
+    job->Discarded = false;
+
+    return job;
+}
+
+void svlImageIOAsync::RecycleJob(Job* job)
+{
+    // Called from within the critical section
+    if (job->Status == Job::Waiting) {
+        // Not started yet: remove from queue
+        JobList::iterator iter;
+        for (iter = Queue.begin(); iter != Queue.end(); iter ++) {
+            if (*iter == job) {
+                Queue.erase(iter);
+                InFlight --;
+                break;
+            }
+        }
+    }
+    else if (job->Status == Job::Processing) {
+        // Still owned by a worker, recycled once done
+        job->Discarded = true;
+        return;
+    }
+    FreeJobs.push_back(job);
+}
+
+void svlImageIOAsync::CompleteJob(Job* job, bool success)
+{
+    CS.Enter();
+        const double latency = osaGetTime() - job->SubmitTime;
+        LatencySum += latency;
+        if (latency > Stats.MaximumLatency) Stats.MaximumLatency = latency;
+        if (success) Stats.Completed ++;
+        else {
+            Stats.Failed ++;
+            if (job->IsWrite) {
+                CMN_LOG_CLASS_RUN_ERROR << "CompleteJob: failed to write \"" << job->FileName << "\"" << std::endl;
+            }
+        }
+
+        job->Status = success ? Job::Done : Job::Failed;
+        InFlight --;
+        if (job->IsWrite || job->Discarded) FreeJobs.push_back(job);
+        RaiseAll(JobWaiters);
+    CS.Leave();
+}
+
+void svlImageIOAsync::WaitForJobDone()
+{
+    // Called from within the critical section
+    osaThreadSignal done;
+    JobWaiters.push_back(&done);
+    CS.Leave();
+
+    done.Wait();
+
+    CS.Enter();
+    JobWaiters.remove(&done);
+}
+
+void svlImageIOAsync::WakeUpWorker()
+{
+    // Called from within the critical section
+    if (!IdleWorkers.empty()) {
+        IdleWorkers.front()->Raise();
+        IdleWorkers.pop_front();
+    }
+}
+
+void svlImageIOAsync::RaiseAll(SignalList &signals)
+{
+    // Called from within the critical section
+    SignalList::iterator iter;
+    for (iter = signals.begin(); iter != signals.end(); iter ++) (*iter)->Raise();
+    signals.clear();
+}
@@ -20,6 +20,8 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlImageProcessing.h>
+#include <cisstStereoVision/svlProcInfo.h>
+#include <cisstStereoVision/svlSyncPoint.h>
 #include "svlImageProcessingHelper.h"
 
 
@@ -342,7 +344,7 @@ int svlImageProcessing::Resize(svlSampleImage* src_img, unsigned int src_videoch
     else if (!interpolation && weq && src_height == (dst_height << 1)) {
         // Special case: decimate by 2 vertically
 
-        const unsigned int stride  = src_width * 3;
+        const unsigned int stride  = src_width * src_img->GetBPP();
         const unsigned int stride2 = stride << 1;
         unsigned char *src_buf = src_img->GetUCharPointer(src_videoch);
         unsigned char *dst_buf = dst_img->GetUCharPointer(dst_videoch);
@@ -460,6 +462,64 @@ int svlImageProcessing::Resize(svlSampleImage* src_img, unsigned int src_videoch
 }
 
 
+int svlImageProcessing::Resize(svlSampleImage* src_img, unsigned int src_videoch,
+                               svlSampleImage* dst_img, unsigned int dst_videoch,
+                               RS_Method method,
+                               Internals& internals,
+                               svlProcInfo* procInfo)
+{
+    if (!src_img || !dst_img ||                               // source or destination is zero
+        src_img->GetVideoChannels() <= src_videoch ||         // source has no such video channel
+        dst_img->GetVideoChannels() <= dst_videoch ||         // destination has no such video channel
+        src_img->GetPixelType() != dst_img->GetPixelType() || // image type mismatch
+        (src_img->GetBPP() != 1 &&                            // pixel type is not Mono8
+         src_img->GetBPP() != 3)) {                           // pixel type is not RGB
+        return SVL_FAIL;
+    }
+
+    const unsigned int src_width  = src_img->GetWidth(src_videoch);
+    const unsigned int src_height = src_img->GetHeight(src_videoch);
+    const unsigned int dst_width  = dst_img->GetWidth(dst_videoch);
+    const unsigned int dst_height = dst_img->GetHeight(dst_videoch);
+    if (src_width == 0 || src_height == 0 || dst_width == 0 || dst_height == 0) return SVL_FAIL;
+
+    const unsigned int threadcount = procInfo ? procInfo->count : 1;
+    const unsigned int thread      = procInfo ? procInfo->ID : 0;
+
+    if (src_width == dst_width && src_height == dst_height) {
+        if (thread == 0) {
+            memcpy(dst_img->GetUCharPointer(dst_videoch), src_img->GetUCharPointer(src_videoch), src_img->GetDataSize(src_videoch));
+        }
+        return SVL_OK;
+    }
+
+    svlImageProcessingHelper::ResizeInternals* resize = 0;
+
+    if (thread == 0) {
+        resize = dynamic_cast<svlImageProcessingHelper::ResizeInternals*>(internals.Get());
+        if (resize == 0) {
+            resize = new svlImageProcessingHelper::ResizeInternals;
+            internals.Set(resize);
+        }
+        resize->Setup(src_width, src_height, dst_width, dst_height, src_img->GetBPP(), method, threadcount);
+    }
+
+    unsigned int from = 0, to = dst_height;
+
+    if (procInfo) {
+        // Wait until coefficient tables and work buffers are ready
+        _SynchronizeThreads(procInfo);
+
+        if (thread != 0) resize = dynamic_cast<svlImageProcessingHelper::ResizeInternals*>(internals.Get());
+        _GetParallelSubRange(procInfo, dst_height, from, to);
+    }
+
+    if (from < to) resize->Resize(src_img->GetUCharPointer(src_videoch), dst_img->GetUCharPointer(dst_videoch), from, to, thread);
+
+    return SVL_OK;
+}
+
+
 int svlImageProcessing::Deinterlace(svlSampleImage* image, unsigned int videoch, svlImageProcessing::DI_Algorithm algorithm)
 {
     if (!image || image->GetVideoChannels() <= videoch || image->GetBPP() != 3) return SVL_FAIL;
@@ -753,7 +813,7 @@ int svlImageProcessing::SetExposure(svlSampleImage* image, unsigned int videoch,
     const unsigned int datachannels = image->GetDataChannels();
     const unsigned int toskip = (image->GetAlphaChannel() >= 0) ? 1 : 0;
     unsigned int pixelcount = image->GetWidth(videoch) * image->GetHeight(videoch);
-    vctFixedSizeVectorRef<unsigned char, 255, 1> curve(exposure->Curve);
+    vctFixedSizeVectorRef<unsigned char, 256, 1> curve(exposure->Curve);
 
     unsigned char* ptr = image->GetUCharPointer(videoch);
     unsigned int i;
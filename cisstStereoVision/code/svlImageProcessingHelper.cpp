@@ -23,6 +23,7 @@ http://www.cisst.org/cisst/license.txt.
 #include "cisstCommon/cmnPortability.h"
 #include <fstream>
 #include <cmath>
+#include <algorithm>
 
 
 /*****************************************/
@@ -1689,6 +1690,278 @@ void svlImageProcessingHelper::DeinterlaceAdaptiveDiscarding(unsigned char* buff
 }
 
 
+/*******************************************************/
+/*** svlImageProcessingHelper::ResizeInternals class ***/
+/*******************************************************/
+
+// Weights are 14 bit fixed-point numbers; horizontally resampled rows
+// keep 8 extra bits of precision so that the vertical pass sums at
+// most 255 * 2^8 * 2^14 < 2^31
+#define RESIZE_WEIGHT_BITS 14
+#define RESIZE_ROW_BITS    8
+
+svlImageProcessingHelper::ResizeInternals::ResizeInternals() :
+    svlImageProcessingInternals(),
+    SrcWidth(0),
+    SrcHeight(0),
+    DstWidth(0),
+    DstHeight(0),
+    Channels(0),
+    Method(svlImageProcessing::RS_Nearest)
+{
+}
+
+void svlImageProcessingHelper::ResizeInternals::Table::Compute(unsigned int srcsize, unsigned int dstsize, svlImageProcessing::RS_Method method)
+{
+    const int one = 1 << RESIZE_WEIGHT_BITS;
+    const double scale = static_cast<double>(srcsize) / dstsize;
+    const bool area = (method == svlImageProcessing::RS_Area && scale > 1.0);
+    std::vector<double> coeffs;
+    int i, k, first, last, start, sum, largest;
+    double pos, from, to;
+
+    if (method == svlImageProcessing::RS_Nearest) Taps = 1;
+    else if (area) {
+        // Widest span of input samples covered by an output sample;
+        // scale + 1 in general but only scale for integer ratios
+        Taps = 1;
+        for (i = 0; i < static_cast<int>(dstsize); i ++) {
+            first = static_cast<int>(i * scale);
+            last = std::min(static_cast<int>(ceil((i + 1) * scale)) - 1, static_cast<int>(srcsize) - 1);
+            Taps = std::max(Taps, static_cast<unsigned int>(last - first + 1));
+        }
+    }
+    else Taps = 2;
+    if (Taps > srcsize) Taps = srcsize;
+
+    Start.SetSize(dstsize);
+    Weights.SetSize(dstsize * Taps);
+    Weights.SetAll(0);
+
+    for (i = 0; i < static_cast<int>(dstsize); i ++) {
+
+        // Contributing input samples [first, last] and their coefficients
+        if (method == svlImageProcessing::RS_Nearest) {
+            first = last = std::min(static_cast<int>((i + 0.5) * scale), static_cast<int>(srcsize) - 1);
+            coeffs.assign(1, 1.0);
+        }
+        else if (area) {
+            from = i * scale;
+            to = (i + 1) * scale;
+            first = static_cast<int>(from);
+            last = std::min(static_cast<int>(ceil(to)) - 1, static_cast<int>(srcsize) - 1);
+            coeffs.resize(last - first + 1);
+            for (k = first; k <= last; k ++) {
+                coeffs[k - first] = (std::min(to, k + 1.0) - std::max(from, static_cast<double>(k))) / scale;
+            }
+        }
+        else {
+            pos = std::max((i + 0.5) * scale - 0.5, 0.0);
+            first = static_cast<int>(pos);
+            if (first >= static_cast<int>(srcsize) - 1) {
+                first = last = srcsize - 1;
+                coeffs.assign(1, 1.0);
+            }
+            else {
+                last = first + 1;
+                coeffs.resize(2);
+                coeffs[1] = pos - first;
+                coeffs[0] = 1.0 - coeffs[1];
+            }
+        }
+
+        // Window of Taps samples inside the input
+        start = std::min(first, static_cast<int>(srcsize - Taps));
+        Start[i] = start;
+
+        int* weights = Weights.Pointer(i * Taps);
+        sum = 0;
+        largest = first - start;
+        for (k = first; k <= last; k ++) {
+            weights[k - start] = static_cast<int>(coeffs[k - first] * one + 0.5);
+            sum += weights[k - start];
+            if (weights[k - start] > weights[largest]) largest = k - start;
+        }
+        // Weights add up to exactly one
+        weights[largest] += one - sum;
+    }
+}
+
+void svlImageProcessingHelper::ResizeInternals::Setup(unsigned int srcwidth, unsigned int srcheight,
+                                                      unsigned int dstwidth, unsigned int dstheight,
+                                                      unsigned int channels, svlImageProcessing::RS_Method method,
+                                                      unsigned int threadcount)
+{
+    if (srcwidth  != SrcWidth  || srcheight != SrcHeight ||
+        dstwidth  != DstWidth  || dstheight != DstHeight ||
+        channels  != Channels  || method    != Method) {
+
+        Horizontal.Compute(srcwidth, dstwidth, method);
+        Vertical.Compute(srcheight, dstheight, method);
+
+        SrcWidth  = srcwidth;
+        SrcHeight = srcheight;
+        DstWidth  = dstwidth;
+        DstHeight = dstheight;
+        Channels  = channels;
+        Method    = method;
+    }
+
+    if (Buffers.size() < threadcount) Buffers.resize(threadcount);
+
+    if (Method == svlImageProcessing::RS_Nearest) return;
+
+    const unsigned int rowsize = DstWidth * Channels;
+    for (unsigned int i = 0; i < Buffers.size(); i ++) {
+        WorkBuffer& buffer = Buffers[i];
+        if (buffer.Rows.rows() != Vertical.Taps || buffer.Rows.cols() != rowsize) {
+            buffer.Rows.SetSize(Vertical.Taps, rowsize);
+            buffer.RowIndex.SetSize(Vertical.Taps);
+            buffer.Accumulator.SetSize(rowsize);
+        }
+    }
+}
+
+void svlImageProcessingHelper::ResizeInternals::Resize(const unsigned char* src, unsigned char* dst,
+                                                       unsigned int from, unsigned int to, unsigned int thread)
+{
+    const unsigned int srcstride = SrcWidth * Channels;
+    const unsigned int rowsize = DstWidth * Channels;
+    unsigned int x, y, k;
+
+    if (Method == svlImageProcessing::RS_Nearest) {
+        const int* hstart = Horizontal.Start.Pointer();
+        const unsigned char* psrc;
+        unsigned char* pdst;
+
+        for (y = from; y < to; y ++) {
+            psrc = src + Vertical.Start[y] * srcstride;
+            pdst = dst + y * rowsize;
+            if (Channels == 1) {
+                for (x = 0; x < DstWidth; x ++) pdst[x] = psrc[hstart[x]];
+            }
+            else {
+                for (x = 0; x < DstWidth; x ++) {
+                    pdst[0] = psrc[hstart[x] * 3];
+                    pdst[1] = psrc[hstart[x] * 3 + 1];
+                    pdst[2] = psrc[hstart[x] * 3 + 2];
+                    pdst += 3;
+                }
+            }
+        }
+        return;
+    }
+
+    WorkBuffer& buffer = Buffers[thread];
+    const unsigned int slots = Vertical.Taps;
+    const int shift = RESIZE_WEIGHT_BITS + RESIZE_ROW_BITS;
+    const int round = 1 << (shift - 1);
+    int* acc = buffer.Accumulator.Pointer();
+    const unsigned short* row;
+    unsigned char* pdst;
+    unsigned int slot, sy;
+    int w;
+    bool first;
+
+    // Rows cached from the previous image are not valid
+    buffer.RowIndex.SetAll(-1);
+
+    for (y = from; y < to; y ++) {
+        const int* weights = Vertical.Weights.Pointer(y * slots);
+        first = true;
+
+        for (k = 0; k < slots; k ++) {
+            w = weights[k];
+            if (w == 0) continue;
+
+            // Input rows are resampled horizontally only once and kept
+            // in a ring buffer while they contribute to output rows
+            sy = Vertical.Start[y] + k;
+            slot = sy % slots;
+            if (buffer.RowIndex[slot] != static_cast<int>(sy)) {
+                ResampleRow(src + sy * srcstride, buffer.Rows.Pointer(slot, 0));
+                buffer.RowIndex[slot] = sy;
+            }
+            row = buffer.Rows.Pointer(slot, 0);
+
+            // Simple loops on contiguous arrays for auto-vectorization
+            if (first) {
+                for (x = 0; x < rowsize; x ++) acc[x] = w * row[x];
+                first = false;
+            }
+            else {
+                for (x = 0; x < rowsize; x ++) acc[x] += w * row[x];
+            }
+        }
+
+        pdst = dst + y * rowsize;
+        for (x = 0; x < rowsize; x ++) pdst[x] = static_cast<unsigned char>((acc[x] + round) >> shift);
+    }
+}
+
+void svlImageProcessingHelper::ResizeInternals::ResampleRow(const unsigned char* src, unsigned short* dst)
+{
+    const int shift = RESIZE_WEIGHT_BITS - RESIZE_ROW_BITS;
+    const int round = 1 << (shift - 1);
+    const unsigned int taps = Horizontal.Taps;
+    const int* start = Horizontal.Start.Pointer();
+    const int* weights = Horizontal.Weights.Pointer();
+    const unsigned char* psrc;
+    unsigned int x, k;
+    int s0, s1, s2;
+
+    if (Channels == 1) {
+        if (taps == 2) {
+            for (x = 0; x < DstWidth; x ++) {
+                psrc = src + start[x];
+                s0 = weights[0] * psrc[0] + weights[1] * psrc[1];
+                dst[x] = static_cast<unsigned short>((s0 + round) >> shift);
+                weights += 2;
+            }
+        }
+        else {
+            for (x = 0; x < DstWidth; x ++) {
+                psrc = src + start[x];
+                s0 = 0;
+                for (k = 0; k < taps; k ++) s0 += weights[k] * psrc[k];
+                dst[x] = static_cast<unsigned short>((s0 + round) >> shift);
+                weights += taps;
+            }
+        }
+    }
+    else if (taps == 2) {
+        for (x = 0; x < DstWidth; x ++) {
+            psrc = src + start[x] * 3;
+            s0 = weights[0] * psrc[0] + weights[1] * psrc[3];
+            s1 = weights[0] * psrc[1] + weights[1] * psrc[4];
+            s2 = weights[0] * psrc[2] + weights[1] * psrc[5];
+            dst[0] = static_cast<unsigned short>((s0 + round) >> shift);
+            dst[1] = static_cast<unsigned short>((s1 + round) >> shift);
+            dst[2] = static_cast<unsigned short>((s2 + round) >> shift);
+            dst += 3;
+            weights += 2;
+        }
+    }
+    else {
+        for (x = 0; x < DstWidth; x ++) {
+            psrc = src + start[x] * 3;
+            s0 = s1 = s2 = 0;
+            for (k = 0; k < taps; k ++) {
+                s0 += weights[k] * psrc[0];
+                s1 += weights[k] * psrc[1];
+                s2 += weights[k] * psrc[2];
+                psrc += 3;
+            }
+            dst[0] = static_cast<unsigned short>((s0 + round) >> shift);
+            dst[1] = static_cast<unsigned short>((s1 + round) >> shift);
+            dst[2] = static_cast<unsigned short>((s2 + round) >> shift);
+            dst += 3;
+            weights += taps;
+        }
+    }
+}
+
+
 /**************************************************************/
 /*** svlImageProcessingHelper::RectificationInternals class ***/
 /**************************************************************/
@@ -2814,7 +3087,7 @@ svlImageProcessingHelper::ExposureInternals::ExposureInternals() :
     Gamma(0.0),
     Modified(true)
 {
-    Curve.SetSize(255);
+    Curve.SetSize(256);
     Curve.SetAll(0);
 }
 
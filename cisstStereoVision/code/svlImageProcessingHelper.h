@@ -26,7 +26,9 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstVector/vctFixedSizeMatrixTypes.h>
 #include <cisstVector/vctFixedSizeVectorTypes.h>
 #include <cisstVector/vctDynamicMatrixTypes.h>
+#include <cisstStereoVision/svlImageProcessing.h>
 #include <string>
+#include <vector>
 
 #if CISST_SVL_HAS_CISSTNETLIB
     #include <cisstNumerical/nmrNetlib.h>
@@ -161,6 +163,48 @@ namespace svlImageProcessingHelper
                                       unsigned char* dst, const unsigned int dstheight,
                                       const unsigned int width);
 
+    class CISST_EXPORT ResizeInternals : public svlImageProcessingInternals
+    {
+    public:
+        ResizeInternals();
+
+        // Recomputes the coefficient tables only if parameters changed
+        void Setup(unsigned int srcwidth, unsigned int srcheight,
+                   unsigned int dstwidth, unsigned int dstheight,
+                   unsigned int channels, svlImageProcessing::RS_Method method, unsigned int threadcount);
+        // Resamples destination rows [from, to), thread specifies the work buffer
+        void Resize(const unsigned char* src, unsigned char* dst,
+                    unsigned int from, unsigned int to, unsigned int thread);
+
+    private:
+        // Per output sample: first input sample and fixed-point weights
+        class Table
+        {
+        public:
+            void Compute(unsigned int srcsize, unsigned int dstsize, svlImageProcessing::RS_Method method);
+
+            unsigned int Taps;
+            vctDynamicVector<int> Start;
+            vctDynamicVector<int> Weights;
+        };
+
+        // Horizontally resampled input rows cached by each thread
+        class WorkBuffer
+        {
+        public:
+            vctDynamicMatrix<unsigned short> Rows;
+            vctDynamicVector<int> RowIndex;
+            vctDynamicVector<int> Accumulator;
+        };
+
+        void ResampleRow(const unsigned char* src, unsigned short* dst);
+
+        unsigned int SrcWidth, SrcHeight, DstWidth, DstHeight, Channels;
+        svlImageProcessing::RS_Method Method;
+        Table Horizontal, Vertical;
+        std::vector<WorkBuffer> Buffers;
+    };
+
     ///////////////////
     // Deinterlacing //
     ///////////////////
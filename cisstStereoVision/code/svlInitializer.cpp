@@ -160,6 +160,10 @@ void svlInitialize()
     SVL_INITIALIZE(svlFilterImageThresholding);
 #endif // _svlFilterImageThresholding_h
 
+#ifdef _svlFilterImagePointOperations_h
+    SVL_INITIALIZE(svlFilterImagePointOperations);
+#endif // _svlFilterImagePointOperations_h
+
 #ifdef _svlFilterImageUnsharpMask_h
     SVL_INITIALIZE(svlFilterImageUnsharpMask);
 #endif // _svlFilterImageUnsharpMask_h
@@ -228,6 +232,10 @@ void svlInitialize()
     SVL_INITIALIZE(svlFilterVideoFileWriter);
 #endif // _svlFilterVideoFileWriter_h
 
+#ifdef _svlFilterSharedMemoryWriter_h
+    SVL_INITIALIZE(svlFilterSharedMemoryWriter);
+#endif // _svlFilterSharedMemoryWriter_h
+
 #ifdef _svlFilterImageWindow_h
     SVL_INITIALIZE(svlFilterImageWindow);
 #endif // _svlFilterImageWindow_h
@@ -240,6 +248,10 @@ void svlInitialize()
     SVL_INITIALIZE(svlFilterSourceBuffer);
 #endif // _svlFilterSourceBuffer_h
 
+#ifdef _svlFilterSourceSharedMemory_h
+    SVL_INITIALIZE(svlFilterSourceSharedMemory);
+#endif // _svlFilterSourceSharedMemory_h
+
 #ifdef _svlFilterSourceTextFile_h
     SVL_INITIALIZE(svlFilterSourceTextFile);
 #endif // _svlFilterSourceTextFile_h
@@ -25,6 +25,126 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlBufferImage.h>
 
 
+/*******************************/
+/*** Helper functions **********/
+/*******************************/
+
+// Corners of an image of the specified size centered at the origin
+// and transformed by the specified 2D homogeneous transformation
+static void _TransformImageQuad(const vct3x3 & transform, const int width, const int height, svlQuad & quad_in, svlQuad & quad_out)
+{
+    const int iulx = 0, iuly = 0, illx = 0, iury = 0;
+    const int iurx = width  - 1, ilrx = width  - 1;
+    const int illy = height - 1, ilry = height - 1;
+    const int halfwidth  = width  / 2;
+    const int halfheight = height / 2;
+    const double m00 = transform.Element(0, 0);
+    const double m01 = transform.Element(0, 1);
+    const double m02 = transform.Element(0, 2);
+    const double m10 = transform.Element(1, 0);
+    const double m11 = transform.Element(1, 1);
+    const double m12 = transform.Element(1, 2);
+    double x, y;
+
+    x = iulx - halfwidth; y = iuly - halfheight;
+    const int oulx = static_cast<int>(x * m00 + y * m01 + m02);
+    const int ouly = static_cast<int>(x * m10 + y * m11 + m12);
+
+    x = iurx - halfwidth; y = iury - halfheight;
+    const int ourx = static_cast<int>(x * m00 + y * m01 + m02);
+    const int oury = static_cast<int>(x * m10 + y * m11 + m12);
+
+    x = illx - halfwidth; y = illy - halfheight;
+    const int ollx = static_cast<int>(x * m00 + y * m01 + m02);
+    const int olly = static_cast<int>(x * m10 + y * m11 + m12);
+
+    x = ilrx - halfwidth; y = ilry - halfheight;
+    const int olrx = static_cast<int>(x * m00 + y * m01 + m02);
+    const int olry = static_cast<int>(x * m10 + y * m11 + m12);
+
+    quad_in.Assign(iulx, iuly, iurx, iury, ilrx, ilry, illx, illy);
+    quad_out.Assign(oulx, ouly, ourx, oury, olrx, olry, ollx, olly);
+}
+
+// Copies or blends an image on the background at the specified position;
+// the rows of the overlay are distributed among threads
+static void _BlendImage(svlSampleImage* bgimage, const unsigned int videoch,
+                        const unsigned char* ovrlimage, const int ovrlwidth, const int ovrlheight,
+                        const vctInt2 & pos, const unsigned char alpha,
+                        const unsigned int thread_count, const unsigned int thread_id)
+{
+    int i, j, ws, hs, wo, xs, ys, xo, yo, copylen, linecount;
+
+    // Prepare for data copy
+    ws = static_cast<int>(bgimage->GetWidth(videoch) * bgimage->GetBPP());
+    hs = static_cast<int>(bgimage->GetHeight(videoch));
+    wo = ovrlwidth * bgimage->GetBPP();
+
+    copylen = wo;
+    linecount = ovrlheight;
+    xs = pos.X() * bgimage->GetBPP();
+    ys = pos.Y();
+    xo = yo = 0;
+
+    // If overlay position reaches out of the background on the left
+    if (xs < 0) {
+        copylen += xs;
+        xo -= xs;
+        xs = 0;
+    }
+    // If overlay position reaches out of the background on the right
+    if ((xs + copylen) > ws) {
+        copylen += ws - (xs + copylen);
+    }
+    // If overlay is outside the background boundaries
+    if (copylen <= 0) return;
+
+    // If overlay position reaches out of the background on the top
+    if (ys < 0) {
+        linecount += ys;
+        yo -= ys;
+        ys = 0;
+    }
+    // If overlay position reaches out of the background on the bottom
+    if ((ys + linecount) > hs) {
+        linecount += hs - (ys + linecount);
+    }
+    // If overlay is outside the background boundaries
+    if (linecount <= 0) return;
+
+    // Range of lines processed by this thread
+    int to = linecount / static_cast<int>(thread_count) + 1;
+    const int from = static_cast<int>(thread_id) * to;
+    to += from;
+    if (to > linecount) to = linecount;
+    if (from >= to) return;
+
+    unsigned char *bgdata = bgimage->GetUCharPointer(videoch) + ((ys + from) * ws) + xs;
+    const unsigned char *ovrldata = ovrlimage + ((yo + from) * wo) + xo;
+
+    if (alpha == 255) {
+        for (j = from; j < to; j ++) {
+            memcpy(bgdata, ovrldata, copylen);
+            bgdata += ws;
+            ovrldata += wo;
+        }
+    }
+    else {
+        const unsigned int w1 = alpha + 1;
+        const unsigned int w0 = 256 - w1;
+
+        for (j = from; j < to; j ++) {
+            // Simple loop on contiguous arrays for auto-vectorization
+            for (i = 0; i < copylen; i ++) {
+                bgdata[i] = static_cast<unsigned char>((w0 * bgdata[i] + w1 * ovrldata[i]) >> 8);
+            }
+            bgdata += ws;
+            ovrldata += wo;
+        }
+    }
+}
+
+
 /****************************/
 /*** svlOverlay class *******/
 /****************************/
@@ -146,6 +266,33 @@ void svlOverlay::Draw(svlSampleImage* bgimage, svlSample* input)
     }
 }
 
+bool svlOverlay::PrepareDrawParallel(svlSample* CMN_UNUSED(input), unsigned int CMN_UNUSED(thread_count))
+{
+    return false;
+}
+
+void svlOverlay::DrawInternalParallel(svlSampleImage* CMN_UNUSED(bgimage), svlSample* CMN_UNUSED(input), unsigned int CMN_UNUSED(videoch),
+                                      unsigned int CMN_UNUSED(thread_count), unsigned int CMN_UNUSED(thread_id))
+{
+}
+
+void svlOverlay::DrawParallel(svlSampleImage* bgimage, svlSample* input, unsigned int thread_count, unsigned int thread_id)
+{
+    if (!bgimage || !Visible) return;
+
+    // VideoCh is not modified as it is accessed by multiple threads
+    if (VideoCh != SVL_ALL_CHANNELS) {
+        if (VideoCh < bgimage->GetVideoChannels()) {
+            DrawInternalParallel(bgimage, input, VideoCh, thread_count, thread_id);
+        }
+    }
+    else {
+        for (unsigned int vch = 0; vch < bgimage->GetVideoChannels(); vch ++) {
+            DrawInternalParallel(bgimage, input, vch, thread_count, thread_id);
+        }
+    }
+}
+
 
 /*********************************/
 /*** svlOverlayInput class *******/
@@ -201,7 +348,8 @@ svlOverlayImage::svlOverlayImage() :
     Pos(0, 0),
     Alpha(255),
     QuadMappingEnabled(false),
-    QuadMappingSet(false)
+    QuadMappingSet(false),
+    WarpInternalsMT(1)
 {
 }
 
@@ -217,7 +365,8 @@ svlOverlayImage::svlOverlayImage(unsigned int videoch,
     Pos(pos),
     Alpha(alpha),
     QuadMappingEnabled(false),
-    QuadMappingSet(false)
+    QuadMappingSet(false),
+    WarpInternalsMT(1)
 {
 }
 
@@ -296,6 +445,24 @@ bool svlOverlayImage::IsInputTypeValid(svlStreamType inputtype)
 }
 
 void svlOverlayImage::DrawInternal(svlSampleImage* bgimage, svlSample* input)
+{
+    DrawImage(bgimage, input, VideoCh, 1, 0);
+}
+
+bool svlOverlayImage::PrepareDrawParallel(svlSample* CMN_UNUSED(input), unsigned int thread_count)
+{
+    WarpInternalsMT.SetThreadCount(thread_count);
+    return true;
+}
+
+void svlOverlayImage::DrawInternalParallel(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                                           unsigned int thread_count, unsigned int thread_id)
+{
+    DrawImage(bgimage, input, videoch, thread_count, thread_id);
+}
+
+void svlOverlayImage::DrawImage(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                                unsigned int thread_count, unsigned int thread_id)
 {
     // Skip drawing if fully transparent
     if (Alpha == 0) return;
@@ -308,123 +475,30 @@ void svlOverlayImage::DrawInternal(svlSampleImage* bgimage, svlSample* input)
         InputCh >= ovrlimage->GetVideoChannels() ||
         bgimage->GetBPP() != ovrlimage->GetBPP()) return;
 
-    if (QuadMappingEnabled && QuadMappingSet) {
-        const int ulx = 0, uly = 0, llx = 0, ury = 0;
-        const int urx = ovrlimage->GetWidth(InputCh)  - 1, lrx = ovrlimage->GetWidth(InputCh)  - 1;
-        const int lly = ovrlimage->GetHeight(InputCh) - 1, lry = ovrlimage->GetHeight(InputCh) - 1;
+    if ((QuadMappingEnabled && QuadMappingSet) || Transformed) {
         svlQuad quad_in, quad_out;
 
-        quad_in.Assign(ulx, uly, urx, ury, lrx, lry, llx, lly);
-        quad_out.Assign(QuadUL[0], QuadUL[1], QuadUR[0], QuadUR[1], QuadLR[0], QuadLR[1], QuadLL[0], QuadLL[1]);
-        svlDraw::WarpQuad(ovrlimage, InputCh, quad_in, bgimage, VideoCh, quad_out, WarpInternals, Alpha);
-
-        return;
-    }
-
-    if (Transformed) {
-        const int iulx = 0, iuly = 0, illx = 0, iury = 0;
-        const int iurx = ovrlimage->GetWidth(InputCh)  - 1, ilrx = ovrlimage->GetWidth(InputCh)  - 1;
-        const int illy = ovrlimage->GetHeight(InputCh) - 1, ilry = ovrlimage->GetHeight(InputCh) - 1;
-        const int halfwidth  = ovrlimage->GetWidth(InputCh)  / 2;
-        const int halfheight = ovrlimage->GetHeight(InputCh) / 2;
-        const double m00 = Transform.Element(0, 0);
-        const double m01 = Transform.Element(0, 1);
-        const double m02 = Transform.Element(0, 2);
-        const double m10 = Transform.Element(1, 0);
-        const double m11 = Transform.Element(1, 1);
-        const double m12 = Transform.Element(1, 2);
-        double x, y;
-
-        x = iulx - halfwidth; y = iuly - halfheight;
-        const int oulx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int ouly = static_cast<int>(x * m10 + y * m11 + m12);
-
-        x = iurx - halfwidth; y = iury - halfheight;
-        const int ourx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int oury = static_cast<int>(x * m10 + y * m11 + m12);
-
-        x = illx - halfwidth; y = illy - halfheight;
-        const int ollx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int olly = static_cast<int>(x * m10 + y * m11 + m12);
+        if (QuadMappingEnabled && QuadMappingSet) {
+            const int ulx = 0, uly = 0, llx = 0, ury = 0;
+            const int urx = ovrlimage->GetWidth(InputCh)  - 1, lrx = ovrlimage->GetWidth(InputCh)  - 1;
+            const int lly = ovrlimage->GetHeight(InputCh) - 1, lry = ovrlimage->GetHeight(InputCh) - 1;
 
-        x = ilrx - halfwidth; y = ilry - halfheight;
-        const int olrx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int olry = static_cast<int>(x * m10 + y * m11 + m12);
-
-        svlQuad quad_in, quad_out;
+            quad_in.Assign(ulx, uly, urx, ury, lrx, lry, llx, lly);
+            quad_out.Assign(QuadUL[0], QuadUL[1], QuadUR[0], QuadUR[1], QuadLR[0], QuadLR[1], QuadLL[0], QuadLL[1]);
+        }
+        else {
+            _TransformImageQuad(Transform, ovrlimage->GetWidth(InputCh), ovrlimage->GetHeight(InputCh), quad_in, quad_out);
+        }
 
-        quad_in.Assign(iulx, iuly, iurx, iury, ilrx, ilry, illx, illy);
-        quad_out.Assign(oulx, ouly, ourx, oury, olrx, olry, ollx, olly);
-        svlDraw::WarpQuad(ovrlimage, InputCh, quad_in, bgimage, VideoCh, quad_out, WarpInternals, Alpha);
+        if (thread_count > 1) WarpInternalsMT.WarpQuad(thread_id, ovrlimage, InputCh, quad_in, bgimage, videoch, quad_out, Alpha);
+        else svlDraw::WarpQuad(ovrlimage, InputCh, quad_in, bgimage, videoch, quad_out, WarpInternals, Alpha);
 
         return;
     }
 
-    int i, ws, hs, wo, ho, xs, ys, xo, yo, copylen, linecount;
-
-    // Prepare for data copy
-    ws = static_cast<int>(bgimage->GetWidth(VideoCh) * bgimage->GetBPP());
-    hs = static_cast<int>(bgimage->GetHeight(VideoCh));
-    wo = static_cast<int>(ovrlimage->GetWidth(InputCh) * bgimage->GetBPP());
-    ho = static_cast<int>(ovrlimage->GetHeight(InputCh));
-
-    copylen = wo;
-    linecount = ho;
-    xs = Pos.X() * bgimage->GetBPP();
-    ys = Pos.Y();
-    xo = yo = 0;
-
-    // If overlay position reaches out of the background on the left
-    if (xs < 0) {
-        copylen += xs;
-        xo -= xs;
-        xs = 0;
-    }
-    // If overlay position reaches out of the background on the right
-    if ((xs + copylen) > ws) {
-        copylen += ws - (xs + copylen);
-    }
-    // If overlay is outside the background boundaries
-    if (copylen <= 0) return;
-
-    // If overlay position reaches out of the background on the top
-    if (ys < 0) {
-        linecount += ys;
-        yo -= ys;
-        ys = 0;
-    }
-    // If overlay position reaches out of the background on the bottom
-    if ((ys + linecount) > hs) {
-        linecount += hs - (ys + linecount);
-    }
-    // If overlay is outside the background boundaries
-    if (linecount <= 0) return;
-
-    unsigned char *bgdata = bgimage->GetUCharPointer(VideoCh) + (ys * ws) + xs;
-    unsigned char *ovrldata = ovrlimage->GetUCharPointer(InputCh) + (yo * wo) + xo;
-
-    if (Alpha == 255) {
-        for (i = 0; i < linecount; i ++) {
-            memcpy(bgdata, ovrldata, copylen);
-            bgdata += ws;
-            ovrldata += wo;
-        }
-    }
-    else {
-        const unsigned int w1 = Alpha + 1;
-        const unsigned int w0 = 256 - w1;
-        unsigned char *pbg, *pov;
-
-        for (int j = 0; j < linecount; j ++) {
-            pbg = bgdata;   bgdata   += ws;
-            pov = ovrldata; ovrldata += wo;
-
-            for (i = 0; i < copylen; i ++) {
-                *pbg = (w0 * (*pbg) + w1 * (*pov)) >> 8;
-                pov ++; pbg ++;
-            }
-        }
-    }
+    _BlendImage(bgimage, videoch,
+                ovrlimage->GetUCharPointer(InputCh), ovrlimage->GetWidth(InputCh), ovrlimage->GetHeight(InputCh),
+                Pos, Alpha, thread_count, thread_id);
 }
 
 
@@ -833,10 +907,12 @@ void svlOverlayToolTips::DrawInternal(svlSampleImage* bgimage, svlSample* input)
 svlOverlayStaticImage::svlOverlayStaticImage() :
     svlOverlay(),
     Buffer(0),
+    PulledImage(0),
     Pos(0, 0),
     Alpha(255),
     QuadMappingEnabled(false),
-    QuadMappingSet(false)
+    QuadMappingSet(false),
+    WarpInternalsMT(1)
 {
 }
 
@@ -847,10 +923,12 @@ svlOverlayStaticImage::svlOverlayStaticImage(unsigned int videoch,
                                              unsigned char alpha) :
     svlOverlay(videoch, visible),
     Buffer(0),
+    PulledImage(0),
     Pos(pos),
     Alpha(alpha),
     QuadMappingEnabled(false),
-    QuadMappingSet(false)
+    QuadMappingSet(false),
+    WarpInternalsMT(1)
 {
     SetImage(image);
 }
@@ -863,8 +941,12 @@ svlOverlayStaticImage::svlOverlayStaticImage(unsigned int videoch,
                                              unsigned char alpha) :
     svlOverlay(videoch, visible),
     Buffer(0),
+    PulledImage(0),
     Pos(pos),
-    Alpha(alpha)
+    Alpha(alpha),
+    QuadMappingEnabled(false),
+    QuadMappingSet(false),
+    WarpInternalsMT(1)
 {
     SetImage(image, imagech);
 }
@@ -969,132 +1051,55 @@ void svlOverlayStaticImage::DrawInternal(svlSampleImage* bgimage, svlSample* CMN
     // Skip drawing if fully transparent
     if (Alpha == 0) return;
 
-    svlImageRGB* ovrlimage = Buffer->Pull(false);
-    if (!ovrlimage) return;
-
-    if (QuadMappingEnabled && QuadMappingSet) {
-        svlSampleImageRGB _ovrlimage(false);
-        _ovrlimage.SetMatrix(*ovrlimage);
+    DrawImage(bgimage, Buffer->Pull(false), VideoCh, 1, 0);
+}
 
-        const int ulx = 0, uly = 0, llx = 0, ury = 0;
-        const int urx = _ovrlimage.GetWidth(0)  - 1, lrx = _ovrlimage.GetWidth(0)  - 1;
-        const int lly = _ovrlimage.GetHeight(0) - 1, lry = _ovrlimage.GetHeight(0) - 1;
-        svlQuad quad_in, quad_out;
+bool svlOverlayStaticImage::PrepareDrawParallel(svlSample* CMN_UNUSED(input), unsigned int thread_count)
+{
+    // The image buffer is pulled only once for all threads
+    PulledImage = (Buffer && Alpha > 0) ? Buffer->Pull(false) : 0;
+    WarpInternalsMT.SetThreadCount(thread_count);
+    return true;
+}
 
-        quad_in.Assign(ulx, uly, urx, ury, lrx, lry, llx, lly);
-        quad_out.Assign(QuadUL[0], QuadUL[1], QuadUR[0], QuadUR[1], QuadLR[0], QuadLR[1], QuadLL[0], QuadLL[1]);
-        svlDraw::WarpQuad(&_ovrlimage, 0, quad_in, bgimage, VideoCh, quad_out, WarpInternals, Alpha);
+void svlOverlayStaticImage::DrawInternalParallel(svlSampleImage* bgimage, svlSample* CMN_UNUSED(input), unsigned int videoch,
+                                                 unsigned int thread_count, unsigned int thread_id)
+{
+    DrawImage(bgimage, PulledImage, videoch, thread_count, thread_id);
+}
 
-        return;
-    }
+void svlOverlayStaticImage::DrawImage(svlSampleImage* bgimage, svlImageRGB* ovrlimage, unsigned int videoch,
+                                      unsigned int thread_count, unsigned int thread_id)
+{
+    if (!ovrlimage) return;
 
-    if (Transformed) {
+    if ((QuadMappingEnabled && QuadMappingSet) || Transformed) {
         svlSampleImageRGB _ovrlimage(false);
         _ovrlimage.SetMatrix(*ovrlimage);
-
-        const int iulx = 0, iuly = 0, illx = 0, iury = 0;
-        const int iurx = _ovrlimage.GetWidth(0)  - 1, ilrx = _ovrlimage.GetWidth(0)  - 1;
-        const int illy = _ovrlimage.GetHeight(0) - 1, ilry = _ovrlimage.GetHeight(0) - 1;
-        const int halfwidth  = _ovrlimage.GetWidth(0)  / 2;
-        const int halfheight = _ovrlimage.GetHeight(0) / 2;
-        const double m00 = Transform.Element(0, 0);
-        const double m01 = Transform.Element(0, 1);
-        const double m02 = Transform.Element(0, 2);
-        const double m10 = Transform.Element(1, 0);
-        const double m11 = Transform.Element(1, 1);
-        const double m12 = Transform.Element(1, 2);
-        double x, y;
-
-        x = iulx - halfwidth; y = iuly - halfheight;
-        const int oulx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int ouly = static_cast<int>(x * m10 + y * m11 + m12);
-
-        x = iurx - halfwidth; y = iury - halfheight;
-        const int ourx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int oury = static_cast<int>(x * m10 + y * m11 + m12);
-
-        x = illx - halfwidth; y = illy - halfheight;
-        const int ollx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int olly = static_cast<int>(x * m10 + y * m11 + m12);
-
-        x = ilrx - halfwidth; y = ilry - halfheight;
-        const int olrx = static_cast<int>(x * m00 + y * m01 + m02);
-        const int olry = static_cast<int>(x * m10 + y * m11 + m12);
-
         svlQuad quad_in, quad_out;
 
-        quad_in.Assign(iulx, iuly, iurx, iury, ilrx, ilry, illx, illy);
-        quad_out.Assign(oulx, ouly, ourx, oury, olrx, olry, ollx, olly);
-        svlDraw::WarpQuad(&_ovrlimage, 0, quad_in, bgimage, VideoCh, quad_out, WarpInternals, Alpha);
-
-        return;
-    }
-
-    int i, ws, hs, wo, ho, xs, ys, xo, yo, copylen, linecount;
-
-    // Prepare for data copy
-    ws = static_cast<int>(bgimage->GetWidth(VideoCh) * bgimage->GetBPP());
-    hs = static_cast<int>(bgimage->GetHeight(VideoCh));
-    wo = static_cast<int>(ovrlimage->cols());
-    ho = static_cast<int>(ovrlimage->rows());
-
-    copylen = wo;
-    linecount = ho;
-    xs = Pos.X() * bgimage->GetBPP();
-    ys = Pos.Y();
-    xo = yo = 0;
-
-    // If overlay position reaches out of the background on the left
-    if (xs < 0) {
-        copylen += xs;
-        xo -= xs;
-        xs = 0;
-    }
-    // If overlay position reaches out of the background on the right
-    if ((xs + copylen) > ws) {
-        copylen += ws - (xs + copylen);
-    }
-    // If overlay is outside the background boundaries
-    if (copylen <= 0) return;
-    
-    // If overlay position reaches out of the background on the top
-    if (ys < 0) {
-        linecount += ys;
-        yo -= ys;
-        ys = 0;
-    }
-    // If overlay position reaches out of the background on the bottom
-    if ((ys + linecount) > hs) {
-        linecount += hs - (ys + linecount);
-    }
-    // If overlay is outside the background boundaries
-    if (linecount <= 0) return;
-
-    unsigned char *bgdata = bgimage->GetUCharPointer(VideoCh) + (ys * ws) + xs;
-    unsigned char *ovrldata = ovrlimage->Pointer() + (yo * wo) + xo;
+        if (QuadMappingEnabled && QuadMappingSet) {
+            const int ulx = 0, uly = 0, llx = 0, ury = 0;
+            const int urx = _ovrlimage.GetWidth(0)  - 1, lrx = _ovrlimage.GetWidth(0)  - 1;
+            const int lly = _ovrlimage.GetHeight(0) - 1, lry = _ovrlimage.GetHeight(0) - 1;
 
-    if (Alpha == 255) {
-        for (i = 0; i < linecount; i ++) {
-            memcpy(bgdata, ovrldata, copylen);
-            bgdata += ws;
-            ovrldata += wo;
+            quad_in.Assign(ulx, uly, urx, ury, lrx, lry, llx, lly);
+            quad_out.Assign(QuadUL[0], QuadUL[1], QuadUR[0], QuadUR[1], QuadLR[0], QuadLR[1], QuadLL[0], QuadLL[1]);
+        }
+        else {
+            _TransformImageQuad(Transform, _ovrlimage.GetWidth(0), _ovrlimage.GetHeight(0), quad_in, quad_out);
         }
-    }
-    else {
-        const unsigned int w1 = Alpha + 1;
-        const unsigned int w0 = 256 - w1;
-        unsigned char *pbg, *pov;
 
-        for (int j = 0; j < linecount; j ++) {
-            pbg = bgdata;   bgdata   += ws;
-            pov = ovrldata; ovrldata += wo;
+        if (thread_count > 1) WarpInternalsMT.WarpQuad(thread_id, &_ovrlimage, 0, quad_in, bgimage, videoch, quad_out, Alpha);
+        else svlDraw::WarpQuad(&_ovrlimage, 0, quad_in, bgimage, videoch, quad_out, WarpInternals, Alpha);
 
-            for (i = 0; i < copylen; i ++) {
-                *pbg = (w0 * (*pbg) + w1 * (*pov)) >> 8;
-                pov ++; pbg ++;
-            }
-        }
+        return;
     }
+
+    // Buffer width is in bytes
+    _BlendImage(bgimage, videoch,
+                ovrlimage->Pointer(), static_cast<int>(ovrlimage->cols()) / static_cast<int>(bgimage->GetBPP()), static_cast<int>(ovrlimage->rows()),
+                Pos, Alpha, thread_count, thread_id);
 }
 
 
@@ -0,0 +1,326 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include "svlSharedMemoryRing.h"
+#include <cisstOSAbstraction/osaGetTime.h>
+
+#include <string.h>
+
+#if (CISST_OS == CISST_WINDOWS)
+    #include <windows.h>
+#else // CISST_OS != CISST_WINDOWS
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif // CISST_OS
+
+#define SHM_MAGIC       "svlSharedMemory"
+#define SHM_VERSION     1
+#define SHM_ALIGNMENT   64
+
+static inline unsigned long long int _Align(const unsigned long long int size)
+{
+    return (size + SHM_ALIGNMENT - 1) / SHM_ALIGNMENT * SHM_ALIGNMENT;
+}
+
+
+/*******************************************/
+/*** svlSharedMemoryRing::Header class *****/
+/*******************************************/
+
+class svlSharedMemoryRing::Header
+{
+public:
+    char Magic[16];
+    unsigned int Version;
+    int Type;
+    unsigned int SlotSize;
+    unsigned int SlotCount;
+    double CreationTime;
+    volatile unsigned int LatestSequence;
+    volatile unsigned int Closed;
+};
+
+
+/*********************************/
+/*** svlSharedMemoryRing class ***/
+/*********************************/
+
+svlSharedMemoryRing::svlSharedMemoryRing() :
+    Writer(false),
+    Memory(0),
+    MemorySize(0),
+    SegmentHeader(0),
+    WriteSequence(0),
+#if (CISST_OS == CISST_WINDOWS)
+    MappingHandle(0)
+#else // CISST_OS != CISST_WINDOWS
+    FileDescriptor(-1)
+#endif // CISST_OS
+{
+}
+
+svlSharedMemoryRing::~svlSharedMemoryRing()
+{
+    Close();
+}
+
+int svlSharedMemoryRing::Create(const std::string& name, const svlStreamType type, const unsigned int slotsize, const unsigned int slotcount)
+{
+    if (Memory || name.empty() || slotsize < 1 || slotcount < 2) return SVL_FAIL;
+
+    Name = name;
+    Writer = true;
+    MemorySize = _Align(sizeof(Header)) + slotcount * (_Align(sizeof(Slot)) + _Align(slotsize));
+
+    if (Map(true) != SVL_OK) return SVL_FAIL;
+
+    SegmentHeader = reinterpret_cast<Header*>(Memory);
+    memset(SegmentHeader, 0, sizeof(Header));
+    strncpy(SegmentHeader->Magic, SHM_MAGIC, sizeof(SegmentHeader->Magic));
+    SegmentHeader->Version      = SHM_VERSION;
+    SegmentHeader->Type         = type;
+    SegmentHeader->SlotSize     = static_cast<unsigned int>(_Align(slotsize));
+    SegmentHeader->SlotCount    = slotcount;
+    SegmentHeader->CreationTime = osaGetTime();
+    for (unsigned int i = 0; i < slotcount; i ++) {
+        memset(Memory + GetSlotOffset(i), 0, sizeof(Slot));
+    }
+    WriteSequence = 0;
+    Barrier();
+
+    return SVL_OK;
+}
+
+unsigned char* svlSharedMemoryRing::BeginWrite(Slot* &slot)
+{
+    if (!Memory || !Writer) return 0;
+
+    WriteSequence ++;
+    if (WriteSequence == 0) WriteSequence = 1;
+
+    unsigned char* ptr = Memory + GetSlotOffset(WriteSequence % SegmentHeader->SlotCount);
+    slot = reinterpret_cast<Slot*>(ptr);
+
+    // Invalidate slot before overwriting it
+    slot->Sequence = 0;
+    Barrier();
+
+    return ptr + _Align(sizeof(Slot));
+}
+
+void svlSharedMemoryRing::EndWrite()
+{
+    if (!Memory || !Writer) return;
+
+    Slot* slot = reinterpret_cast<Slot*>(Memory + GetSlotOffset(WriteSequence % SegmentHeader->SlotCount));
+
+    Barrier();
+    slot->Sequence = WriteSequence;
+    Barrier();
+    SegmentHeader->LatestSequence = WriteSequence;
+}
+
+int svlSharedMemoryRing::Open(const std::string& name)
+{
+    if (Memory || name.empty()) return SVL_FAIL;
+
+    Name = name;
+    Writer = false;
+
+    if (Map(false) != SVL_OK) return SVL_FAIL;
+
+    SegmentHeader = reinterpret_cast<Header*>(Memory);
+    if (strncmp(SegmentHeader->Magic, SHM_MAGIC, sizeof(SegmentHeader->Magic)) != 0 ||
+        SegmentHeader->Version != SHM_VERSION ||
+        SegmentHeader->SlotCount < 2 ||
+        MemorySize < _Align(sizeof(Header)) + SegmentHeader->SlotCount * (_Align(sizeof(Slot)) + SegmentHeader->SlotSize)) {
+        Close();
+        return SVL_FAIL;
+    }
+
+    return SVL_OK;
+}
+
+unsigned int svlSharedMemoryRing::GetLatestSequence() const
+{
+    if (!SegmentHeader) return 0;
+    return SegmentHeader->LatestSequence;
+}
+
+const svlSharedMemoryRing::Slot* svlSharedMemoryRing::GetSlot(const unsigned int sequence, const unsigned char* &data) const
+{
+    if (!Memory || sequence == 0) return 0;
+
+    const unsigned char* ptr = Memory + GetSlotOffset(sequence % SegmentHeader->SlotCount);
+    const Slot* slot = reinterpret_cast<const Slot*>(ptr);
+
+    if (slot->Sequence != sequence) return 0;
+    Barrier();
+
+    data = ptr + _Align(sizeof(Slot));
+    return slot;
+}
+
+bool svlSharedMemoryRing::IsSlotValid(const Slot* slot, const unsigned int sequence) const
+{
+    Barrier();
+    return (slot->Sequence == sequence);
+}
+
+bool svlSharedMemoryRing::IsClosed() const
+{
+    if (!SegmentHeader) return true;
+    return (SegmentHeader->Closed != 0);
+}
+
+double svlSharedMemoryRing::GetCreationTime() const
+{
+    if (!SegmentHeader) return -1.0;
+    return SegmentHeader->CreationTime;
+}
+
+void svlSharedMemoryRing::Close()
+{
+    if (Memory && Writer) {
+        SegmentHeader->Closed = 1;
+        Barrier();
+    }
+
+#if (CISST_OS == CISST_WINDOWS)
+    if (Memory) UnmapViewOfFile(Memory);
+    if (MappingHandle) CloseHandle(MappingHandle);
+    MappingHandle = 0;
+#else // CISST_OS != CISST_WINDOWS
+    if (Memory) munmap(Memory, static_cast<size_t>(MemorySize));
+    if (FileDescriptor >= 0) close(FileDescriptor);
+    // Readers keep their mapping until they close it
+    if (Memory && Writer) shm_unlink(("/" + Name).c_str());
+    FileDescriptor = -1;
+#endif // CISST_OS
+
+    Memory = 0;
+    MemorySize = 0;
+    SegmentHeader = 0;
+}
+
+bool svlSharedMemoryRing::IsOpen() const
+{
+    return (Memory != 0);
+}
+
+svlStreamType svlSharedMemoryRing::GetType() const
+{
+    if (!SegmentHeader) return svlTypeInvalid;
+    return static_cast<svlStreamType>(SegmentHeader->Type);
+}
+
+unsigned int svlSharedMemoryRing::GetSlotSize() const
+{
+    if (!SegmentHeader) return 0;
+    return SegmentHeader->SlotSize;
+}
+
+unsigned int svlSharedMemoryRing::GetSlotCount() const
+{
+    if (!SegmentHeader) return 0;
+    return SegmentHeader->SlotCount;
+}
+
+void svlSharedMemoryRing::Barrier()
+{
+#if (CISST_OS == CISST_WINDOWS)
+    MemoryBarrier();
+#elif defined(__GNUC__)
+    __sync_synchronize();
+#endif
+}
+
+int svlSharedMemoryRing::Map(const bool create)
+{
+#if (CISST_OS == CISST_WINDOWS)
+
+    const std::string name = "Local\\" + Name;
+
+    if (create) {
+        MappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE, 0, PAGE_READWRITE,
+                                           static_cast<DWORD>(MemorySize >> 32), static_cast<DWORD>(MemorySize & 0xFFFFFFFF),
+                                           name.c_str());
+        // The segment might still be held by readers of a previous
+        // writer: it is reused if large enough, readers notice the new
+        // creation time
+        if (MappingHandle) Memory = reinterpret_cast<unsigned char*>(MapViewOfFile(MappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0));
+        if (Memory) {
+            MEMORY_BASIC_INFORMATION info;
+            if (VirtualQuery(Memory, &info, sizeof(info)) != sizeof(info) || info.RegionSize < MemorySize) {
+                UnmapViewOfFile(Memory);
+                Memory = 0;
+            }
+        }
+    }
+    else {
+        MappingHandle = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+        if (MappingHandle) Memory = reinterpret_cast<unsigned char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (Memory) {
+            MEMORY_BASIC_INFORMATION info;
+            if (VirtualQuery(Memory, &info, sizeof(info)) == sizeof(info)) MemorySize = info.RegionSize;
+        }
+    }
+
+#else // CISST_OS != CISST_WINDOWS
+
+    const std::string name = "/" + Name;
+
+    if (create) {
+        // Remove stale segment left behind by a writer that didn't exit cleanly
+        shm_unlink(name.c_str());
+        FileDescriptor = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+        if (FileDescriptor >= 0 && ftruncate(FileDescriptor, static_cast<off_t>(MemorySize)) == 0) {
+            void* memory = mmap(0, static_cast<size_t>(MemorySize), PROT_READ | PROT_WRITE, MAP_SHARED, FileDescriptor, 0);
+            if (memory != MAP_FAILED) Memory = reinterpret_cast<unsigned char*>(memory);
+        }
+        if (!Memory && FileDescriptor >= 0) shm_unlink(name.c_str());
+    }
+    else {
+        FileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+        struct stat info;
+        if (FileDescriptor >= 0 && fstat(FileDescriptor, &info) == 0 && info.st_size > static_cast<off_t>(sizeof(Header))) {
+            MemorySize = info.st_size;
+            void* memory = mmap(0, static_cast<size_t>(MemorySize), PROT_READ, MAP_SHARED, FileDescriptor, 0);
+            if (memory != MAP_FAILED) Memory = reinterpret_cast<unsigned char*>(memory);
+        }
+    }
+
+#endif // CISST_OS
+
+    if (!Memory) {
+        Close();
+        return SVL_FAIL;
+    }
+
+    return SVL_OK;
+}
+
+unsigned long long int svlSharedMemoryRing::GetSlotOffset(const unsigned int index) const
+{
+    return _Align(sizeof(Header)) + index * (_Align(sizeof(Slot)) + SegmentHeader->SlotSize);
+}
@@ -0,0 +1,102 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlSharedMemoryRing_h
+#define _svlSharedMemoryRing_h
+
+#include <cisstStereoVision/svlTypes.h>
+
+
+// Ring of sample slots in a named shared memory segment with a single
+// writer process and any number of reader processes.  Slots carry a
+// sequence number that is invalidated while the slot is being written
+// and checked by the readers before and after copying (no locks shared
+// between processes).
+class svlSharedMemoryRing
+{
+public:
+    enum {
+        MAX_VIDEO_CHANNELS = 2
+    };
+
+    class Slot
+    {
+    public:
+        volatile unsigned int Sequence;
+        unsigned int DataSize;
+        double Timestamp;
+        unsigned int Width[MAX_VIDEO_CHANNELS];
+        unsigned int Height[MAX_VIDEO_CHANNELS];
+    };
+
+    svlSharedMemoryRing();
+    ~svlSharedMemoryRing();
+
+    // Writer
+    int Create(const std::string& name, const svlStreamType type, const unsigned int slotsize, const unsigned int slotcount);
+    unsigned char* BeginWrite(Slot* &slot);
+    void EndWrite();
+
+    // Reader
+    int Open(const std::string& name);
+    // Sequence number of the last sample written, 0 if none
+    unsigned int GetLatestSequence() const;
+    // Returns null if the slot doesn't hold the sample any more
+    const Slot* GetSlot(const unsigned int sequence, const unsigned char* &data) const;
+    // Returns false if the slot was overwritten since GetSlot()
+    bool IsSlotValid(const Slot* slot, const unsigned int sequence) const;
+    // True if the writer closed the segment
+    bool IsClosed() const;
+    // Identifies the segment created by a writer (e.g. after restart)
+    double GetCreationTime() const;
+
+    void Close();
+    bool IsOpen() const;
+    svlStreamType GetType() const;
+    unsigned int GetSlotSize() const;
+    unsigned int GetSlotCount() const;
+
+    static void Barrier();
+
+private:
+    svlSharedMemoryRing(const svlSharedMemoryRing&);
+
+    class Header;
+
+    std::string Name;
+    bool Writer;
+    unsigned char* Memory;
+    unsigned long long int MemorySize;
+    Header* SegmentHeader;
+    unsigned int WriteSequence;
+
+    // OS handles
+#if (CISST_OS == CISST_WINDOWS)
+    void* MappingHandle;
+#else // CISST_OS != CISST_WINDOWS
+    int FileDescriptor;
+#endif // CISST_OS
+
+    int Map(const bool create);
+    unsigned long long int GetSlotOffset(const unsigned int index) const;
+};
+
+#endif // _svlSharedMemoryRing_h
@@ -27,6 +27,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlFilterBase.h>
 #include <cisstStereoVision/svlFilterSourceBase.h>
 #include <cisstStereoVision/svlStreamProc.h>
+#include <cisstStereoVision/svlStreamProfiler.h>
 
 #include <cisstOSAbstraction/osaSleep.h>
 #include <cisstOSAbstraction/osaThread.h>
@@ -34,6 +35,8 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 
+#include <sstream>
+
 /*************************************/
 /*** svlStreamManager class **********/
 /*************************************/
@@ -47,7 +50,11 @@ svlStreamManager::svlStreamManager() :
     StreamSource(0),
     Initialized(false),
     Running(false),
-    StreamStatus(SVL_STREAM_CREATED)
+    StreamStatus(SVL_STREAM_CREATED),
+    Profiler(0),
+    ProfilerCS(new osaCriticalSection),
+    ProfilingEnabled(false),
+    ProfilingEvents(100000)
 {
     CreateInterfaces();
 }
@@ -59,7 +66,11 @@ svlStreamManager::svlStreamManager(unsigned int threadcount) :
     StreamSource(0),
     Initialized(false),
     Running(false),
-    StreamStatus(SVL_STREAM_CREATED)
+    StreamStatus(SVL_STREAM_CREATED),
+    Profiler(0),
+    ProfilerCS(new osaCriticalSection),
+    ProfilingEnabled(false),
+    ProfilingEvents(100000)
 {
     CreateInterfaces();
     // To do: autodetect the number of available processor cores
@@ -68,6 +79,8 @@ svlStreamManager::svlStreamManager(unsigned int threadcount) :
 svlStreamManager::~svlStreamManager()
 {
     Release();
+    if (Profiler) delete Profiler;
+    delete ProfilerCS;
 }
 
 int svlStreamManager::SetSourceFilter(svlFilterSourceBase * source)
@@ -384,6 +397,32 @@ int svlStreamManager::Play(void)
         CS = new osaCriticalSection;
     }
 
+    // Create profiler, one entry per trunk filter
+    ProfilerCS->Enter();
+    if (Profiler) {
+        delete Profiler;
+        Profiler = 0;
+    }
+    if (ProfilingEnabled) {
+        std::vector<std::string> filternames;
+        filter = StreamSource;
+        while (filter) {
+            filternames.push_back(filter->GetName());
+
+            // Get next filter in the trunk
+            output = filter->GetOutput();
+            filter = 0;
+            // Check if trunk output exists
+            if (output) {
+                input = output->Connection;
+                // Check if trunk output is connected to a trunk input
+                if (input && input->Trunk) filter = input->Filter;
+            }
+        }
+        Profiler = new svlStreamProfiler(ThreadCount, filternames, ProfilingEvents);
+    }
+    ProfilerCS->Leave();
+
     StopThread = false;
     StreamStatus = SVL_STREAM_RUNNING;
 
@@ -719,6 +758,63 @@ void svlStreamManager::DisconnectAll(void)
     }
 }
 
+int svlStreamManager::EnableProfiling(bool enable, unsigned int eventsperthread)
+{
+    if (Running) {
+        CMN_LOG_CLASS_RUN_ERROR << "EnableProfiling: stream \"" << this->GetName()
+                                << "\" is running, profiling can't be changed" << std::endl;
+        return SVL_ALREADY_RUNNING;
+    }
+    if (eventsperthread < 1) return SVL_FAIL;
+
+    ProfilingEnabled = enable;
+    ProfilingEvents = eventsperthread;
+    if (!enable && Profiler) {
+        ProfilerCS->Enter();
+            delete Profiler;
+            Profiler = 0;
+        ProfilerCS->Leave();
+    }
+    return SVL_OK;
+}
+
+bool svlStreamManager::IsProfilingEnabled(void) const
+{
+    return ProfilingEnabled;
+}
+
+const svlStreamProfiler* svlStreamManager::GetProfiler(void) const
+{
+    return Profiler;
+}
+
+void svlStreamManager::GetProfilingReport(std::string & report) const
+{
+    report.clear();
+    ProfilerCS->Enter();
+    if (Profiler) {
+        std::stringstream stream;
+        Profiler->Report(stream);
+        report = stream.str();
+    }
+    ProfilerCS->Leave();
+}
+
+int svlStreamManager::SaveProfilingTrace(const std::string & filename) const
+{
+    int ret = SVL_FAIL;
+    ProfilerCS->Enter();
+    if (Profiler) {
+        ret = Profiler->SaveChromeTrace(filename);
+    }
+    else {
+        CMN_LOG_CLASS_RUN_ERROR << "SaveProfilingTrace: profiling is not enabled for stream \""
+                                << this->GetName() << "\"" << std::endl;
+    }
+    ProfilerCS->Leave();
+    return ret;
+}
+
 void svlStreamManager::CreateInterfaces(void)
 {
     mtsInterfaceProvided * interfaceProvided = this->AddInterfaceProvided("Control", MTS_COMMANDS_SHOULD_NOT_BE_QUEUED);
@@ -727,6 +823,9 @@ void svlStreamManager::CreateInterfaces(void)
         interfaceProvided->AddCommandVoid(&svlStreamManager::PlayCommand, this, "Play");
         interfaceProvided->AddCommandVoid(&svlStreamManager::InitializeCommand, this, "Initialize");
         interfaceProvided->AddCommandVoid(&svlStreamManager::Release, this, "Release");
+        interfaceProvided->AddCommandWrite(&svlStreamManager::EnableProfilingCommand, this, "EnableProfiling");
+        interfaceProvided->AddCommandRead(&svlStreamManager::GetProfilingReportCommand, this, "GetProfilingReport");
+        interfaceProvided->AddCommandWrite(&svlStreamManager::SaveProfilingTraceCommand, this, "SaveProfilingTrace");
     }
 }
 
@@ -768,3 +867,26 @@ void svlStreamManager::SetSourceFilterCommand(const mtsStdString & source)
     // finally call the SetSourceFilter method
     SetSourceFilter(filter);
 }
+
+void svlStreamManager::EnableProfilingCommand(const mtsBool & enable)
+{
+    if (this->EnableProfiling(enable, ProfilingEvents) != SVL_OK) {
+        CMN_LOG_CLASS_RUN_ERROR << "EnableProfilingCommand: error occurred in method \"EnableProfiling\" for stream \""
+                                << this->GetName() << "\"" << std::endl;
+    }
+}
+
+void svlStreamManager::GetProfilingReportCommand(mtsStdString & report) const
+{
+    std::string str;
+    GetProfilingReport(str);
+    report = str;
+}
+
+void svlStreamManager::SaveProfilingTraceCommand(const mtsStdString & filename)
+{
+    if (this->SaveProfilingTrace(filename) != SVL_OK) {
+        CMN_LOG_CLASS_RUN_ERROR << "SaveProfilingTraceCommand: error occurred in method \"SaveProfilingTrace\" for stream \""
+                                << this->GetName() << "\"" << std::endl;
+    }
+}
@@ -25,6 +25,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlStreamBranchSource.h>
 #include <cisstStereoVision/svlFilterInput.h>
 #include <cisstStereoVision/svlFilterOutput.h>
+#include <cisstStereoVision/svlStreamProfiler.h>
 #include <cisstOSAbstraction/osaTimeServer.h>
 #include <cisstOSAbstraction/osaSleep.h>
 
@@ -64,6 +65,10 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     osaTimeServer* timeserver = 0;
     double timestamp;
     int status = SVL_OK;
+    svlStreamProfiler* profiler = baseref->Profiler;
+    svlStreamProfiler::Timer timer;
+    svlStreamBranchSource* branchsource = dynamic_cast<svlStreamBranchSource*>(source);
+    unsigned int filterid;
 
     // Initializing thread info structure
     info.count = ThreadCount;
@@ -124,7 +129,15 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     ////////////////////////////////////
     // Starting from the stream source
 
+        if (profiler) {
+            if (ThreadID == 0 && branchsource) {
+                profiler->RecordQueue(counter, std::max(0, branchsource->GetBufferUsage()), branchsource->GetDroppedSampleCount());
+            }
+            profiler->StartEvent(timer);
+        }
+
         status = source->Process(&info, outputsample);
+        if (profiler) profiler->EndEvent(timer, ThreadID, 0, svlStreamProfiler::EventProcess, counter);
         if (status == SVL_STOP_REQUEST) {
             CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): SVL_STOP_REQUEST received" << std::endl;
             break;
@@ -149,10 +162,12 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
         // Execute only if multi-threaded - BEGIN
 
             // Synchronization point, wait for other threads
+            if (profiler) profiler->StartEvent(timer, false);
             if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
                 CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): Sync() returned error (#2)" << std::endl;
                 break;
             }
+            if (profiler) profiler->EndEvent(timer, ThreadID, 0, svlStreamProfiler::EventSync, counter);
 
         // Execute only if multi-threaded - END
         }
@@ -171,6 +186,7 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
         }
 
         prevfilter = source;
+        filterid = 0;
 
         // Get next filter in the chain
         output = source->GetOutput();
@@ -198,6 +214,7 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
 
         while (filter != 0) {
             filter->FrameCounter = counter;
+            filterid ++;
 
             // Pass samples downstream
             inputsample = outputsample; outputsample = 0;
@@ -209,7 +226,9 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
                 break;
             }
 
+            if (profiler) profiler->StartEvent(timer);
             status = filter->Process(&info, inputsample, outputsample);
+            if (profiler) profiler->EndEvent(timer, ThreadID, filterid, svlStreamProfiler::EventProcess, counter);
             if (status < 0) {
                 CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << filter->GetName() << "\"): svlFilterBase::Process() returned error (" << status << ")" << std::endl;
                 break;
@@ -219,10 +238,12 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
             // Execute only if multi-threaded - BEGIN
 
                 // Synchronization point, wait for other threads
+                if (profiler) profiler->StartEvent(timer, false);
                 if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
                     CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << filter->GetName() << "\"): Sync() returned error (#3)" << std::endl;
                     break;
                 }
+                if (profiler) profiler->EndEvent(timer, ThreadID, filterid, svlStreamProfiler::EventSync, counter);
 
             // Execute only if multi-threaded - END
             }
@@ -0,0 +1,414 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlStreamProfiler.h>
+#include <cisstStereoVision/svlDefinitions.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstCommon/cmnPortability.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#if (CISST_OS == CISST_WINDOWS)
+    #include <windows.h>
+#endif // CISST_WINDOWS
+
+#if (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+    #include <time.h>
+#endif // CISST_LINUX || CISST_DARWIN || CISST_SOLARIS || CISST_QNX
+
+
+// Ring buffers are written by the processing threads and read by any
+// other thread without locking: the event has to be stored in memory
+// before the write counter is incremented
+static inline void _MemoryBarrier()
+{
+#if (CISST_OS == CISST_WINDOWS)
+    MemoryBarrier();
+#elif defined(__GNUC__)
+    __sync_synchronize();
+#endif
+}
+
+static std::string _EscapeJSON(const std::string & str)
+{
+    std::string ret;
+    for (size_t i = 0; i < str.size(); i ++) {
+        if (str[i] == '"' || str[i] == '\\') ret += '\\';
+        if (static_cast<unsigned char>(str[i]) >= 0x20) ret += str[i];
+    }
+    return ret;
+}
+
+
+/*******************************************/
+/*** svlStreamProfiler::ThreadLog class ****/
+/*******************************************/
+
+class svlStreamProfiler::ThreadLog
+{
+public:
+    class Accumulator
+    {
+    public:
+        Accumulator() :
+            Count(0),
+            SyncCount(0),
+            Time(0.0),
+            MaximumTime(0.0),
+            CPUTime(0.0),
+            SyncTime(0.0),
+            MaximumSyncTime(0.0)
+        {
+        }
+
+        unsigned int Count;
+        unsigned int SyncCount;
+        double Time;
+        double MaximumTime;
+        double CPUTime;
+        double SyncTime;
+        double MaximumSyncTime;
+    };
+
+    ThreadLog(unsigned int filtercount, unsigned int eventcount) :
+        Events(eventcount),
+        Head(0),
+        Filters(filtercount)
+    {
+    }
+
+    std::vector<Event> Events;
+    // Number of events written so far
+    volatile unsigned int Head;
+    std::vector<Accumulator> Filters;
+};
+
+
+/*****************************************/
+/*** svlStreamProfiler class *************/
+/*****************************************/
+
+CMN_IMPLEMENT_SERVICES(svlStreamProfiler)
+
+svlStreamProfiler::Event::Event() :
+    Type(EventProcess),
+    Filter(0),
+    Frame(0),
+    Start(0.0),
+    Duration(0.0),
+    CPUTime(0.0),
+    QueueUsage(0)
+{
+}
+
+svlStreamProfiler::FilterStatistics::FilterStatistics() :
+    Frames(0),
+    AverageTime(0.0),
+    MaximumTime(0.0),
+    AverageCPUTime(0.0),
+    AverageSyncTime(0.0),
+    MaximumSyncTime(0.0)
+{
+}
+
+svlStreamProfiler::QueueStatistics::QueueStatistics() :
+    Samples(0),
+    AverageUsage(0.0),
+    MaximumUsage(0),
+    DroppedSamples(0)
+{
+}
+
+svlStreamProfiler::svlStreamProfiler(unsigned int threadcount, const std::vector<std::string> & filternames, unsigned int eventsperthread) :
+    cmnGenericObject(),
+    FilterNames(filternames),
+    EventsPerThread(std::max(1u, eventsperthread)),
+    StartTime(osaGetTime()),
+    QueueSamples(0),
+    QueueUsageSum(0.0),
+    QueueMaximum(0),
+    QueueDropped(0)
+{
+    Threads.resize(std::max(1u, threadcount));
+    for (unsigned int i = 0; i < Threads.size(); i ++) {
+        Threads[i] = new ThreadLog(static_cast<unsigned int>(FilterNames.size()), EventsPerThread);
+    }
+}
+
+svlStreamProfiler::~svlStreamProfiler()
+{
+    for (unsigned int i = 0; i < Threads.size(); i ++) delete Threads[i];
+}
+
+unsigned int svlStreamProfiler::GetThreadCount() const
+{
+    return static_cast<unsigned int>(Threads.size());
+}
+
+unsigned int svlStreamProfiler::GetFilterCount() const
+{
+    return static_cast<unsigned int>(FilterNames.size());
+}
+
+void svlStreamProfiler::StartEvent(Timer & timer, bool cputime) const
+{
+    timer.CPUStart = cputime ? GetThreadCPUTime() : -1.0;
+    timer.Start = osaGetTime();
+}
+
+void svlStreamProfiler::EndEvent(const Timer & timer, unsigned int threadid, unsigned int filterid, EventType type, unsigned int frame)
+{
+    if (threadid >= Threads.size() || filterid >= FilterNames.size()) return;
+
+    Event event;
+    event.Type     = type;
+    event.Filter   = filterid;
+    event.Frame    = frame;
+    event.Start    = timer.Start - StartTime;
+    event.Duration = osaGetTime() - timer.Start;
+    event.CPUTime  = (timer.CPUStart >= 0.0) ? GetThreadCPUTime() - timer.CPUStart : 0.0;
+
+    ThreadLog & log = *(Threads[threadid]);
+    ThreadLog::Accumulator & acc = log.Filters[filterid];
+
+    CS.Enter();
+        if (type == EventSync) {
+            acc.SyncCount ++;
+            acc.SyncTime += event.Duration;
+            if (event.Duration > acc.MaximumSyncTime) acc.MaximumSyncTime = event.Duration;
+        }
+        else {
+            acc.Count ++;
+            acc.Time += event.Duration;
+            acc.CPUTime += event.CPUTime;
+            if (event.Duration > acc.MaximumTime) acc.MaximumTime = event.Duration;
+        }
+    CS.Leave();
+
+    AddEvent(log, event);
+}
+
+void svlStreamProfiler::RecordQueue(unsigned int frame, unsigned int usage, unsigned int dropped)
+{
+    // Called by the first thread only
+    Event event;
+    event.Type       = EventQueue;
+    event.Frame      = frame;
+    event.Start      = osaGetTime() - StartTime;
+    event.QueueUsage = usage;
+
+    CS.Enter();
+        QueueSamples ++;
+        QueueUsageSum += usage;
+        if (usage > QueueMaximum) QueueMaximum = usage;
+        QueueDropped = dropped;
+    CS.Leave();
+
+    AddEvent(*(Threads[0]), event);
+}
+
+void svlStreamProfiler::AddEvent(ThreadLog & log, const Event & event)
+{
+    log.Events[log.Head % EventsPerThread] = event;
+    _MemoryBarrier();
+    log.Head = log.Head + 1;
+}
+
+void svlStreamProfiler::GetStatistics(std::vector<FilterStatistics> & stats) const
+{
+    const unsigned int filtercount = static_cast<unsigned int>(FilterNames.size());
+    unsigned int i, t, count, synccount;
+    double time, cputime, synctime;
+
+    stats.resize(filtercount);
+
+    CS.Enter();
+    for (i = 0; i < filtercount; i ++) {
+        FilterStatistics & stat = stats[i];
+        stat = FilterStatistics();
+        stat.Name = FilterNames[i];
+        stat.Frames = Threads[0]->Filters[i].Count;
+
+        count = synccount = 0;
+        time = cputime = synctime = 0.0;
+        for (t = 0; t < Threads.size(); t ++) {
+            const ThreadLog::Accumulator & acc = Threads[t]->Filters[i];
+            count     += acc.Count;
+            synccount += acc.SyncCount;
+            time      += acc.Time;
+            cputime   += acc.CPUTime;
+            synctime  += acc.SyncTime;
+            stat.MaximumTime     = std::max(stat.MaximumTime, acc.MaximumTime);
+            stat.MaximumSyncTime = std::max(stat.MaximumSyncTime, acc.MaximumSyncTime);
+        }
+        if (count > 0)       stat.AverageTime     = time / count;
+        if (stat.Frames > 0) stat.AverageCPUTime  = cputime / stat.Frames;
+        if (synccount > 0)   stat.AverageSyncTime = synctime / synccount;
+    }
+    CS.Leave();
+}
+
+void svlStreamProfiler::GetQueueStatistics(QueueStatistics & stats) const
+{
+    CS.Enter();
+        stats.Samples        = QueueSamples;
+        stats.AverageUsage   = (QueueSamples > 0) ? QueueUsageSum / QueueSamples : 0.0;
+        stats.MaximumUsage   = QueueMaximum;
+        stats.DroppedSamples = QueueDropped;
+    CS.Leave();
+}
+
+void svlStreamProfiler::GetEvents(unsigned int threadid, std::vector<Event> & events) const
+{
+    events.clear();
+    if (threadid >= Threads.size()) return;
+
+    const ThreadLog & log = *(Threads[threadid]);
+    const unsigned int head = log.Head;
+    _MemoryBarrier();
+
+    // Copy the events stored in the ring buffer
+    unsigned int count = std::min(head, EventsPerThread);
+    unsigned int first = head - count;
+    unsigned int i;
+
+    events.resize(count);
+    for (i = 0; i < count; i ++) events[i] = log.Events[(first + i) % EventsPerThread];
+
+    // Drop the events that may have been overwritten while copying.
+    // The writer stores event "newhead" before incrementing the head,
+    // so the slot of event "newhead - EventsPerThread" may be written too.
+    _MemoryBarrier();
+    const unsigned int newhead = log.Head;
+    if (newhead + 1 - first > EventsPerThread) {
+        const unsigned int overwritten = std::min(count, newhead + 1 - first - EventsPerThread);
+        events.erase(events.begin(), events.begin() + overwritten);
+    }
+}
+
+void svlStreamProfiler::Report(std::ostream & outputStream) const
+{
+    std::vector<FilterStatistics> stats;
+    GetStatistics(stats);
+
+    outputStream << "Stream profile, " << Threads.size() << " thread(s), times in milliseconds" << std::endl
+                 << std::left << std::setw(32) << "filter" << std::right
+                 << std::setw(10) << "frames"
+                 << std::setw(10) << "average"
+                 << std::setw(10) << "maximum"
+                 << std::setw(10) << "CPU"
+                 << std::setw(10) << "sync"
+                 << std::setw(10) << "sync max" << std::endl;
+
+    outputStream << std::fixed << std::setprecision(3);
+    for (unsigned int i = 0; i < stats.size(); i ++) {
+        outputStream << std::left << std::setw(32) << stats[i].Name.substr(0, 31) << std::right
+                     << std::setw(10) << stats[i].Frames
+                     << std::setw(10) << stats[i].AverageTime * 1000.0
+                     << std::setw(10) << stats[i].MaximumTime * 1000.0
+                     << std::setw(10) << stats[i].AverageCPUTime * 1000.0
+                     << std::setw(10) << stats[i].AverageSyncTime * 1000.0
+                     << std::setw(10) << stats[i].MaximumSyncTime * 1000.0 << std::endl;
+    }
+
+    QueueStatistics queue;
+    GetQueueStatistics(queue);
+    if (queue.Samples > 0) {
+        outputStream << "Branch queue usage: average " << std::setprecision(2) << queue.AverageUsage
+                     << ", maximum " << queue.MaximumUsage
+                     << ", dropped samples " << queue.DroppedSamples << std::endl;
+    }
+    outputStream.unsetf(std::ios::floatfield);
+}
+
+int svlStreamProfiler::SaveChromeTrace(const std::string & filename) const
+{
+    std::ofstream file(filename.c_str());
+    if (!file.is_open()) {
+        CMN_LOG_CLASS_RUN_ERROR << "SaveChromeTrace: failed to open file \"" << filename << "\"" << std::endl;
+        return SVL_FAIL;
+    }
+
+    std::vector<Event> events;
+    unsigned int t, i;
+    bool first = true;
+
+    // Complete events ("X") with timestamps and durations in microseconds
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+    file << std::fixed << std::setprecision(3);
+
+    for (t = 0; t < Threads.size(); t ++) {
+        if (!first) file << "," << std::endl;
+        first = false;
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+             << ",\"args\":{\"name\":\"svlStreamProc " << t << "\"}}";
+
+        GetEvents(t, events);
+        for (i = 0; i < events.size(); i ++) {
+            const Event & event = events[i];
+            file << "," << std::endl;
+
+            if (event.Type == EventQueue) {
+                file << "{\"name\":\"queue\",\"ph\":\"C\",\"pid\":1,\"tid\":" << t
+                     << ",\"ts\":" << event.Start * 1000000.0
+                     << ",\"args\":{\"usage\":" << event.QueueUsage << "}}";
+                continue;
+            }
+
+            file << "{\"name\":\"" << _EscapeJSON(FilterNames[event.Filter])
+                 << ((event.Type == EventSync) ? " (sync)" : "")
+                 << "\",\"cat\":\"" << ((event.Type == EventSync) ? "sync" : "process")
+                 << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << t
+                 << ",\"ts\":" << event.Start * 1000000.0
+                 << ",\"dur\":" << event.Duration * 1000000.0
+                 << ",\"args\":{\"frame\":" << event.Frame;
+            if (event.Type == EventProcess) file << ",\"cpu_us\":" << event.CPUTime * 1000000.0;
+            file << "}}";
+        }
+    }
+
+    file << std::endl << "]}" << std::endl;
+    file.close();
+
+    return SVL_OK;
+}
+
+double svlStreamProfiler::GetThreadCPUTime()
+{
+#if (CISST_OS == CISST_WINDOWS)
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        ULARGE_INTEGER k, u;
+        k.LowPart = kernel.dwLowDateTime; k.HighPart = kernel.dwHighDateTime;
+        u.LowPart = user.dwLowDateTime;   u.HighPart = user.dwHighDateTime;
+        // 100 nanosecond units
+        return static_cast<double>(k.QuadPart + u.QuadPart) * 1.0e-7;
+    }
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1.0e-9;
+    }
+#endif
+    return 0.0;
+}
@@ -0,0 +1,179 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include "svlTripleBufferIndex.h"
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+#if (CISST_OS == CISST_WINDOWS)
+    #include <windows.h>
+#elif (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_LINUX_RTAI)
+    #define _FUTEX_AVAILABLE
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <time.h>
+#endif // CISST_OS
+
+
+/**********************************/
+/*** svlTripleBufferIndex class ***/
+/**********************************/
+
+svlTripleBufferIndex::svlTripleBufferIndex() :
+    State(0),
+    Next(1),
+    Locked(2),
+    OverwriteCount(0),
+    WaitCount(0),
+    NewEvent(0)
+{
+#ifndef _FUTEX_AVAILABLE
+    NewEvent = new osaThreadSignal;
+#endif // _FUTEX_AVAILABLE
+}
+
+svlTripleBufferIndex::~svlTripleBufferIndex()
+{
+#ifndef _FUTEX_AVAILABLE
+    delete NewEvent;
+#endif // _FUTEX_AVAILABLE
+}
+
+unsigned int svlTripleBufferIndex::GetNext() const
+{
+    return Next;
+}
+
+void svlTripleBufferIndex::Publish()
+{
+    const int state = Exchange(static_cast<int>(Next) | NEW_FLAG);
+
+    Next = state & INDEX_MASK;
+    if (state & NEW_FLAG) OverwriteCount ++;
+    if (state & WAITER_FLAG) WakeUp();
+}
+
+unsigned int svlTripleBufferIndex::GetLocked() const
+{
+    return Locked;
+}
+
+unsigned int svlTripleBufferIndex::GetLatest() const
+{
+    return State & INDEX_MASK;
+}
+
+bool svlTripleBufferIndex::IsNewAvailable() const
+{
+    return ((State & NEW_FLAG) != 0);
+}
+
+bool svlTripleBufferIndex::Acquire()
+{
+    if (!IsNewAvailable()) return false;
+
+    // Clears the flags as well; the waiter flag may only be set by the
+    // consumer itself
+    Locked = Exchange(static_cast<int>(Locked)) & INDEX_MASK;
+
+    return true;
+}
+
+bool svlTripleBufferIndex::Wait(double timeout)
+{
+    if (IsNewAvailable()) return true;
+
+    WaitCount ++;
+
+    const double deadline = osaGetTime() + timeout;
+    double remaining = timeout;
+
+    while (remaining > 0.0) {
+        const int state = State;
+        if (state & NEW_FLAG) return true;
+
+        // Let the producer know that it needs to wake us up; fails if
+        // a buffer was published in the meantime
+        if ((state & WAITER_FLAG) || CompareExchange(state, state | WAITER_FLAG)) {
+            Sleep(state | WAITER_FLAG, remaining);
+        }
+
+        remaining = deadline - osaGetTime();
+    }
+
+    return IsNewAvailable();
+}
+
+unsigned int svlTripleBufferIndex::GetOverwriteCount() const
+{
+    return OverwriteCount;
+}
+
+unsigned int svlTripleBufferIndex::GetWaitCount() const
+{
+    return WaitCount;
+}
+
+int svlTripleBufferIndex::Exchange(const int value)
+{
+#if (CISST_OS == CISST_WINDOWS)
+    return InterlockedExchange(&State, value);
+#else // CISST_OS != CISST_WINDOWS
+    // test-and-set is only an acquire barrier: buffer contents written
+    // before publishing need a full barrier
+    __sync_synchronize();
+    return __sync_lock_test_and_set(&State, value);
+#endif // CISST_OS
+}
+
+bool svlTripleBufferIndex::CompareExchange(const int expected, const int value)
+{
+#if (CISST_OS == CISST_WINDOWS)
+    return (InterlockedCompareExchange(&State, value, expected) == expected);
+#else // CISST_OS != CISST_WINDOWS
+    return __sync_bool_compare_and_swap(&State, expected, value);
+#endif // CISST_OS
+}
+
+void svlTripleBufferIndex::WakeUp()
+{
+#ifdef _FUTEX_AVAILABLE
+    syscall(SYS_futex, &State, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+#else // _FUTEX_AVAILABLE
+    NewEvent->Raise();
+#endif // _FUTEX_AVAILABLE
+}
+
+void svlTripleBufferIndex::Sleep(const int state, const double timeout)
+{
+#ifdef _FUTEX_AVAILABLE
+    // Returns immediately if the state has changed since it was checked
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(timeout);
+    ts.tv_nsec = static_cast<long>((timeout - ts.tv_sec) * 1000000000.0);
+    syscall(SYS_futex, &State, FUTEX_WAIT_PRIVATE, state, &ts, 0, 0);
+#else // _FUTEX_AVAILABLE
+    // The signal stays raised until the next wait, thus a wake-up
+    // issued after the state was checked is not lost
+    if (State == state) NewEvent->Wait(timeout);
+#endif // _FUTEX_AVAILABLE
+}
@@ -0,0 +1,95 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlTripleBufferIndex_h
+#define _svlTripleBufferIndex_h
+
+#include <cisstStereoVision/svlTypes.h>
+
+class osaThreadSignal;
+
+
+// Buffer indices of a triple buffer with a single producer and a single
+// consumer thread.  The producer owns the Next buffer, the consumer owns
+// the Locked buffer, and the Latest buffer is handed over by a single
+// atomic exchange of the shared state word: neither side ever waits for
+// the other one.  A consumer waiting for a new buffer sleeps on a futex
+// (Linux) or on an osaThreadSignal that stays raised until consumed
+// (other platforms), the producer only issues a wake-up call if a consumer is
+// actually waiting.
+// Acquire() and Wait() must only be called by one consumer thread at a
+// time; there is no protection against concurrent consumers.
+class svlTripleBufferIndex
+{
+public:
+    svlTripleBufferIndex();
+    ~svlTripleBufferIndex();
+
+    // Producer
+    unsigned int GetNext() const;
+    void Publish();
+
+    // Consumer
+    unsigned int GetLocked() const;
+    // Latest buffer published, may be overwritten by the producer
+    // after the next Publish()
+    unsigned int GetLatest() const;
+    bool IsNewAvailable() const;
+    // Exchanges the Locked buffer for the Latest one if there is a new
+    // one, returns false otherwise
+    bool Acquire();
+    // Returns false if no new buffer was published before the timeout
+    bool Wait(double timeout);
+
+    // Statistics
+    // Number of published buffers overwritten before being acquired
+    unsigned int GetOverwriteCount() const;
+    // Number of times the consumer had to sleep for a new buffer
+    unsigned int GetWaitCount() const;
+
+private:
+    svlTripleBufferIndex(const svlTripleBufferIndex&);
+
+    enum {
+        INDEX_MASK  = 0x3,
+        NEW_FLAG    = 0x4,
+        WAITER_FLAG = 0x8
+    };
+
+    // Index of the Latest buffer and flags
+#if (CISST_OS == CISST_WINDOWS)
+    volatile long State;
+#else // CISST_OS != CISST_WINDOWS
+    volatile int State;
+#endif // CISST_OS
+    unsigned int Next;
+    unsigned int Locked;
+    volatile unsigned int OverwriteCount;
+    volatile unsigned int WaitCount;
+    osaThreadSignal* NewEvent;
+
+    int Exchange(const int value);
+    bool CompareExchange(const int expected, const int value);
+    void WakeUp();
+    void Sleep(const int state, const double timeout);
+};
+
+#endif // _svlTripleBufferIndex_h
@@ -21,17 +21,21 @@ http://www.cisst.org/cisst/license.txt.
 
 #include "svlVidCapSrcV4L2.h"
 #include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
+#include <cisstOSAbstraction/osaSleep.h>
 #include <cisstStereoVision/svlBufferImage.h>
 #include <cisstStereoVision/svlConverters.h>
 
 #include <stdlib.h>
 #include <iostream>
+#include <vector>
 #include <cstdio>
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/select.h>
 #include <linux/types.h>
 #include <linux/videodev2.h>
 
@@ -44,6 +48,8 @@ using namespace std;
 #define MV4LP_METHOD_READ           1
 #define MV4LP_BUFFER_SIZE_TARGET    2
 #define MV4LP_MIN_BUFFER_SIZE       2
+#define MV4LP_ZC_BUFFER_SIZE_TARGET 4
+#define MV4LP_ZC_MIN_BUFFER_SIZE    3
 #define MV4LP_FRAME_TIMEOUT         100
 #define MV4LP_CS_UNKNOWN            -1
 #define MV4LP_CS_BGR24              0
@@ -53,6 +59,128 @@ using namespace std;
 #define MV4LP_CS_MPEG               -10
 
 
+/*******************************************/
+/*** svlVidCapSrcV4L2::ZeroCopyBuffer class */
+/*******************************************/
+
+// Image referencing memory owned by the driver or the buffer pool
+class svlVidCapSrcV4L2ExternalImage : public svlImageRGB
+{
+public:
+    svlVidCapSrcV4L2ExternalImage(unsigned char* data, int width, int height) : svlImageRGB()
+    {
+        this->Matrix.Own(height, width * 3, VCT_ROW_MAJOR, data);
+    }
+
+    ~svlVidCapSrcV4L2ExternalImage()
+    {
+        // Memory is not owned, don't free it
+        this->Matrix.Release();
+    }
+};
+
+// Same protocol as svlBufferImage except that the buffers are the
+// driver buffers: the latest dequeued buffer is handed to the stream
+// when it pulls a new frame and the buffer previously used by the
+// stream is queued back to the driver.  When the stream doesn't keep
+// up, the older unused frame is queued back by the capture thread.
+class svlVidCapSrcV4L2::ZeroCopyBuffer
+{
+public:
+    ZeroCopyBuffer(svlVidCapSrcV4L2* owner, unsigned int videoch) :
+        Owner(owner),
+        VideoChannel(videoch),
+        Latest(-1),
+        Locked(-1),
+        InitializationCounter(10),
+        Blank(owner->CapHeight[videoch], owner->CapWidth[videoch] * 3)
+    {
+        Blank.SetAll(0);
+        const int count = owner->FrameBufferSize[videoch];
+        Images.resize(count);
+        for (int i = 0; i < count; i ++) {
+            Images[i] = new svlVidCapSrcV4L2ExternalImage(reinterpret_cast<unsigned char*>(owner->FrameBuffer[videoch][i].start),
+                                                          owner->CapWidth[videoch],
+                                                          owner->CapHeight[videoch]);
+        }
+    }
+
+    ~ZeroCopyBuffer()
+    {
+        for (unsigned int i = 0; i < Images.size(); i ++) delete Images[i];
+    }
+
+    // Called once all buffers are queued or dequeued by the driver
+    void Reset()
+    {
+        CS.Enter();
+            Latest = -1;
+            Locked = -1;
+            InitializationCounter = 10;
+        CS.Leave();
+    }
+
+    // Called by the capture thread with a buffer dequeued from the driver
+    int Push(int index)
+    {
+        CS.Enter();
+            const int dropped = Latest;
+            Latest = index;
+        CS.Leave();
+
+        NewFrameEvent.Raise();
+
+        if (dropped >= 0) return Owner->QueueBuffer(VideoChannel, dropped);
+        return SVL_OK;
+    }
+
+    // Called by the stream, the image returned remains valid until the next call
+    svlImageRGB* Pull(bool waitfornew, double timeout = 5.0)
+    {
+        if (waitfornew) {
+            if (!NewFrameEvent.Wait(0.0)) {
+                if (InitializationCounter > 0) {
+                    // Let the stream start with a blank image while
+                    // waiting for the first frame to arrive.
+                    InitializationCounter --;
+                    osaSleep(0.033);
+                }
+                else {
+                    if (!NewFrameEvent.Wait(timeout)) return 0;
+                }
+            }
+            else {
+                InitializationCounter = 0;
+            }
+        }
+
+        int released = -1;
+        CS.Enter();
+            if (waitfornew && Latest >= 0) {
+                released = Locked;
+                Locked = Latest;
+                Latest = -1;
+            }
+            const int current = Locked;
+        CS.Leave();
+
+        if (released >= 0) Owner->QueueBuffer(VideoChannel, released);
+        if (current < 0) return &Blank;
+        return Images[current];
+    }
+
+private:
+    svlVidCapSrcV4L2* Owner;
+    unsigned int VideoChannel;
+    int Latest, Locked;
+    int InitializationCounter;
+    svlImageRGB Blank;
+    std::vector<svlVidCapSrcV4L2ExternalImage*> Images;
+    osaCriticalSection CS;
+    osaThreadSignal NewFrameEvent;
+};
+
+
 /*************************************/
 /*** svlVidCapSrcV4L2 class **********/
 /*************************************/
@@ -77,7 +205,9 @@ svlVidCapSrcV4L2::svlVidCapSrcV4L2() :
 	FrameBufferSize(0),
     FrameBuffer(0),
     OutputBuffer(0),
-    Format(0)
+    Format(0),
+    BufferMode(0),
+    ZeroCopy(0)
 {
 }
 
@@ -113,6 +243,8 @@ int svlVidCapSrcV4L2::SetStreamCount(unsigned int numofstreams)
     FrameBuffer = new FrameBufferType*[NumOfStreams];
     OutputBuffer = new svlBufferImage*[NumOfStreams];
     Format = new svlFilterSourceVideoCapture::ImageFormat*[NumOfStreams];
+    BufferMode = new svlFilterSourceVideoCapture::CaptureBufferMode[NumOfStreams];
+    ZeroCopy = new ZeroCopyBuffer*[NumOfStreams];
 
     for (unsigned int i = 0; i < NumOfStreams; i ++) {
         CaptureProc[i] = 0;
@@ -129,6 +261,8 @@ int svlVidCapSrcV4L2::SetStreamCount(unsigned int numofstreams)
         FrameBuffer[i] = 0;
         OutputBuffer[i] = 0;
         Format[i] = 0;
+        BufferMode[i] = svlFilterSourceVideoCapture::BufferCopy;
+        ZeroCopy[i] = 0;
     }
 
     return SVL_OK;
@@ -287,6 +421,16 @@ int svlVidCapSrcV4L2::Open()
             cout << "-Open: QUERYCAP done - Read method selected" << endl;
 #endif
         }
+        // Zero-copy requires streaming
+        if (BufferMode[i] != svlFilterSourceVideoCapture::BufferCopy) {
+            if ((devprops.capabilities & V4L2_CAP_STREAMING) != 0) {
+                CapMethod[i] = MV4LP_METHOD_STREAMING;
+            }
+            else {
+                CMN_LOG_CLASS_INIT_WARNING << "Open: device doesn't support streaming, zero-copy disabled" << std::endl;
+                BufferMode[i] = svlFilterSourceVideoCapture::BufferCopy;
+            }
+        }
 
         // Setting input
         if (ioctl(DeviceHandle[i], VIDIOC_S_INPUT, &(InputID[i])) != 0) {
@@ -382,6 +526,9 @@ int svlVidCapSrcV4L2::Open()
 
         // Stride
         CapStride[i] = format.fmt.pix.width * 3;
+        if (ColorSpace[i] == MV4LP_CS_BGR24 && static_cast<int>(format.fmt.pix.bytesperline) > CapStride[i]) {
+            CapStride[i] = format.fmt.pix.bytesperline;
+        }
 
 #ifdef __verbose__
         cout << "-Open: Image properties: " << CapWidth[i] << "*" << CapHeight[i];
@@ -422,24 +569,38 @@ int svlVidCapSrcV4L2::Open()
             goto labError;
         }
 
+        // Zero-copy requires the output pixel layout: BGR24 without padding
+        if (BufferMode[i] != svlFilterSourceVideoCapture::BufferCopy &&
+            (ColorSpace[i] != MV4LP_CS_BGR24 || CapStride[i] != CapWidth[i] * 3)) {
+            CMN_LOG_CLASS_INIT_WARNING << "Open: zero-copy requires BGR24 frames without padding, zero-copy disabled" << std::endl;
+            BufferMode[i] = svlFilterSourceVideoCapture::BufferCopy;
+            if ((devprops.capabilities & V4L2_CAP_READWRITE) != 0) CapMethod[i] = MV4LP_METHOD_READ;
+        }
+
+        if (CapMethod[i] == MV4LP_METHOD_STREAMING && ColorSpace[i] == MV4LP_CS_HM12) {
+            CMN_LOG_CLASS_INIT_ERROR << "Open: HM12 format requires read I/O" << std::endl;
+            goto labError;
+        }
+
         if (CapMethod[i] == MV4LP_METHOD_STREAMING) {
             // Streaming I/O
-            // Not yet supported, works for Hauppauge cards, but not XtremeRGB cards
-            //goto labError;
-///*
             struct v4l2_requestbuffers reqbuff;
+            const bool zerocopy = (BufferMode[i] != svlFilterSourceVideoCapture::BufferCopy);
+            const bool userptr = (BufferMode[i] == svlFilterSourceVideoCapture::BufferZeroCopyUserPtr);
 
             // Requesting buffer
+            // In zero-copy mode, one buffer is used by the stream and
+            // one is waiting to be pulled while the driver fills the others
             memset(&reqbuff, 0, sizeof(v4l2_requestbuffers));
-            reqbuff.count = MV4LP_BUFFER_SIZE_TARGET;
+            reqbuff.count = zerocopy ? MV4LP_ZC_BUFFER_SIZE_TARGET : MV4LP_BUFFER_SIZE_TARGET;
             reqbuff.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-            reqbuff.memory = V4L2_MEMORY_MMAP;
+            reqbuff.memory = userptr ? V4L2_MEMORY_USERPTR : V4L2_MEMORY_MMAP;
             if (ioctl(DeviceHandle[i], VIDIOC_REQBUFS, &reqbuff) != 0) {
                 CMN_LOG_CLASS_INIT_ERROR << "Open: failed to set ioctl VIDIOC_REQBUFS" << std::endl;
                 goto labError;
             }
             // Buffer count may be overridden by the driver
-            if (reqbuff.count < MV4LP_MIN_BUFFER_SIZE) {
+            if (reqbuff.count < static_cast<unsigned int>(zerocopy ? MV4LP_ZC_MIN_BUFFER_SIZE : MV4LP_MIN_BUFFER_SIZE)) {
                 CMN_LOG_CLASS_INIT_ERROR << "Open: invalid required buffer count" << std::endl;
                 goto labError;
             }
@@ -452,7 +613,17 @@ int svlVidCapSrcV4L2::Open()
             FrameBuffer[i] = new FrameBufferType[FrameBufferSize[i]];
             memset(FrameBuffer[i], 0, FrameBufferSize[i] * sizeof(FrameBufferType));
 
-            for (j = 0; j < FrameBufferSize[i]; j++) {
+            for (j = 0; j < FrameBufferSize[i] && userptr; j++) {
+                // Page aligned buffer pool, passed to the driver when queued
+                FrameBuffer[i][j].length = format.fmt.pix.sizeimage;
+                if (posix_memalign(&(FrameBuffer[i][j].start), getpagesize(), FrameBuffer[i][j].length) != 0) {
+                    FrameBuffer[i][j].start = 0;
+                    CMN_LOG_CLASS_INIT_ERROR << "Open: failed to allocate user pointer buffer" << std::endl;
+                    goto labError;
+                }
+            }
+
+            for (j = 0; j < FrameBufferSize[i] && !userptr; j++) {
                 struct v4l2_buffer buffer;
 
                 memset(&buffer, 0, sizeof(v4l2_buffer));
@@ -482,7 +653,6 @@ int svlVidCapSrcV4L2::Open()
                 cout << "--Open: buffer " << j << " parameters received" << endl;
 #endif
             }
-//*/
         }
         else {
             // Read/write I/O
@@ -499,7 +669,12 @@ int svlVidCapSrcV4L2::Open()
         }
 
         // allocate output buffers
-        OutputBuffer[i] = new svlBufferImage(CapWidth[i], CapHeight[i]);
+        if (BufferMode[i] == svlFilterSourceVideoCapture::BufferCopy) {
+            OutputBuffer[i] = new svlBufferImage(CapWidth[i], CapHeight[i]);
+        }
+        else {
+            ZeroCopy[i] = new ZeroCopyBuffer(this, i);
+        }
     }
 
     Initialized = true;
@@ -528,10 +703,19 @@ void svlVidCapSrcV4L2::Close()
             DeviceHandle[i] = -1;
         }
 
+        // release zero-copy buffer before unmapping
+        if (ZeroCopy[i]) delete ZeroCopy[i];
+        ZeroCopy[i] = 0;
+
         if (FrameBuffer[i]) {
 			for (j = 0; j < FrameBufferSize[i]; j++) {
                 if (CapMethod[i] == MV4LP_METHOD_STREAMING) {
-                    munmap(FrameBuffer[i][j].start, FrameBuffer[i][j].length);
+                    if (BufferMode[i] == svlFilterSourceVideoCapture::BufferZeroCopyUserPtr) {
+                        free(FrameBuffer[i][j].start);
+                    }
+                    else if (FrameBuffer[i][j].start && FrameBuffer[i][j].start != MAP_FAILED) {
+                        munmap(FrameBuffer[i][j].start, FrameBuffer[i][j].length);
+                    }
                 } else {
 					delete [] reinterpret_cast<unsigned char*>(FrameBuffer[i][j].start);
                 }
@@ -557,6 +741,13 @@ int svlVidCapSrcV4L2::Start()
         if (DeviceHandle[i] < 0) return SVL_FAIL;
     }
 
+    for (i = 0; i < NumOfStreams; i ++) {
+        if (CapMethod[i] == MV4LP_METHOD_STREAMING && StartStreaming(i) != SVL_OK) {
+            while (i > 0) StopStreaming(-- i);
+            return SVL_FAIL;
+        }
+    }
+
     Running = true;
     for (i = 0; i < NumOfStreams; i ++) {
         CaptureProc[i] = new svlVidCapSrcV4L2Thread(i);
@@ -578,6 +769,7 @@ int svlVidCapSrcV4L2::Start()
 svlImageRGB* svlVidCapSrcV4L2::GetLatestFrame(bool waitfornew, unsigned int videoch)
 {
     if (videoch >= NumOfStreams || !Initialized) return 0;
+    if (ZeroCopy[videoch]) return ZeroCopy[videoch]->Pull(waitfornew);
     return OutputBuffer[videoch]->Pull(waitfornew);
 }
 
@@ -597,6 +789,7 @@ int svlVidCapSrcV4L2::Stop()
             delete(CaptureProc[i]);
             CaptureProc[i] = 0;
         }
+        if (CapMethod[i] == MV4LP_METHOD_STREAMING) StopStreaming(i);
     }
 
     return SVL_OK;
@@ -607,6 +800,13 @@ bool svlVidCapSrcV4L2::IsRunning()
     return Running;
 }
 
+int svlVidCapSrcV4L2::SetBufferMode(svlFilterSourceVideoCapture::CaptureBufferMode mode, unsigned int videoch)
+{
+    if (videoch >= NumOfStreams || Initialized) return SVL_FAIL;
+    BufferMode[videoch] = mode;
+    return SVL_OK;
+}
+
 int svlVidCapSrcV4L2::SetDevice(int devid, int inid, unsigned int videoch)
 {
     if (videoch >= NumOfStreams) return SVL_FAIL;
@@ -822,6 +1022,7 @@ int svlVidCapSrcV4L2::GetFormat(svlFilterSourceVideoCapture::ImageFormat& format
 int svlVidCapSrcV4L2::ReadFrame(unsigned int videoch)
 {
     if (Running == false) return SVL_FAIL;
+    if (CapMethod[videoch] == MV4LP_METHOD_STREAMING) return ReadFrameStreaming(videoch);
 
     unsigned int imlen;
     unsigned char *imbuf = NULL;
@@ -938,6 +1139,131 @@ int svlVidCapSrcV4L2::ReadFrame(unsigned int videoch)
 	return error;
 }
 
+int svlVidCapSrcV4L2::ReadFrameStreaming(unsigned int videoch)
+{
+    const int fd = DeviceHandle[videoch];
+
+    // Wait for a filled buffer, time out to check if still running
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    struct timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = MV4LP_FRAME_TIMEOUT * 1000;
+    const int ret = select(fd + 1, &fds, 0, 0, &timeout);
+    if (ret == 0 || (ret < 0 && errno == EINTR)) return SVL_OK;
+    if (ret < 0) {
+        CMN_LOG_CLASS_RUN_ERROR << "ReadFrameStreaming: select failed [" << videoch << "]" << std::endl;
+        return SVL_FAIL;
+    }
+
+    struct v4l2_buffer buffer;
+    memset(&buffer, 0, sizeof(v4l2_buffer));
+    buffer.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buffer.memory = (BufferMode[videoch] == svlFilterSourceVideoCapture::BufferZeroCopyUserPtr) ? V4L2_MEMORY_USERPTR : V4L2_MEMORY_MMAP;
+    if (ioctl(fd, VIDIOC_DQBUF, &buffer) != 0) {
+        if (errno == EAGAIN) return SVL_OK;
+        CMN_LOG_CLASS_RUN_ERROR << "ReadFrameStreaming: failed to set ioctl VIDIOC_DQBUF [" << videoch << "]" << std::endl;
+        return SVL_FAIL;
+    }
+    if (static_cast<int>(buffer.index) >= FrameBufferSize[videoch]) return SVL_FAIL;
+
+    // Zero-copy: buffer is queued back once the stream is done with it
+    if (ZeroCopy[videoch]) return ZeroCopy[videoch]->Push(buffer.index);
+
+    const int error = CopyFrame(videoch, reinterpret_cast<unsigned char*>(FrameBuffer[videoch][buffer.index].start));
+    if (QueueBuffer(videoch, buffer.index) != SVL_OK) return SVL_FAIL;
+    return error;
+}
+
+int svlVidCapSrcV4L2::CopyFrame(unsigned int videoch, unsigned char* src)
+{
+    unsigned int imlen;
+    unsigned char *imbuf = OutputBuffer[videoch]->GetPushBuffer(imlen);
+    if (imbuf == NULL) return SVL_FAIL;
+
+    const int w = CapWidth[videoch];
+    const int h = CapHeight[videoch];
+    const int stride = CapStride[videoch];
+    const int line = w * 3;
+
+    switch (ColorSpace[videoch]) {
+        case MV4LP_CS_BGR24:
+            if (line == stride) {
+                memcpy(imbuf, src, imlen);
+            }
+            else {
+                for (int j = 0; j < h; j ++) {
+                    memcpy(imbuf, src, line);
+                    imbuf += line;
+                    src += stride;
+                }
+            }
+        break;
+
+        case MV4LP_CS_UYVY:
+            YUV420p_to_BGR24(imbuf, src, line, w, w, h);
+        break;
+
+        case MV4LP_CS_YUYV:
+            svlConverter::YUV422toRGB24(src, imbuf, w * h, true, true, true);
+        break;
+
+        default:
+            return SVL_FAIL;
+    }
+
+    // Add image to the output buffer
+    OutputBuffer[videoch]->Push();
+
+    return SVL_OK;
+}
+
+int svlVidCapSrcV4L2::QueueBuffer(unsigned int videoch, int index)
+{
+    struct v4l2_buffer buffer;
+    memset(&buffer, 0, sizeof(v4l2_buffer));
+    buffer.index = index;
+    buffer.type  = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (BufferMode[videoch] == svlFilterSourceVideoCapture::BufferZeroCopyUserPtr) {
+        buffer.memory    = V4L2_MEMORY_USERPTR;
+        buffer.m.userptr = reinterpret_cast<unsigned long>(FrameBuffer[videoch][index].start);
+        buffer.length    = FrameBuffer[videoch][index].length;
+    }
+    else {
+        buffer.memory = V4L2_MEMORY_MMAP;
+    }
+    if (ioctl(DeviceHandle[videoch], VIDIOC_QBUF, &buffer) != 0) {
+        CMN_LOG_CLASS_RUN_ERROR << "QueueBuffer: failed to set ioctl VIDIOC_QBUF [" << videoch << "]" << std::endl;
+        return SVL_FAIL;
+    }
+    return SVL_OK;
+}
+
+int svlVidCapSrcV4L2::StartStreaming(unsigned int videoch)
+{
+    if (ZeroCopy[videoch]) ZeroCopy[videoch]->Reset();
+
+    for (int j = 0; j < FrameBufferSize[videoch]; j ++) {
+        if (QueueBuffer(videoch, j) != SVL_OK) return SVL_FAIL;
+    }
+
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (ioctl(DeviceHandle[videoch], VIDIOC_STREAMON, &type) != 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "StartStreaming: failed to set ioctl VIDIOC_STREAMON [" << videoch << "]" << std::endl;
+        return SVL_FAIL;
+    }
+    return SVL_OK;
+}
+
+void svlVidCapSrcV4L2::StopStreaming(unsigned int videoch)
+{
+    // Dequeues all buffers, including the ones used by the stream
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (DeviceHandle[videoch] >= 0) ioctl(DeviceHandle[videoch], VIDIOC_STREAMOFF, &type);
+    if (ZeroCopy[videoch]) ZeroCopy[videoch]->Reset();
+}
+
 
 void svlVidCapSrcV4L2::Release()
 {
@@ -956,6 +1282,8 @@ void svlVidCapSrcV4L2::Release()
     if (FrameBufferSize) delete [] FrameBufferSize;
     if (FrameBuffer) delete [] FrameBuffer;
     if (OutputBuffer) delete [] OutputBuffer;
+    if (BufferMode) delete [] BufferMode;
+    if (ZeroCopy) delete [] ZeroCopy;
 
     if (Format) {
         for (unsigned int i = 0; i < NumOfStreams; i ++) {
@@ -980,6 +1308,8 @@ void svlVidCapSrcV4L2::Release()
 	FrameBufferSize = 0;
     FrameBuffer = 0;
     OutputBuffer = 0;
+    BufferMode = 0;
+    ZeroCopy = 0;
 }
 
 int svlVidCapSrcV4L2::GetDeviceInputs(int fd, svlFilterSourceVideoCapture::DeviceInfo *deviceinfo)
@@ -60,6 +60,7 @@ public:
     int GetFormatList(unsigned int deviceid, svlFilterSourceVideoCapture::ImageFormat **formatlist);
     int GetFormat(svlFilterSourceVideoCapture::ImageFormat& format, unsigned int videoch = 0);
     int SetFormat(svlFilterSourceVideoCapture::ImageFormat& format, unsigned int videoch = 0);
+    int SetBufferMode(svlFilterSourceVideoCapture::CaptureBufferMode mode, unsigned int videoch = 0);
 
 private:
     unsigned int NumOfStreams;
@@ -80,8 +81,19 @@ private:
     FrameBufferType** FrameBuffer;
     svlBufferImage** OutputBuffer;
     svlFilterSourceVideoCapture::ImageFormat** Format;
+    svlFilterSourceVideoCapture::CaptureBufferMode* BufferMode;
+
+    // Hands dequeued driver buffers to the stream in zero-copy modes
+    class ZeroCopyBuffer;
+    friend class ZeroCopyBuffer;
+    ZeroCopyBuffer** ZeroCopy;
 
     int ReadFrame(unsigned int videoch);
+    int ReadFrameStreaming(unsigned int videoch);
+    int CopyFrame(unsigned int videoch, unsigned char* src);
+    int QueueBuffer(unsigned int videoch, int index);
+    int StartStreaming(unsigned int videoch);
+    void StopStreaming(unsigned int videoch);
 
     void Release();
     int GetDeviceInputs(int fd, svlFilterSourceVideoCapture::DeviceInfo *deviceinfo);
@@ -26,6 +26,29 @@ http://www.cisst.org/cisst/license.txt.
 
 #include "zlib.h"
 
+// Maximum number of frames decoded ahead in the playback direction
+const static int PREFETCH_DEPTH = 8;
+
+
+/*****************************************/
+/*** svlVideoCodecCVI::CachedFrame class */
+/*****************************************/
+
+class svlVideoCodecCVI::CachedFrame
+{
+public:
+    CachedFrame(const unsigned int size) :
+        Pos(-1),
+        Timestamp(-1.0)
+    {
+        Data.SetSize(size);
+    }
+
+    int Pos;
+    double Timestamp;
+    vctDynamicVector<unsigned char> Data;
+};
+
 
 /*************************************/
 /*** svlVideoCodecCVI class **********/
@@ -63,7 +86,14 @@ svlVideoCodecCVI::svlVideoCodecCVI() :
     SaveThread(0),
     SaveInitEvent(0),
     NewFrameEvent(0),
-    WriteDoneEvent(0)
+    WriteDoneEvent(0),
+    CacheSize(0),
+    LastReadPos(-1),
+    PrefetchPos(-1),
+    PrefetchDirection(1),
+    PrefetchThread(0),
+    PrefetchEvent(0),
+    KillPrefetchThread(false)
 {
     SetName("CISST Video Files");
     SetExtensionList(".cvi;");
@@ -271,6 +301,15 @@ int svlVideoCodecCVI::Open(const std::string &filename, unsigned int &width, uns
             comprBufferSize = size;
         }
 
+        if (Version > 0 && !Config.Differential) {
+            // Indexed files are decoded straight from memory, which
+            // makes seeking as cheap as sequential reading
+            if (Mapping.Open(filename) != SVL_OK) {
+                CMN_LOG_CLASS_INIT_VERBOSE << "Open: failed to map file to memory; using buffered reads" << std::endl;
+            }
+        }
+        LastReadPos = -1;
+
         Pos = BegPos = 0;
         width = Width;
         height = Height;
@@ -502,6 +541,12 @@ int svlVideoCodecCVI::Close()
 
     File.Close();
 
+    StopPrefetch();
+    ClearCache();
+    Mapping.Close();
+    CacheSize   = 0;
+    LastReadPos = -1;
+
     delete SaveInitEvent;
     delete NewFrameEvent;
     delete WriteDoneEvent;
@@ -808,6 +853,49 @@ int svlVideoCodecCVI::Read(svlProcInfo* procInfo, svlSampleImage &image, const u
     char strbuffer[32];
     int ret = SVL_FAIL;
 
+    if (Mapping.IsOpen()) {
+        if (Pos > EndPos) {
+            Pos = 0;
+            return SVL_VID_END_REACHED;
+        }
+
+        if (!ReadCachedFrame(Pos, img, Timestamp)) {
+            if (DecodeFrame(Pos, img, yuvBuffer, Timestamp) != SVL_OK) {
+                if (Pos > 0) {
+                    // Video data ended earlier than expected
+                    Pos = 0;
+                    return SVL_VID_END_REACHED;
+                }
+                CMN_LOG_CLASS_INIT_ERROR << "Read: (thread=" << procInfo->ID << ") failed to read first frame" << std::endl;
+                return SVL_FAIL;
+            }
+            if (CacheSize > 0) {
+                CachedFrame* frame = GetFreeCacheEntry();
+                if (frame) {
+                    memcpy(frame->Data.Pointer(), img, frame->Data.size());
+                    frame->Pos = Pos;
+                    frame->Timestamp = Timestamp;
+                    StoreCacheEntry(frame);
+                }
+            }
+        }
+
+        if (PrefetchThread) {
+            // Decode frames ahead in the playback direction, forward
+            // or backward, while the current frame is being processed
+            CacheCS.Enter();
+                PrefetchDirection = (Pos < LastReadPos) ? -1 : 1;
+                PrefetchPos = Pos + PrefetchDirection;
+            CacheCS.Leave();
+            PrefetchEvent->Raise();
+        }
+
+        LastReadPos = Pos;
+        Pos ++;
+
+        return SVL_OK;
+    }
+
     if (Version > 0) {
         if (Pos > EndPos) {
             Pos = 0;
@@ -1243,6 +1331,238 @@ void svlVideoCodecCVI::DiffEncode(unsigned char* input, unsigned char* previous,
     DiffDecode(output, previous_temp, previous_temp, size);
 }
 
+int svlVideoCodecCVI::SetFrameCacheSize(const unsigned int frames)
+{
+    if (!Opened || Writing) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrameCacheSize: file needs to be opened for reading" << std::endl;
+        return SVL_FAIL;
+    }
+    if (!Mapping.IsOpen()) {
+        CMN_LOG_CLASS_INIT_WARNING << "SetFrameCacheSize: frame cache requires an indexed, non-differential file that can be mapped to memory" << std::endl;
+        return SVL_FAIL;
+    }
+
+    StopPrefetch();
+    ClearCache();
+    CacheSize = frames;
+
+    if (CacheSize > 0) {
+        KillPrefetchThread = false;
+        PrefetchPos        = -1;
+        PrefetchEvent      = new osaThreadSignal;
+        PrefetchThread     = new osaThread;
+        PrefetchThread->Create<svlVideoCodecCVI, int>(this, &svlVideoCodecCVI::PrefetchProc, 0);
+    }
+
+    return SVL_OK;
+}
+
+unsigned int svlVideoCodecCVI::GetFrameCacheSize() const
+{
+    return CacheSize;
+}
+
+int svlVideoCodecCVI::DecodeFrame(const int pos, unsigned char* rgb, unsigned char* yuv, double &timestamp) const
+{
+    // Thread safe: only reads the mapped file and the frame index
+    if (pos < 0 || pos >= static_cast<int>(FrameOffsets.size())) return SVL_FAIL;
+
+    const long long int markerlen = FrameStartMarker.length();
+    long long int fileoffset = FrameOffsets[pos];
+    const unsigned char* ptr;
+    unsigned int i, compressedpartsize, offset = 0;
+    unsigned long longsize;
+
+    // Check "frame start marker" and read "timestamp"
+    ptr = Mapping.GetPointer(fileoffset, markerlen + sizeof(double));
+    if (!ptr || memcmp(ptr, FrameStartMarker.c_str(), static_cast<size_t>(markerlen)) != 0) return SVL_FAIL;
+    memcpy(&timestamp, ptr + markerlen, sizeof(double));
+    if (timestamp < 0.0) return SVL_FAIL;
+    fileoffset += markerlen + sizeof(double);
+
+    for (i = 0; i < PartCount; i ++) {
+
+        // Read "compressed part size"
+        ptr = Mapping.GetPointer(fileoffset, sizeof(unsigned int));
+        if (!ptr) return SVL_FAIL;
+        memcpy(&compressedpartsize, ptr, sizeof(unsigned int));
+        fileoffset += sizeof(unsigned int);
+        if (compressedpartsize == 0 || compressedpartsize > comprBufferSize) return SVL_FAIL;
+
+        // Decompress frame part directly from the mapped file
+        ptr = Mapping.GetPointer(fileoffset, compressedpartsize);
+        if (!ptr) return SVL_FAIL;
+        longsize = yuvBufferSize - offset;
+        if (uncompress(yuv + offset, &longsize, ptr, compressedpartsize) != Z_OK) return SVL_FAIL;
+        fileoffset += compressedpartsize;
+
+        // Convert YUV422 planar to RGB format
+        svlConverter::YUV422PtoRGB24(yuv + offset, rgb + offset * 3 / 2, longsize >> 1);
+
+        offset += longsize;
+    }
+
+    return SVL_OK;
+}
+
+bool svlVideoCodecCVI::ReadCachedFrame(const int pos, unsigned char* rgb, double &timestamp)
+{
+    if (CacheSize == 0) return false;
+
+    CachedFrame* frame = 0;
+    std::list<CachedFrame*>::iterator iter;
+
+    CacheCS.Enter();
+        for (iter = Cache.begin(); iter != Cache.end(); iter ++) {
+            if ((*iter)->Pos == pos) {
+                frame = *iter;
+                // Move to front
+                Cache.splice(Cache.begin(), Cache, iter);
+                break;
+            }
+        }
+        if (frame) {
+            memcpy(rgb, frame->Data.Pointer(), frame->Data.size());
+            timestamp = frame->Timestamp;
+        }
+    CacheCS.Leave();
+
+    return (frame != 0);
+}
+
+bool svlVideoCodecCVI::IsFrameCached(const int pos)
+{
+    bool found = false;
+    std::list<CachedFrame*>::iterator iter;
+
+    CacheCS.Enter();
+        for (iter = Cache.begin(); iter != Cache.end(); iter ++) {
+            if ((*iter)->Pos == pos) {
+                found = true;
+                break;
+            }
+        }
+    CacheCS.Leave();
+
+    return found;
+}
+
+svlVideoCodecCVI::CachedFrame* svlVideoCodecCVI::GetFreeCacheEntry()
+{
+    // The entry is removed from the cache until stored again
+    CachedFrame* frame = 0;
+
+    CacheCS.Enter();
+        if (Cache.size() >= CacheSize && !Cache.empty()) {
+            // Evict least recently used frame
+            frame = Cache.back();
+            Cache.pop_back();
+        }
+    CacheCS.Leave();
+
+    if (!frame) frame = new CachedFrame(Width * Height * 3);
+    frame->Pos = -1;
+
+    return frame;
+}
+
+void svlVideoCodecCVI::StoreCacheEntry(CachedFrame* frame)
+{
+    std::list<CachedFrame*>::iterator iter;
+
+    CacheCS.Enter();
+        // The same frame might have been decoded by both threads
+        for (iter = Cache.begin(); iter != Cache.end(); iter ++) {
+            if ((*iter)->Pos == frame->Pos) {
+                delete *iter;
+                Cache.erase(iter);
+                break;
+            }
+        }
+        Cache.push_front(frame);
+        while (Cache.size() > CacheSize) {
+            delete Cache.back();
+            Cache.pop_back();
+        }
+    CacheCS.Leave();
+}
+
+void svlVideoCodecCVI::ClearCache()
+{
+    std::list<CachedFrame*>::iterator iter;
+
+    CacheCS.Enter();
+        for (iter = Cache.begin(); iter != Cache.end(); iter ++) delete *iter;
+        Cache.clear();
+    CacheCS.Leave();
+}
+
+void svlVideoCodecCVI::StopPrefetch()
+{
+    if (!PrefetchThread) return;
+
+    KillPrefetchThread = true;
+    PrefetchEvent->Raise();
+    PrefetchThread->Wait();
+    delete PrefetchThread;
+    delete PrefetchEvent;
+    PrefetchThread = 0;
+    PrefetchEvent  = 0;
+}
+
+void* svlVideoCodecCVI::PrefetchProc(int CMN_UNUSED(param))
+{
+    vctDynamicVector<unsigned char> yuv(yuvBufferSize);
+    const int depth = std::min(PREFETCH_DEPTH, static_cast<int>(CacheSize / 2));
+    CachedFrame* frame;
+    int pos, direction, i, restart, first, last;
+
+    while (!KillPrefetchThread) {
+
+        CacheCS.Enter();
+            pos = PrefetchPos;
+            direction = PrefetchDirection;
+            PrefetchPos = -1;
+        CacheCS.Leave();
+
+        if (pos < 0 || depth < 1) {
+            PrefetchEvent->Wait();
+            continue;
+        }
+
+        // Ask the OS to read ahead the compressed data of the frames
+        // following the ones decoded here; this also works backward
+        first = std::max(0, std::min(EndPos, pos + direction * depth));
+        last  = std::max(0, std::min(EndPos, pos + direction * depth * 2));
+        if (first > last) std::swap(first, last);
+        Mapping.WillNeed(FrameOffsets[first], ((last < EndPos) ? FrameOffsets[last + 1] : FooterOffset) - FrameOffsets[first]);
+
+        for (i = 0; i < depth && !KillPrefetchThread; i ++, pos += direction) {
+            if (pos < 0 || pos > EndPos) break;
+
+            // Start over if playback moved
+            CacheCS.Enter();
+                restart = PrefetchPos;
+            CacheCS.Leave();
+            if (restart >= 0) break;
+
+            if (IsFrameCached(pos)) continue;
+
+            frame = GetFreeCacheEntry();
+            if (DecodeFrame(pos, frame->Data.Pointer(), yuv.Pointer(), frame->Timestamp) == SVL_OK) {
+                frame->Pos = pos;
+                StoreCacheEntry(frame);
+            }
+            else {
+                delete frame;
+                break;
+            }
+        }
+    }
+
+    return this;
+}
+
 void svlVideoCodecCVI::DiffDecode(unsigned char* input, unsigned char* previous, unsigned char* output, const unsigned int size)
 {
     if (!input || !previous || !output || !size) return;
@@ -24,9 +24,12 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstOSAbstraction/osaThread.h>
 #include <cisstOSAbstraction/osaThreadSignal.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
 #include <cisstStereoVision/svlVideoIO.h>
 #include <cisstStereoVision/svlTypes.h>
 #include <cisstStereoVision/svlFile.h>
+#include "svlFileMapping.h"
+#include <list>
 
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
@@ -69,6 +72,9 @@ public:
     virtual int Read(svlProcInfo* procInfo, svlSampleImage &image, const unsigned int videoch, const bool noresize = false);
     virtual int Write(svlProcInfo* procInfo, const svlSampleImage &image, const unsigned int videoch);
 
+    virtual int SetFrameCacheSize(const unsigned int frames);
+    virtual unsigned int GetFrameCacheSize() const;
+
 public:
     virtual void SetExtension(const std::string & extension);
     virtual void SetEncoderID(const int & encoder_id);
@@ -137,10 +143,33 @@ protected:
 
     svlProcInfo ProcInfoSingleThread;
 
+    // Random access playback of indexed, non-differential files:
+    // frames are decoded straight from the memory mapped file
+    class CachedFrame;
+    svlFileMapping Mapping;
+    unsigned int CacheSize;
+    std::list<CachedFrame*> Cache; // Most recently used first
+    osaCriticalSection CacheCS;
+    int LastReadPos;
+    int PrefetchPos;
+    int PrefetchDirection;
+    osaThread* PrefetchThread;
+    osaThreadSignal* PrefetchEvent;
+    bool KillPrefetchThread;
+
+    int DecodeFrame(const int pos, unsigned char* rgb, unsigned char* yuv, double &timestamp) const;
+    bool ReadCachedFrame(const int pos, unsigned char* rgb, double &timestamp);
+    bool IsFrameCached(const int pos);
+    CachedFrame* GetFreeCacheEntry();
+    void StoreCacheEntry(CachedFrame* frame);
+    void ClearCache();
+    void StopPrefetch();
+
     void DiffEncode(unsigned char* input, unsigned char* previous, unsigned char* output, const unsigned int size);
     void DiffDecode(unsigned char* input, unsigned char* previous, unsigned char* output, const unsigned int size);
 
     void* SaveProc(int param);
+    void* PrefetchProc(int param);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlVideoCodecCVI)
@@ -557,6 +557,16 @@ int svlVideoCodecBase::SetTimestamp(const double CMN_UNUSED(timestamp))
     return SVL_FAIL;
 }
 
+int svlVideoCodecBase::SetFrameCacheSize(const unsigned int CMN_UNUSED(frames))
+{
+    return SVL_FAIL;
+}
+
+unsigned int svlVideoCodecBase::GetFrameCacheSize() const
+{
+    return 0;
+}
+
 void svlVideoCodecBase::SetName(const std::string &name)
 {
     EncoderName = name;
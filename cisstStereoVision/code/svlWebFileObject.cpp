@@ -23,16 +23,31 @@
 #include "cisstStereoVision/svlWebFileObject.h"
 
 #include <iostream>
+#include <string.h>
 
 
 svlWebFileObject::svlWebFileObject(const std::string & name) :
     svlWebObjectBase(name),
+    FileSize(0),
     Buffer(0),
     BufferSize(0)
 {
     Readable = true;
 }
 
+svlWebFileObject::svlWebFileObject(const svlWebFileObject & object) :
+    svlWebObjectBase(object),
+    FileSize(object.FileSize),
+    Buffer(0),
+    BufferSize(0)
+{
+    if (object.Buffer && FileSize > 0) {
+        BufferSize = FileSize;
+        Buffer = new char[BufferSize];
+        memcpy(Buffer, object.Buffer, FileSize);
+    }
+}
+
 svlWebFileObject::~svlWebFileObject()
 {
     if (Buffer) delete [] Buffer;
@@ -0,0 +1,142 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlWebImageObject.h>
+#include <cisstStereoVision/svlImageIO.h>
+
+
+/*******************************/
+/*** svlWebImageObject class ***/
+/*******************************/
+
+svlWebImageObject::svlWebImageObject(const std::string & name) :
+    svlWebObjectBase(name),
+    FrameID(0),
+    Quality(-1),
+    ConvertedImage(0)
+{
+    Readable = true;
+    SetContentType("image/jpeg");
+}
+
+svlWebImageObject::svlWebImageObject(const svlWebImageObject & object) :
+    svlWebObjectBase(object),
+    Frame(object.Frame),
+    FrameID(object.FrameID),
+    Quality(object.Quality),
+    ConvertedImage(0)
+{
+}
+
+svlWebImageObject::~svlWebImageObject()
+{
+    if (ConvertedImage) delete ConvertedImage;
+}
+
+svlWebImageObject* svlWebImageObject::clone() const
+{
+    return new svlWebImageObject(*this);
+}
+
+void svlWebImageObject::Read(char*& data, int& datasize)
+{
+    Lock();
+        Snapshot = Frame;
+    Unlock();
+
+    data = Snapshot.empty() ? 0 : &Snapshot[0];
+    datasize = static_cast<int>(Snapshot.size());
+}
+
+bool svlWebImageObject::IsStream()
+{
+    return true;
+}
+
+bool svlWebImageObject::ReadFrame(unsigned int & frameid, std::string & frame)
+{
+    bool ret = false;
+
+    Lock();
+        if (!Frame.empty() && FrameID != frameid) {
+            frame.append(Frame);
+            frameid = FrameID;
+            ret = true;
+        }
+    Unlock();
+
+    return ret;
+}
+
+void svlWebImageObject::SetQuality(const int quality)
+{
+    Quality = quality;
+}
+
+int svlWebImageObject::GetQuality() const
+{
+    return Quality;
+}
+
+int svlWebImageObject::SetImage(const svlSampleImage & image, const unsigned int videoch)
+{
+    if (videoch >= image.GetVideoChannels()) return SVL_FAIL;
+
+    const svlSampleImage* source = &image;
+    unsigned int channel = videoch;
+
+    // The JPEG encoder takes RGB images only
+    if (image.GetPixelType() != svlPixelRGB) {
+        if (!ConvertedImage) ConvertedImage = new svlSampleImageRGB;
+        if (ConvertedImage->ImportImage(image, videoch, SVL_LEFT) != SVL_OK) return SVL_FAIL;
+        source = ConvertedImage;
+        channel = SVL_LEFT;
+    }
+
+    // Encode into the back buffer without blocking the readers
+    size_t size = source->GetDataSize(channel) + 1024;
+    EncoderBuffer.resize(size);
+    if (svlImageIO::Write(*source, channel, "jpg",
+                          reinterpret_cast<unsigned char*>(&EncoderBuffer[0]), size,
+                          Quality) != SVL_OK) return SVL_FAIL;
+    EncoderBuffer.resize(size);
+
+    Lock();
+        Frame.swap(EncoderBuffer);
+        FrameID ++;
+        if (FrameID == 0) FrameID = 1;
+    Unlock();
+
+    NotifyPublisher();
+
+    return SVL_OK;
+}
+
+unsigned int svlWebImageObject::GetFrameID()
+{
+    unsigned int frameid;
+
+    Lock();
+        frameid = FrameID;
+    Unlock();
+
+    return frameid;
+}
@@ -30,7 +30,19 @@ svlWebObjectBase::svlWebObjectBase(const std::string & name) :
     Readable(false),
     Writable(false),
     Name(name),
-    Temporary(false)
+    Temporary(false),
+    Publisher(0)
+{
+}
+
+svlWebObjectBase::svlWebObjectBase(const svlWebObjectBase & object) :
+    cmnGenericObject(),
+    Readable(object.Readable),
+    Writable(object.Writable),
+    Name(object.Name),
+    ContentType(object.ContentType),
+    Temporary(false),
+    Publisher(0)
 {
 }
 
@@ -86,3 +98,24 @@ bool svlWebObjectBase::IsTemporary()
     return Temporary;
 }
 
+bool svlWebObjectBase::IsStream()
+{
+    return false;
+}
+
+bool svlWebObjectBase::ReadFrame(unsigned int & CMN_UNUSED(frameid), std::string & CMN_UNUSED(frame))
+{
+    return false;
+}
+
+const std::string & svlWebObjectBase::GetFrameContentType()
+{
+    return ContentType;
+}
+
+void svlWebObjectBase::NotifyPublisher()
+{
+    svlWebPublisher* publisher = Publisher;
+    if (publisher) publisher->Notify();
+}
+
@@ -22,22 +22,136 @@
 
 #include "cisstStereoVision/svlWebPublisher.h"
 #include "cisstStereoVision/svlWebFileObject.h"
-#include "cisstStereoVision/svlStreamDefs.h"
+#include <cisstStereoVision/svlTypes.h>
 
-#include <iostream>
-#include <Python.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sstream>
+#include <vector>
 
-#define PYTHON_SERVER_AUTO_START
+#if (CISST_OS == CISST_WINDOWS)
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #define WINSOCKVERSION MAKEWORD(2,2)
+#else
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+    #include <sys/types.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <errno.h>
+    #if (CISST_OS == CISST_LINUX)
+        #include <sys/epoll.h>
+    #else
+        #include <sys/select.h>
+    #endif
+#endif
+
+#if (CISST_OS == CISST_WINDOWS)
+    #define __errno             WSAGetLastError()
+    #define __EWOULDBLOCK       WSAEWOULDBLOCK
+    #define __EINTR             WSAEINTR
+    #define __closesocket(s)    closesocket(s)
+    #define __SEND_FLAGS        0
+#else
+    #define __errno             errno
+    #define __EWOULDBLOCK       EAGAIN
+    #define __EINTR             EINTR
+    #define __closesocket(s)    close(s)
+    #if (CISST_OS == CISST_LINUX)
+        #define __SEND_FLAGS    MSG_NOSIGNAL
+    #else
+        #define __SEND_FLAGS    0
+    #endif
+#endif
+
+#define MAX_CONNECTIONS         256
+#define MAX_EVENTS              64
+#define MAX_HEADER_SIZE         16384
+#define MAX_BODY_SIZE           1048576
+#define RECEIVE_BUFFER_SIZE     4096
+#define LISTEN_BACKLOG          64
+// Stop() is checked at least this often (ms)
+#define POLL_INTERVAL           500
+#if (CISST_OS == CISST_WINDOWS)
+// No wakeup pipe: streams are updated periodically (ms)
+#define STREAM_POLL_INTERVAL    5
+#endif
+#define STREAM_BOUNDARY         "svlframe"
+
+
+static bool SetNonBlocking(int sock)
+{
+#if (CISST_OS == CISST_WINDOWS)
+    u_long nonblocking = 1;
+    return (ioctlsocket(sock, FIONBIO, &nonblocking) == 0);
+#else
+    const int flags = fcntl(sock, F_GETFL, 0);
+    return (flags >= 0 && fcntl(sock, F_SETFL, flags | O_NONBLOCK) == 0);
+#endif
+}
 
 
+/*******************************************/
+/*** svlWebPublisher::Connection class *****/
+/*******************************************/
+
+class svlWebPublisher::Connection
+{
+public:
+    Connection(int sock) :
+        Socket(sock),
+        OutputOffset(0),
+        FrameOffset(0),
+        KeepAlive(true),
+        WriteEvents(false),
+        StreamFrameID(0)
+    {
+    }
+
+    bool IsSending()
+    {
+        return (OutputOffset < Output.size() || FrameOffset < Frame.size());
+    }
+
+    int Socket;
+    // Received bytes that are not yet processed
+    std::string Input;
+    // Headers and responses, followed by the stream frame (if any)
+    std::string Output;
+    size_t OutputOffset;
+    std::string Frame;
+    size_t FrameOffset;
+    // Closed when all output is sent if false
+    bool KeepAlive;
+    bool WriteEvents;
+    // Name of the stream object, empty if not streaming
+    std::string Stream;
+    unsigned int StreamFrameID;
+};
+
+
+/*****************************/
+/*** svlWebPublisher class ***/
+/*****************************/
+
 CMN_IMPLEMENT_SERVICES(svlWebPublisher)
 
 svlWebPublisher::svlWebPublisher(unsigned int port, bool fileserver) :
     cmnGenericObject(),
     Port(port),
     FileServer(fileserver),
-    ServerThread(0)
+    MaxConnections(MAX_CONNECTIONS),
+    ServerThread(0),
+    ServerInitSuccess(false),
+    KillServerThread(false),
+    ConnectionCount(0),
+    ServerSocket(-1),
+    Poller(-1)
 {
+    WakeupPipe[0] = WakeupPipe[1] = -1;
 }
 
 svlWebPublisher::~svlWebPublisher()
@@ -55,102 +169,56 @@ bool svlWebPublisher::IsFileServer()
     return FileServer;
 }
 
-int svlWebPublisher::Start()
+void svlWebPublisher::SetMaxConnections(unsigned int maxconnections)
 {
-    Stop();
+    MaxConnections = maxconnections;
+}
 
-    // Register object to Python
-    cmnObjectRegister::Register("WebPublisher", this);
+unsigned int svlWebPublisher::GetConnectionCount()
+{
+    return ConnectionCount;
+}
 
-    ///////////////////////
-    // Initialize Python //
-    ///////////////////////
+int svlWebPublisher::Start()
+{
+    Stop();
 
-    Py_Initialize();
-    PyRun_SimpleString("import sys; sys.path.append(\".\");");
-    std::string command = std::string("sys.path.append(\"") + CISST_BUILD_LINK_DIRECTORIES + "\");";
-    std::cout << "*** Path for cisst libraries: " << CISST_BUILD_LINK_DIRECTORIES << std::endl;
-    PyRun_SimpleString(const_cast<char*>(command.c_str()));
-#if (CISST_OS == CISST_WINDOWS)
-#ifdef _DEBUG
-    command = std::string("sys.path.append(\"") + CISST_BUILD_LINK_DIRECTORIES + "/debug\");";
-    std::cout << "*** Path for cisst libraries: " << CISST_BUILD_LINK_DIRECTORIES << "/debug" << std::endl;
-    PyRun_SimpleString(const_cast<char*>(command.c_str()));
-#else
-    command = std::string("sys.path.append(\"") + CISST_BUILD_LINK_DIRECTORIES + "/release\");";
-    std::cout << "*** Path for cisst libraries: " << CISST_BUILD_LINK_DIRECTORIES << "/release" << std::endl;
-    PyRun_SimpleString(const_cast<char*>(command.c_str()));
-#endif
+#if (CISST_OS != CISST_WINDOWS)
+    if (pipe(WakeupPipe) != 0) return SVL_FAIL;
+    SetNonBlocking(WakeupPipe[0]);
+    SetNonBlocking(WakeupPipe[1]);
 #endif
 
-    ///////////////////////////
-    // Import CISST wrappers //
-    ///////////////////////////
-
-    std::cout << "*** Importing cisstCommonPython..." << std::endl;
-    if (PyRun_SimpleString("import cisstCommonPython; from cisstCommonPython import *") != 0) {
-        std::cout << "Failed to import cisstCommonPython" << std::endl;
-        ServerInitSuccess = false;
-    }
-    std::cout << "*** Importing cisstVectorPython..." << std::endl;
-    if (PyRun_SimpleString("import cisstVectorPython; from cisstVectorPython import *") != 0) {
-        std::cout << "Failed to import cisstVectorPython" << std::endl;
-        ServerInitSuccess = false;
-    }
-    std::cout << "*** Importing cisstStereoVisionPython..." << std::endl;
-    if (PyRun_SimpleString("import cisstStereoVisionPython; from cisstStereoVisionPython import *") != 0) {
-        std::cout << "Failed to import cisstStereoVisionPython" << std::endl;
-        ServerInitSuccess = false;
-    }
-
-    ///////////////////////////////
-    // Import Python HTTP server //
-    ///////////////////////////////
-
-    std::cout << "*** Importing svlWebPublisherPython..." << std::endl;
-    if (PyRun_SimpleString("import svlWebPublisherPython; from svlWebPublisherPython import *") != 0) {
-        std::cout << "Failed to import svlWebPublisherPython" << std::endl;
-        ServerInitSuccess = false;
-    }
-
     // Start server thread
     ServerInitSuccess = false;
+    KillServerThread = false;
     ServerThread = new osaThread();
     ServerThread->Create<svlWebPublisher, int>(this, &svlWebPublisher::Proc, 0);
     ServerSignal.Wait();
 
+    if (!ServerInitSuccess) {
+        Stop();
+        return SVL_FAIL;
+    }
+
     return SVL_OK;
 }
 
 void svlWebPublisher::Stop()
 {
     if (ServerThread) {
-        // Stop server
-std::cerr<<"0"<<std::endl;
-        PyObject* n = PyString_FromString("svlWebPublisherPython");
-std::cerr<<"1"<<std::endl;
-        PyObject* m = PyImport_Import(n);
-std::cerr<<"2"<<std::endl;
-        PyObject* d = PyModule_GetDict(m);
-std::cerr<<"3"<<std::endl;
-        PyObject* c = PyDict_GetItemString(d, "HTTPServerWithStop");
-std::cerr<<"4"<<std::endl;
-        PyObject* o = PyObject_CallObject(c, NULL);
-std::cerr<<"5"<<std::endl;
-        PyObject_CallMethod(o, "StopServer", NULL);
-std::cerr<<"6"<<std::endl;
-
-        Py_DECREF(o);
-        Py_DECREF(c);
-        Py_DECREF(d);
-        Py_DECREF(m);
-        Py_DECREF(n);
-
-        PyRun_SimpleString("svlWebPublisherPython.StopServer()");
+        KillServerThread = true;
+        Notify();
         ServerThread->Wait();
         delete ServerThread;
         ServerThread = 0;
     }
+
+#if (CISST_OS != CISST_WINDOWS)
+    if (WakeupPipe[0] >= 0) close(WakeupPipe[0]);
+    if (WakeupPipe[1] >= 0) close(WakeupPipe[1]);
+    WakeupPipe[0] = WakeupPipe[1] = -1;
+#endif
 }
 
 int svlWebPublisher::AddObject(svlWebObjectBase* object)
@@ -162,6 +230,7 @@ int svlWebPublisher::AddObject(svlWebObjectBase* object)
     CS.Enter();
         if (Objects.find(object->GetName()) == Objects.end()) {
             Objects.insert(_ObjectPair(object->GetName(), object));
+            object->Publisher = this;
             ret = SVL_OK;
         }
     CS.Leave();
@@ -171,14 +240,18 @@ int svlWebPublisher::AddObject(svlWebObjectBase* object)
 
 int svlWebPublisher::RemoveObject(const std::string & objectname)
 {
-    int ret;
+    int ret = SVL_FAIL;
 
     CS.Enter();
-        ret = Objects.erase(objectname);
+        _ObjectMap::iterator iter = Objects.find(objectname);
+        if (iter != Objects.end()) {
+            iter->second->Publisher = 0;
+            Objects.erase(iter);
+            ret = SVL_OK;
+        }
     CS.Leave();
 
-    if (ret == 0) return SVL_FAIL;
-    return SVL_OK;
+    return ret;
 }
 
 int svlWebPublisher::RemoveObject(svlWebObjectBase* object)
@@ -190,8 +263,9 @@ int svlWebPublisher::RemoveObject(svlWebObjectBase* object)
         for (iter = Objects.begin(); iter != Objects.end(); iter ++) {
             if (iter->second == object) break;
         }
-    if (iter != Objects.end()) {
-            Objects.erase(iter->first);
+        if (iter != Objects.end()) {
+            iter->second->Publisher = 0;
+            Objects.erase(iter);
             ret = SVL_OK;
         }
     CS.Leave();
@@ -240,28 +314,540 @@ void svlWebPublisher::ReleaseObject(svlWebObjectBase* object)
     if (object && object->IsTemporary()) delete object;
 }
 
+void svlWebPublisher::Notify()
+{
+#if (CISST_OS != CISST_WINDOWS)
+    const int fd = WakeupPipe[1];
+    if (fd >= 0) {
+        // Pipe full means there is a pending wakeup already
+        char c = 0;
+        if (write(fd, &c, 1) < 0) return;
+    }
+#endif
+}
+
 void* svlWebPublisher::Proc(int CMN_UNUSED(param))
 {
-    ServerInitSuccess = true;
-    ServerSignal.Raise();
+#if (CISST_OS == CISST_WINDOWS)
+    bool wsa_running = false;
+#endif
 
-    //////////////////
-    // Start server //
-    //////////////////
+    ConnectionCount = 0;
 
-#ifdef PYTHON_SERVER_AUTO_START
-    PyRun_SimpleString("svlWebPublisherPython.StartServer()");
-#else
-    char* parms[] = { "webgui" };
-    Py_Main(1, parms);
+    while (1) {
+
+#if (CISST_OS == CISST_WINDOWS)
+        WSADATA wsaData;
+        if (WSAStartup(WINSOCKVERSION, &wsaData) != 0) {
+            CMN_LOG_CLASS_INIT_ERROR << "Proc: WSAStartup failed" << std::endl;
+            break;
+        }
+        wsa_running = true;
+#endif
+
+        ServerSocket = static_cast<int>(socket(PF_INET, SOCK_STREAM, IPPROTO_TCP));
+        if (ServerSocket < 0) {
+            CMN_LOG_CLASS_INIT_ERROR << "Proc: cannot create socket" << std::endl;
+            break;
+        }
+
+        int reuse = 1;
+        setsockopt(ServerSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(int));
+
+        sockaddr_in address;
+        memset(&address, 0, sizeof(sockaddr_in));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<unsigned short>(Port));
+        address.sin_addr.s_addr = INADDR_ANY;
+
+        if (bind(ServerSocket, reinterpret_cast<sockaddr*>(&address), sizeof(sockaddr_in)) < 0) {
+            CMN_LOG_CLASS_INIT_ERROR << "Proc: bind failed (port=" << Port << ")" << std::endl;
+            break;
+        }
+        if (listen(ServerSocket, LISTEN_BACKLOG) < 0 || !SetNonBlocking(ServerSocket)) {
+            CMN_LOG_CLASS_INIT_ERROR << "Proc: listen failed" << std::endl;
+            break;
+        }
+
+#if (CISST_OS == CISST_LINUX)
+        Poller = epoll_create(MAX_EVENTS);
+        if (Poller < 0) {
+            CMN_LOG_CLASS_INIT_ERROR << "Proc: epoll_create failed" << std::endl;
+            break;
+        }
+        epoll_event event;
+        memset(&event, 0, sizeof(epoll_event));
+        event.events = EPOLLIN;
+        event.data.fd = ServerSocket;
+        epoll_ctl(Poller, EPOLL_CTL_ADD, ServerSocket, &event);
+        event.data.fd = WakeupPipe[0];
+        epoll_ctl(Poller, EPOLL_CTL_ADD, WakeupPipe[0], &event);
 #endif
 
-    ////////////////////
-    // Release Python //
-    ////////////////////
+        ServerInitSuccess = true;
+        ServerSignal.Raise();
+
+        _ConnectionMap::iterator iter;
+        Connection* connection;
+        int i, n;
+
+        while (!KillServerThread) {
+
+#if (CISST_OS == CISST_LINUX)
+
+            epoll_event events[MAX_EVENTS];
+            n = epoll_wait(Poller, events, MAX_EVENTS, POLL_INTERVAL);
+
+            for (i = 0; i < n; i ++) {
+                const int fd = events[i].data.fd;
+                if (fd == ServerSocket) {
+                    AcceptConnections();
+                    continue;
+                }
+                if (fd == WakeupPipe[0]) {
+                    char buffer[64];
+                    while (read(WakeupPipe[0], buffer, sizeof(buffer)) > 0);
+                    continue;
+                }
+
+                iter = Connections.find(fd);
+                if (iter == Connections.end()) continue;
+                connection = iter->second;
+
+                if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) ReadConnection(connection);
+                if (connection->Socket >= 0 && (events[i].events & EPOLLOUT)) WriteConnection(connection);
+                if (connection->Socket < 0) {
+                    Connections.erase(fd);
+                    delete connection;
+                }
+            }
+
+#else // CISST_OS != CISST_LINUX
+
+            fd_set readfds, writefds;
+            int maxfd = ServerSocket;
+            FD_ZERO(&readfds);
+            FD_ZERO(&writefds);
+            FD_SET(ServerSocket, &readfds);
+#if (CISST_OS != CISST_WINDOWS)
+            FD_SET(WakeupPipe[0], &readfds);
+            if (WakeupPipe[0] > maxfd) maxfd = WakeupPipe[0];
+#endif
+            bool streaming = false;
+            for (iter = Connections.begin(); iter != Connections.end(); iter ++) {
+                connection = iter->second;
+                FD_SET(connection->Socket, &readfds);
+                if (connection->IsSending()) FD_SET(connection->Socket, &writefds);
+                if (!connection->Stream.empty()) streaming = true;
+                if (connection->Socket > maxfd) maxfd = connection->Socket;
+            }
+
+            timeval tv;
+            tv.tv_sec = 0;
+            tv.tv_usec = POLL_INTERVAL * 1000;
+#if (CISST_OS == CISST_WINDOWS)
+            if (streaming) tv.tv_usec = STREAM_POLL_INTERVAL * 1000;
+#endif
+            n = select(maxfd + 1, &readfds, &writefds, 0, &tv);
+
+            if (n > 0) {
+                if (FD_ISSET(ServerSocket, &readfds)) AcceptConnections();
+#if (CISST_OS != CISST_WINDOWS)
+                if (FD_ISSET(WakeupPipe[0], &readfds)) {
+                    char buffer[64];
+                    while (read(WakeupPipe[0], buffer, sizeof(buffer)) > 0);
+                }
+#endif
+                std::vector<int> closed;
+                for (iter = Connections.begin(); iter != Connections.end(); iter ++) {
+                    connection = iter->second;
+                    if (FD_ISSET(iter->first, &readfds)) ReadConnection(connection);
+                    if (connection->Socket >= 0 && FD_ISSET(iter->first, &writefds)) WriteConnection(connection);
+                    if (connection->Socket < 0) closed.push_back(iter->first);
+                }
+                for (i = 0; i < static_cast<int>(closed.size()); i ++) {
+                    iter = Connections.find(closed[i]);
+                    delete iter->second;
+                    Connections.erase(iter);
+                }
+            }
+
+#endif // CISST_OS
+
+            UpdateStreams();
+        }
+
+        break;
+    }
 
-    Py_Finalize();
+    if (!ServerInitSuccess) ServerSignal.Raise();
+
+    // Close all connections
+    for (_ConnectionMap::iterator iter = Connections.begin(); iter != Connections.end(); iter ++) {
+        CloseConnection(iter->second);
+        delete iter->second;
+    }
+    Connections.clear();
+
+#if (CISST_OS == CISST_LINUX)
+    if (Poller >= 0) close(Poller);
+    Poller = -1;
+#endif
+    if (ServerSocket >= 0) __closesocket(ServerSocket);
+    ServerSocket = -1;
+#if (CISST_OS == CISST_WINDOWS)
+    if (wsa_running) WSACleanup();
+#endif
 
     return this;
 }
 
+void svlWebPublisher::AcceptConnections()
+{
+    while (1) {
+        const int sock = static_cast<int>(accept(ServerSocket, 0, 0));
+        if (sock < 0) break;
+
+        if (ConnectionCount >= MaxConnections || !SetNonBlocking(sock)
+#if (CISST_OS != CISST_WINDOWS) && (CISST_OS != CISST_LINUX)
+            // select() can't handle descriptors above FD_SETSIZE
+            || sock >= FD_SETSIZE
+#endif
+            ) {
+            CMN_LOG_CLASS_RUN_WARNING << "AcceptConnections: connection refused" << std::endl;
+            __closesocket(sock);
+            continue;
+        }
+
+        // Small responses and stream headers shall not be delayed
+        int nodelay = 1;
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&nodelay), sizeof(int));
+#if (CISST_OS == CISST_DARWIN)
+        int nosigpipe = 1;
+        setsockopt(sock, SOL_SOCKET, SO_NOSIGPIPE, &nosigpipe, sizeof(int));
+#endif
+
+        Connection* connection = new Connection(sock);
+        Connections[sock] = connection;
+        ConnectionCount ++;
+
+#if (CISST_OS == CISST_LINUX)
+        epoll_event event;
+        memset(&event, 0, sizeof(epoll_event));
+        event.events = EPOLLIN;
+        event.data.fd = sock;
+        epoll_ctl(Poller, EPOLL_CTL_ADD, sock, &event);
+#endif
+    }
+}
+
+void svlWebPublisher::ReadConnection(Connection* connection)
+{
+    char buffer[RECEIVE_BUFFER_SIZE];
+
+    while (1) {
+        const int ret = static_cast<int>(recv(connection->Socket, buffer, RECEIVE_BUFFER_SIZE, 0));
+        if (ret > 0) {
+            connection->Input.append(buffer, ret);
+            if (connection->Input.size() > MAX_HEADER_SIZE + MAX_BODY_SIZE) {
+                CloseConnection(connection);
+                return;
+            }
+            continue;
+        }
+        if (ret < 0 && (__errno == __EWOULDBLOCK || __errno == __EINTR)) break;
+
+        // Disconnected or error
+        CloseConnection(connection);
+        return;
+    }
+
+    if (!HandleRequests(connection)) {
+        CloseConnection(connection);
+        return;
+    }
+
+    WriteConnection(connection);
+}
+
+void svlWebPublisher::WriteConnection(Connection* connection)
+{
+    std::string* buffer;
+    size_t* offset;
+    int ret;
+
+    while (connection->IsSending()) {
+        if (connection->OutputOffset < connection->Output.size()) {
+            buffer = &(connection->Output);
+            offset = &(connection->OutputOffset);
+        }
+        else {
+            buffer = &(connection->Frame);
+            offset = &(connection->FrameOffset);
+        }
+
+        ret = static_cast<int>(send(connection->Socket, buffer->data() + *offset,
+                                    static_cast<int>(buffer->size() - *offset), __SEND_FLAGS));
+        if (ret > 0) {
+            *offset += ret;
+            continue;
+        }
+        if (ret < 0 && (__errno == __EWOULDBLOCK || __errno == __EINTR)) break;
+
+        CloseConnection(connection);
+        return;
+    }
+
+    if (!connection->IsSending()) {
+        connection->Output.clear();
+        connection->OutputOffset = 0;
+        connection->Frame.clear();
+        connection->FrameOffset = 0;
+        if (!connection->KeepAlive) {
+            CloseConnection(connection);
+            return;
+        }
+    }
+
+    UpdateEvents(connection);
+}
+
+void svlWebPublisher::CloseConnection(Connection* connection)
+{
+    if (connection->Socket < 0) return;
+
+#if (CISST_OS == CISST_LINUX)
+    epoll_ctl(Poller, EPOLL_CTL_DEL, connection->Socket, 0);
+#endif
+    __closesocket(connection->Socket);
+    connection->Socket = -1;
+    ConnectionCount --;
+}
+
+bool svlWebPublisher::HandleRequests(Connection* connection)
+{
+    std::string& input = connection->Input;
+
+    // Requests are handled in order (pipelining); streaming
+    // connections don't take further requests
+    while (connection->Stream.empty() && connection->KeepAlive) {
+        const size_t headerend = input.find("\r\n\r\n");
+        if (headerend == std::string::npos) return (input.size() <= MAX_HEADER_SIZE);
+
+        // Request line
+        const size_t lineend = input.find("\r\n");
+        const std::string requestline = input.substr(0, lineend);
+        const size_t sp1 = requestline.find(' ');
+        const size_t sp2 = requestline.rfind(' ');
+        if (sp1 == std::string::npos || sp2 == sp1) return false;
+        const std::string method = requestline.substr(0, sp1);
+        const std::string target = requestline.substr(sp1 + 1, sp2 - sp1 - 1);
+        const std::string version = requestline.substr(sp2 + 1);
+
+        // Headers
+        size_t contentlength = 0;
+        bool keepalive = (version == "HTTP/1.1");
+        size_t pos = lineend + 2;
+        while (pos < headerend) {
+            size_t end = input.find("\r\n", pos);
+            std::string line = input.substr(pos, end - pos);
+            pos = end + 2;
+
+            const size_t colon = line.find(':');
+            if (colon == std::string::npos) continue;
+            std::string name = line.substr(0, colon);
+            std::string value = line.substr(colon + 1);
+            for (size_t j = 0; j < name.size(); j ++) name[j] = static_cast<char>(tolower(name[j]));
+            for (size_t j = 0; j < value.size(); j ++) value[j] = static_cast<char>(tolower(value[j]));
+            while (!value.empty() && value[0] == ' ') value.erase(0, 1);
+
+            if (name == "content-length") {
+                contentlength = static_cast<size_t>(atol(value.c_str()));
+                if (contentlength > MAX_BODY_SIZE) return false;
+            }
+            else if (name == "connection") {
+                if (value.find("close") != std::string::npos) keepalive = false;
+                else if (value.find("keep-alive") != std::string::npos) keepalive = true;
+            }
+        }
+
+        // Wait for the body
+        if (input.size() < headerend + 4 + contentlength) return true;
+        const std::string body = input.substr(headerend + 4, contentlength);
+        input.erase(0, headerend + 4 + contentlength);
+
+        connection->KeepAlive = keepalive;
+
+        if (method == "GET") HandleRequest(connection, GET, target, body);
+        else if (method == "POST") HandleRequest(connection, POST, target, body);
+        else SendResponse(connection, "501 Not Implemented", "text/plain", 0, 0);
+    }
+
+    return true;
+}
+
+void svlWebPublisher::HandleRequest(Connection* connection, RequestType request, const std::string & target, const std::string & body)
+{
+    std::string name = target, query;
+    const size_t qpos = name.find('?');
+    if (qpos != std::string::npos) {
+        query = name.substr(qpos + 1);
+        name.erase(qpos);
+    }
+    while (!name.empty() && name[0] == '/') name.erase(0, 1);
+    if (name.empty()) name = "index.html";
+
+    // Stream objects are accessed directly: they are not cloned
+    bool stream = false;
+    std::string contenttype, frame;
+    unsigned int frameid = 0;
+    if (request == GET) {
+        CS.Enter();
+            _ObjectMap::iterator iter = Objects.find(name);
+            if (iter != Objects.end() && iter->second->IsStream()) {
+                stream = true;
+                contenttype = iter->second->GetFrameContentType();
+                if (query == "snapshot") iter->second->ReadFrame(frameid, frame);
+            }
+        CS.Leave();
+    }
+
+    if (stream) {
+        if (query == "snapshot") {
+            if (frame.empty()) SendResponse(connection, "503 Service Unavailable", "text/plain", 0, 0);
+            else SendResponse(connection, "200 OK", contenttype, frame.data(), static_cast<int>(frame.size()));
+        }
+        else {
+            connection->Output.append("HTTP/1.1 200 OK\r\n"
+                                      "Content-Type: multipart/x-mixed-replace; boundary=" STREAM_BOUNDARY "\r\n"
+                                      "Cache-Control: no-cache\r\n"
+                                      "Connection: close\r\n\r\n");
+            connection->Stream = name;
+            connection->StreamFrameID = 0;
+            connection->KeepAlive = true;
+        }
+        return;
+    }
+
+    svlWebObjectBase* object = GetObject(name, request);
+    if (!object) {
+        SendResponse(connection, "404 Not Found", "text/plain", 0, 0);
+        return;
+    }
+
+    char* data = 0;
+    int datasize = 0;
+
+    switch (request) {
+        case GET:
+            if (object->IsReadable()) {
+                object->Read(data, datasize);
+                SendResponse(connection, "200 OK", object->GetContentType(), data, datasize);
+            }
+            else {
+                SendResponse(connection, "403 Forbidden", "text/plain", 0, 0);
+            }
+        break;
+
+        case POST:
+            if (object->IsWritable()) {
+                object->Write(const_cast<char*>(body.data()), static_cast<int>(body.size()));
+                SendResponse(connection, "200 OK", "text/plain", 0, 0);
+            }
+            else {
+                SendResponse(connection, "403 Forbidden", "text/plain", 0, 0);
+            }
+        break;
+    }
+
+    ReleaseObject(object);
+}
+
+void svlWebPublisher::SendResponse(Connection* connection, const std::string & status, const std::string & contenttype, const char* data, int datasize)
+{
+    std::ostringstream header;
+    header << "HTTP/1.1 " << status << "\r\n"
+           << "Content-Type: " << contenttype << "\r\n"
+           << "Content-Length: " << datasize << "\r\n"
+           << "Cache-Control: no-cache\r\n"
+           << "Connection: " << (connection->KeepAlive ? "keep-alive" : "close") << "\r\n\r\n";
+
+    connection->Output.append(header.str());
+    if (data && datasize > 0) connection->Output.append(data, datasize);
+}
+
+void svlWebPublisher::UpdateStreams()
+{
+    Connection* connection;
+    svlWebObjectBase* object;
+    std::string contenttype;
+    bool updated;
+
+    for (_ConnectionMap::iterator iter = Connections.begin(); iter != Connections.end(); iter ++) {
+        connection = iter->second;
+
+        // Clients that are still receiving the previous frame skip frames
+        if (connection->Stream.empty() || connection->Socket < 0 || connection->IsSending()) continue;
+
+        updated = false;
+        CS.Enter();
+            _ObjectMap::iterator objiter = Objects.find(connection->Stream);
+            object = (objiter != Objects.end()) ? objiter->second : 0;
+            if (object) {
+                connection->Frame.clear();
+                connection->FrameOffset = 0;
+                updated = object->ReadFrame(connection->StreamFrameID, connection->Frame);
+                contenttype = object->GetFrameContentType();
+            }
+        CS.Leave();
+
+        if (!object) {
+            // Stream object removed: end of stream
+            connection->Output.assign("--" STREAM_BOUNDARY "--\r\n");
+            connection->OutputOffset = 0;
+            connection->KeepAlive = false;
+            connection->Stream.clear();
+        }
+        else if (updated) {
+            std::ostringstream header;
+            header << "--" << STREAM_BOUNDARY << "\r\n"
+                   << "Content-Type: " << contenttype << "\r\n"
+                   << "Content-Length: " << connection->Frame.size() << "\r\n\r\n";
+            connection->Frame.append("\r\n");
+            connection->Output.assign(header.str());
+            connection->OutputOffset = 0;
+        }
+        else continue;
+
+        WriteConnection(connection);
+    }
+
+    // Remove connections closed while writing
+    std::vector<int> closed;
+    for (_ConnectionMap::iterator iter = Connections.begin(); iter != Connections.end(); iter ++) {
+        if (iter->second->Socket < 0) closed.push_back(iter->first);
+    }
+    for (size_t i = 0; i < closed.size(); i ++) {
+        _ConnectionMap::iterator iter = Connections.find(closed[i]);
+        delete iter->second;
+        Connections.erase(iter);
+    }
+}
+
+void svlWebPublisher::UpdateEvents(Connection* connection)
+{
+#if (CISST_OS == CISST_LINUX)
+    const bool writeevents = connection->IsSending();
+    if (writeevents == connection->WriteEvents) return;
+
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    event.events = writeevents ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.fd = connection->Socket;
+    epoll_ctl(Poller, EPOLL_CTL_MOD, connection->Socket, &event);
+    connection->WriteEvents = writeevents;
+#else
+    // select() checks pending output on each iteration
+    connection->WriteEvents = connection->IsSending();
+#endif
+}
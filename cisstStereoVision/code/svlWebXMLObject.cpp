@@ -42,9 +42,21 @@ svlWebXMLObject::svlWebXMLObject(const std::string & name, bool readable, bool w
     xmlInitParser();
 }
 
+svlWebXMLObject::svlWebXMLObject(const svlWebXMLObject & object) :
+    svlWebObjectBase(object),
+    Nodes(object.Nodes),
+    XML(object.XML),
+    InvalidNode(object.InvalidNode),
+    Cache(0),
+    CacheSize(0)
+{
+}
+
 svlWebXMLObject::~svlWebXMLObject()
 {
-    xmlCleanupParser();
+    // Temporary copies are created for each request: the parser
+    // shall only be released with the original object
+    if (!IsTemporary()) xmlCleanupParser();
     if (Cache) delete [] Cache;
 }
 
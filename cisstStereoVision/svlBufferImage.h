@@ -33,6 +33,7 @@ http://www.cisst.org/cisst/license.txt.
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
 
+class svlTripleBufferIndex;
 
 class CISST_EXPORT svlBufferImage
 {
@@ -52,31 +53,30 @@ public:
     bool PushIplImage(IplImage* image);
 #endif // CISST_SVL_HAS_OPENCV
 
+    // Pull(true) may only be called by one consumer thread.
+    // Pull(false) returns the latest frame without consuming it, the
+    // producer may overwrite it while it is being read.
     svlImageRGB* Pull(bool waitfornew, double timeout = 5.0);
 #if CISST_SVL_HAS_OPENCV
     IplImage* PullIplImage(bool waitfornew, double timeout = 5.0);
 #endif // CISST_SVL_HAS_OPENCV
 
+    // Frames pushed but never pulled
+    unsigned int GetOverwriteCount() const;
+    // Pulls that had to wait for a new frame
+    unsigned int GetWaitCount() const;
+
 private:
     svlBufferImage() {}
 
-#if (CISST_OS == CISST_WINDOWS)
-    LONG Next, Latest, Locked;
-#else
-    unsigned int Next, Latest, Locked;
-#endif
+    svlTripleBufferIndex* Index;
     int InitializationCounter;
-    osaThreadSignal NewFrameEvent;
     svlImageRGB Buffer[3];
 #if CISST_SVL_HAS_OPENCV
     IplImage* OCVImage[3];
     vctDynamicVector<unsigned char> OCVConvBuffer;
 #endif // CISST_SVL_HAS_OPENCV
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    osaCriticalSection CS;
-#endif
-
     bool TopDownCopy(unsigned char *targetbuffer, const unsigned char *sourcebuffer);
 };
 
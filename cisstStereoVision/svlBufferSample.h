@@ -33,6 +33,7 @@ http://www.cisst.org/cisst/license.txt.
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
 
+class svlTripleBufferIndex;
 
 class CISST_EXPORT svlBufferSample
 {
@@ -48,22 +49,21 @@ public:
     svlSample* GetPushBuffer();
     void Push();
 
+    // Pull(true) may only be called by one consumer thread.
+    // Pull(false) returns the latest sample without consuming it, the
+    // producer may overwrite it while it is being read.
     svlSample* Pull(bool waitfornew, double timeout = 5.0);
 
+    // Samples pushed but never pulled
+    unsigned int GetOverwriteCount() const;
+    // Pulls that had to wait for a new sample
+    unsigned int GetWaitCount() const;
+
 private:
     svlBufferSample();
 
-#if (CISST_OS == CISST_WINDOWS)
-    LONG Next, Latest, Locked;
-#else
-    unsigned int Next, Latest, Locked;
-#endif
-    osaThreadSignal NewSampleEvent;
+    svlTripleBufferIndex* Index;
     svlSample* Buffer[3];
-
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
-    osaCriticalSection CS;
-#endif
 };
 
 #endif // _svlBufferSample_h
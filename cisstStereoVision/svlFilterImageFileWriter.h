@@ -24,6 +24,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstStereoVision/svlFilterBase.h>
 #include <cisstStereoVision/svlImageIO.h>
+#include <cisstStereoVision/svlImageIOAsync.h>
 
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
@@ -41,6 +42,9 @@ public:
     int SetFilePath(const std::string & filepathprefix, const std::string & extension, int videoch = SVL_LEFT);
     int SetCompression(int compression, int videoch = SVL_LEFT);
     void EnableTimestamps(bool enable = true);
+    int EnableAsync(bool enable = true, unsigned int threadcount = 2, unsigned int queuesize = 8,
+                    svlImageIOAsync::QueuePolicy policy = svlImageIOAsync::QueueBlock);
+    void GetAsyncStatistics(svlImageIOAsync::Statistics & stats) const;
     void Pause();
     void Record(int frames = -1);
 
@@ -57,6 +61,13 @@ private:
     vctDynamicVector<int> Compression;
     bool TimestampsEnabled;
     unsigned int CaptureLength;
+
+    // Background encoding
+    svlImageIOAsync AsyncIO;
+    bool AsyncEnabled;
+    unsigned int AsyncThreads;
+    unsigned int AsyncQueueSize;
+    svlImageIOAsync::QueuePolicy AsyncPolicy;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlFilterImageFileWriter)
@@ -27,6 +27,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlOverlayObjects.h>
 #include <cisstVector/vctFixedSizeVectorTypes.h>
 #include <map>
+#include <vector>
 
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
@@ -46,8 +47,15 @@ protected:
         osaThreadSignal* signal;
     } TransformInternal;
 
+    typedef struct _DrawItem {
+        svlOverlay*      overlay;
+        svlSample*       sample;
+        bool             parallel;
+    } DrawItem;
+
     typedef std::map<svlFilterInput*, svlSample*> _SampleCacheMap;
     typedef std::map<int, TransformInternal> _TransformCacheMap;
+    typedef std::vector<DrawItem> _DrawList;
 
 public:
     svlFilterImageOverlay();
@@ -85,6 +93,7 @@ private:
     svlOverlay* LastOverlay;
     _SampleCacheMap SampleCache;
     _TransformCacheMap TransformCache;
+    _DrawList DrawList;
 
     osaCriticalSection CS;
     osaCriticalSection TransformCS;
@@ -109,6 +118,7 @@ private:
     void AddQueuedItemsInternal();
     void RemoveOverlayInternal(svlOverlay* overlay);
     void RemoveAndDeleteOverlayInternal(svlOverlay* overlay);
+    void AddToDrawList(svlOverlay* overlay, svlSample* sample, unsigned int thread_count);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlFilterImageOverlay);
@@ -0,0 +1,91 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlFilterImagePointOperations_h
+#define _svlFilterImagePointOperations_h
+
+#include <cisstStereoVision/svlFilterBase.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
+#include <vector>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+
+/*!
+  Applies a chain of point operations (exposure correction, curves,
+  thresholds, channel swaps and color space conversions) in a single
+  pass over the image.
+
+  The chain is compiled before processing: consecutive per-channel
+  operations and channel swaps are merged into one look-up table per
+  channel, color space conversions are applied in between.  The image
+  is processed row by row, all stages being applied to a row while it
+  is still in cache, and rows are distributed over the processing
+  threads.  Channels refer to the order in which they are stored in
+  memory.  Channel swaps and color space conversions are only
+  supported on RGB images, the other operations are also supported on
+  RGBA (alpha channel unchanged) and Mono8 images.
+*/
+class CISST_EXPORT svlFilterImagePointOperations : public svlFilterBase
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    svlFilterImagePointOperations();
+    virtual ~svlFilterImagePointOperations();
+
+    void Clear();
+    unsigned int GetOperationCount() const;
+
+    //! Same parameters as svlFilterImageExposureCorrection
+    int AddExposure(double brightness, double contrast, double gamma, int channel = -1);
+    //! 256 element look-up table, applied to all channels if channel is negative
+    int AddCurve(const vctDynamicVector<unsigned char> & curve, int channel = -1);
+    int AddThreshold(unsigned int threshold, int channel = -1);
+    //! Output channel i is set to input channel chi
+    int AddChannelSwap(unsigned int ch1 = 2, unsigned int ch2 = 1, unsigned int ch3 = 0);
+    //! Conversion from RGB to another color space
+    int AddColorConversion(svlColorSpace output);
+
+protected:
+    virtual int Initialize(svlSample* syncInput, svlSample* &syncOutput);
+    virtual int Process(svlProcInfo* procInfo, svlSample* syncInput, svlSample* &syncOutput);
+
+private:
+    class Operation;
+    class Stage;
+
+    std::vector<Operation*> Operations;
+    std::vector<Stage*> Program;
+    bool Modified;
+    svlPixelType PixelType;
+    osaCriticalSection CS;
+
+    int AddOperation(Operation* operation);
+    void Compile();
+    void ClearProgram();
+    void ProcessRow(unsigned char* row, const unsigned int width, const unsigned int datachannels, const unsigned int pixelstride);
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlFilterImagePointOperations)
+
+#endif // _svlFilterImagePointOperations_h
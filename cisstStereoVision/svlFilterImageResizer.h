@@ -23,6 +23,7 @@ http://www.cisst.org/cisst/license.txt.
 #define _svlFilterImageResizer_h
 
 #include <cisstStereoVision/svlFilterBase.h>
+#include <cisstStereoVision/svlImageProcessing.h>
 
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
@@ -55,7 +56,7 @@ private:
     unsigned int Width[2];
     unsigned int Height[2];
     bool InterpolationEnabled;
-    vctDynamicVector<unsigned char> Internals[2];
+    svlImageProcessing::Internals Internals[2];
 
 protected:
     virtual void CreateInterfaces();
@@ -0,0 +1,74 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlFilterSharedMemoryWriter_h
+#define _svlFilterSharedMemoryWriter_h
+
+#include <cisstStereoVision/svlFilterBase.h>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+class svlSharedMemoryRing;
+
+
+// Publishes the samples of the stream into a named shared memory
+// segment that svlFilterSourceSharedMemory filters of other processes
+// on the same machine can read.  Image samples are copied to the
+// segment without encoding, other sample types are serialized.  The
+// filter passes its input through unchanged.
+class CISST_EXPORT svlFilterSharedMemoryWriter : public svlFilterBase
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    svlFilterSharedMemoryWriter();
+    virtual ~svlFilterSharedMemoryWriter();
+
+    int SetSegmentName(const std::string& name);
+    const std::string& GetSegmentName() const;
+    // Number of samples kept in the segment, readers that fall behind
+    // by more than this skip to the latest sample
+    int SetSlotCount(const unsigned int count = 4);
+    unsigned int GetSlotCount() const;
+    // Slot size for non-image samples in bytes; default: 1 MB or twice
+    // the size of the first sample, whichever is larger
+    int SetSlotSize(const unsigned int size);
+    unsigned int GetSlotSize() const;
+    // Number of samples published since Initialize()
+    unsigned int GetSampleCount() const;
+
+protected:
+    virtual int Initialize(svlSample* syncInput, svlSample* &syncOutput);
+    virtual int Process(svlProcInfo* procInfo, svlSample* syncInput, svlSample* &syncOutput);
+    virtual int Release();
+
+private:
+    svlSharedMemoryRing* Ring;
+    std::string SegmentName;
+    unsigned int SlotCount;
+    unsigned int SlotSize;
+    unsigned int SampleCount;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlFilterSharedMemoryWriter)
+
+#endif // _svlFilterSharedMemoryWriter_h
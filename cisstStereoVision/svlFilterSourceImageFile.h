@@ -25,6 +25,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlFilterSourceBase.h>
 #include <cisstStereoVision/svlFilterSourceImageFileTypes.h>
 #include <cisstStereoVision/svlImageIO.h>
+#include <cisstStereoVision/svlImageIOAsync.h>
 
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
@@ -48,6 +49,8 @@ public:
     unsigned int GetWidth(unsigned int videoch = SVL_LEFT) const;
     unsigned int GetHeight(unsigned int videoch = SVL_LEFT) const;
     int SetFrame(unsigned int numberofdigits = 0, unsigned int frame = 0);
+    int EnableAsync(bool enable = true, unsigned int threadcount = 2, unsigned int prefetch = 4);
+    void GetAsyncStatistics(svlImageIOAsync::Statistics & stats) const;
 
 protected:
     virtual int Initialize(svlSample* &syncOutput);
@@ -68,7 +71,15 @@ private:
     bool StopLoop;
     bool FrameSet;
 
+    // Read-ahead for file sequences
+    svlImageIOAsync AsyncIO;
+    bool AsyncEnabled;
+    unsigned int AsyncThreads;
+    unsigned int PrefetchCount;
+
     int BuildFilePath(int videoch, unsigned int framecounter = 0);
+    void BuildFilePath(std::string & filepath, int videoch, unsigned int framecounter) const;
+    void PrefetchFiles(unsigned int videoch);
 
 protected:
     virtual void CreateInterfaces();
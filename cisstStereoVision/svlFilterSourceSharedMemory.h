@@ -0,0 +1,76 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlFilterSourceSharedMemory_h
+#define _svlFilterSourceSharedMemory_h
+
+#include <cisstStereoVision/svlFilterSourceBase.h>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+class svlSharedMemoryRing;
+
+
+// Reads the samples published by an svlFilterSharedMemoryWriter of
+// another process.  The output type is taken from the segment, thus
+// the writer needs to be running when SetSegmentName() is called.
+// Each new sample is delivered once with the timestamp assigned by the
+// writer; samples overwritten before they were read are skipped.
+class CISST_EXPORT svlFilterSourceSharedMemory : public svlFilterSourceBase
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    svlFilterSourceSharedMemory();
+    virtual ~svlFilterSourceSharedMemory();
+
+    int SetSegmentName(const std::string& name, const double timeout = 5.0);
+    const std::string& GetSegmentName() const;
+    // Process() fails if no new sample arrives within the timeout
+    void SetTimeout(const double timeout = 5.0);
+    double GetTimeout() const;
+
+    // Sequence number of the last sample read, assigned by the writer
+    unsigned int GetSequence() const;
+    // Number of samples skipped because the reader fell behind
+    unsigned int GetSkippedCount() const;
+
+protected:
+    virtual int Initialize(svlSample* &syncOutput);
+    virtual int Process(svlProcInfo* procInfo, svlSample* &syncOutput);
+    virtual int Release();
+
+private:
+    svlSample* OutputSample;
+    svlSharedMemoryRing* Ring;
+    std::string SegmentName;
+    double Timeout;
+    unsigned int Sequence;
+    unsigned int SkippedCount;
+
+    int OpenSegment(const double timeout);
+    int ReadSample(const double timeout);
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlFilterSourceSharedMemory)
+
+#endif // _svlFilterSourceSharedMemory_h
@@ -59,6 +59,19 @@ public:
     } ImagePropertiesMask;
 
     typedef svlFilterSourceVideoCaptureTypes::ImageProperties ImageProperties;
+
+    /*! Buffer mode of a capture channel.  By default, captured frames
+      are copied (or converted) into an internal triple buffer.  In
+      zero-copy modes, buffers filled by the driver are handed to the
+      stream directly and returned to the driver when the next frame
+      is requested.  Zero-copy requires a capture API and an image
+      format that match the output pixel layout (e.g. BGR24 without
+      padding on Video4Linux2), otherwise the copy mode is used. */
+    typedef enum _CaptureBufferMode {
+        BufferCopy            = 0,  // copy into internal buffer
+        BufferZeroCopyMMap    = 1,  // driver allocated buffers
+        BufferZeroCopyUserPtr = 2   // buffers allocated by the capture API
+    } CaptureBufferMode;
     typedef svlFilterSourceVideoCaptureTypes::Config Config;
 
     typedef svlFilterSourceVideoCapture ThisType;
@@ -98,6 +111,8 @@ public:
     int GetFormat(ImageFormat& format, unsigned int videoch = SVL_LEFT) const;
     int SetTrigger(const ExternalTrigger& trigger, unsigned int videoch = SVL_LEFT);
     int GetTrigger(ExternalTrigger& trigger, unsigned int videoch = SVL_LEFT) const;
+    int SetBufferMode(CaptureBufferMode mode, unsigned int videoch = SVL_LEFT);
+    int GetBufferMode(CaptureBufferMode& mode, unsigned int videoch = SVL_LEFT) const;
     int SetImageProperties(const ImageProperties& properties, unsigned int videoch = SVL_LEFT);
     int GetImageProperties(ImageProperties& properties, unsigned int videoch = SVL_LEFT) const;
     static std::string GetPixelTypeName(PixelType pixeltype);
@@ -135,6 +150,7 @@ private:
     ImageFormat **Format;
     ImageProperties **Properties;
     ExternalTrigger *Trigger;
+    CaptureBufferMode *BufferMode;
     unsigned char **DevSpecConfigBuffer;
     unsigned int *DevSpecConfigBufferSize;
 
@@ -209,6 +225,7 @@ public:
     virtual int GetImageProperties(svlFilterSourceVideoCapture::ImageProperties & properties, unsigned int videoch = 0);
     virtual int SetTrigger(svlFilterSourceVideoCapture::ExternalTrigger & trigger, unsigned int videoch = 0);
     virtual int GetTrigger(svlFilterSourceVideoCapture::ExternalTrigger & trigger, unsigned int videoch = 0);
+    virtual int SetBufferMode(svlFilterSourceVideoCapture::CaptureBufferMode mode, unsigned int videoch = 0);
 };
 
 
@@ -52,6 +52,13 @@ public:
     int SetRange(const vctInt2 range, unsigned int videoch = SVL_LEFT);
     int GetRange(vctInt2& range, unsigned int videoch = SVL_LEFT) const;
     int GetLength(unsigned int videoch = SVL_LEFT) const;
+    /*! Number of decoded frames kept in memory per video channel for
+        random access playback (scrubbing, reverse playback).  Frames
+        ahead in the playback direction are decoded in the background.
+        Only supported by codecs capable of random access, such as
+        indexed CVI files.  Takes effect when the filter is initialized. */
+    int SetFrameCacheSize(const unsigned int frames);
+    unsigned int GetFrameCacheSize() const;
 
     // Run-time methods (available when 'Initialized')
     unsigned int GetWidth(unsigned int videoch = SVL_LEFT) const;
@@ -74,6 +81,7 @@ private:
     vctDynamicVector<bool> UseRange;
     vctDynamicVector<vctInt2> Range;
     vctDynamicVector<svlVideoCodecBase*> Codec;
+    unsigned int FrameCacheSize;
     bool ResetTimer;
     double FirstTimestamp;
     double NativeFramerate;
@@ -91,6 +99,7 @@ protected:
     virtual void SetPosRCommand(const int & position);
     virtual void SetRangeLCommand(const vctInt2 & position);
     virtual void SetRangeRCommand(const vctInt2 & position);
+    virtual void SetFrameCacheSizeCommand(const int & frames);
     virtual void GetChannelsCommand(int & channels) const;
     virtual void GetPathLCommand(std::string & filepath) const;
     virtual void GetPathRCommand(std::string & filepath) const;
@@ -0,0 +1,140 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlImageIOAsync_h
+#define _svlImageIOAsync_h
+
+#include <cisstCommon/cmnGenericObject.h>
+#include <cisstCommon/cmnClassRegisterMacros.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+#include <string>
+#include <list>
+#include <vector>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+
+// Forward declarations
+class svlSampleImage;
+class osaThread;
+
+
+/*************************************/
+/*** svlImageIOAsync class ***********/
+/*************************************/
+
+/*!
+  Pool of worker threads encoding and decoding image files in the
+  background using svlImageIO.
+
+  Write() copies one video channel of the image into a job buffer and
+  returns immediately; at most QueueSize jobs can be in flight, when
+  the queue is full the caller either blocks or the frame is dropped.
+
+  Prefetch() starts decoding a file ahead of time; Read() returns the
+  prefetched image if available (waiting for the decoder to finish if
+  needed), or decodes the file synchronously otherwise.  Prefetched
+  images that are skipped by Read() are discarded.
+*/
+class CISST_EXPORT svlImageIOAsync : public cmnGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT)
+
+public:
+    typedef enum _QueuePolicy {
+        QueueBlock = 0,
+        QueueDrop  = 1
+    } QueuePolicy;
+
+    class CISST_EXPORT Statistics
+    {
+    public:
+        Statistics();
+
+        unsigned int Submitted;
+        unsigned int Completed;
+        unsigned int Dropped;
+        unsigned int Failed;
+        unsigned int Pending;
+        //! Average and maximum time between submission and completion [s]
+        double AverageLatency;
+        double MaximumLatency;
+        //! Completed jobs per second since Start()
+        double Throughput;
+    };
+
+public:
+    svlImageIOAsync();
+    virtual ~svlImageIOAsync();
+
+    int Start(unsigned int threadcount = 2, unsigned int queuesize = 8, QueuePolicy policy = QueueBlock);
+    void Stop();
+    bool IsRunning() const;
+
+    int Write(const svlSampleImage &image, const unsigned int videoch, const std::string &filename, const int compression = -1);
+    void Flush();
+
+    int Prefetch(const svlSampleImage &image, const unsigned int videoch, const std::string &filename);
+    int Read(svlSampleImage &image, const unsigned int videoch, const std::string &filename);
+    void CancelPrefetch();
+
+    void GetStatistics(Statistics &stats) const;
+    void ResetStatistics();
+
+private:
+    class Job;
+    typedef std::list<Job*> JobList;
+    typedef std::list<osaThreadSignal*> SignalList;
+
+    void* WorkerProc(unsigned int id);
+    Job* GetJob(const svlSampleImage &image, const unsigned int videoch);
+    void RecycleJob(Job* job);
+    void CompleteJob(Job* job, bool success);
+    void WaitForJobDone();
+    void WakeUpWorker();
+    void RaiseAll(SignalList &signals);
+
+    std::vector<osaThread*> Threads;
+    bool Running;
+    bool StopRequested;
+    unsigned int QueueSize;
+    QueuePolicy Policy;
+
+    JobList Queue;        // waiting to be processed
+    JobList Prefetched;   // read jobs, in order of submission
+    JobList FreeJobs;
+    unsigned int InFlight;
+    mutable osaCriticalSection CS;
+    // A signal is only waited on by one thread: each waiting thread
+    // registers its own signal and is woken up through these lists
+    SignalList IdleWorkers;
+    SignalList JobWaiters;
+
+    Statistics Stats;
+    double LatencySum;
+    double StartTime;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlImageIOAsync)
+
+#endif // _svlImageIOAsync_h
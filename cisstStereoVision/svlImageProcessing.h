@@ -31,6 +31,7 @@ http://www.cisst.org/cisst/license.txt.
 
 // Forward declarations
 class svlImageProcessingInternals;
+struct svlProcInfo;
 
 
 namespace svlImageProcessing
@@ -57,6 +58,13 @@ namespace svlImageProcessing
         DI_AdaptiveDiscarding
     };
 
+    enum RS_Method
+    {
+        RS_Nearest,
+        RS_Bilinear,
+        RS_Area     // Averaging for downscaling, bilinear for upscaling
+    };
+
 
     int CISST_EXPORT Convolution(svlSampleImage* src_img,
                                  unsigned int src_videoch,
@@ -101,6 +109,16 @@ namespace svlImageProcessing
                             bool interpolation,
                             vctDynamicVector<unsigned char>& internals);
 
+    // If procInfo is specified, all threads shall call Resize with the same
+    // parameters; rows of the destination image are distributed among threads
+    int CISST_EXPORT Resize(svlSampleImage* src_img,
+                            unsigned int src_videoch,
+                            svlSampleImage* dst_img,
+                            unsigned int dst_videoch,
+                            RS_Method method,
+                            Internals& internals,
+                            svlProcInfo* procInfo = 0);
+
     int CISST_EXPORT Deinterlace(svlSampleImage* image,
                                  unsigned int videoch,
                                  DI_Algorithm algorithm);
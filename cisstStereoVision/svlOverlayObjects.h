@@ -65,8 +65,17 @@ public:
 protected:
     virtual void DrawInternal(svlSampleImage* bgimage, svlSample* input) = 0;
 
+    // Overlays that can be drawn by multiple threads return true;
+    // called on a single thread before DrawInternalParallel
+    virtual bool PrepareDrawParallel(svlSample* input, unsigned int thread_count);
+    // Called on all threads with the same arguments, each thread is
+    // expected to draw a distinct part of the overlay
+    virtual void DrawInternalParallel(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                                      unsigned int thread_count, unsigned int thread_id);
+
 private:
     void Draw(svlSampleImage* bgimage, svlSample* input);
+    void DrawParallel(svlSampleImage* bgimage, svlSample* input, unsigned int thread_count, unsigned int thread_id);
 
 protected:
     unsigned int VideoCh;
@@ -140,8 +149,14 @@ public:
 protected:
     virtual bool IsInputTypeValid(svlStreamType inputtype);
     virtual void DrawInternal(svlSampleImage* bgimage, svlSample* input);
+    virtual bool PrepareDrawParallel(svlSample* input, unsigned int thread_count);
+    virtual void DrawInternalParallel(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                                      unsigned int thread_count, unsigned int thread_id);
 
 private:
+    void DrawImage(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                   unsigned int thread_count, unsigned int thread_id);
+
     unsigned int InputCh;
     vctInt2 Pos;
     unsigned char Alpha;
@@ -149,6 +164,7 @@ private:
     bool QuadMappingSet;
     vctInt2 QuadUL, QuadUR, QuadLL, QuadLR;
     svlDraw::Internals WarpInternals;
+    svlDraw::WarpMT WarpInternalsMT;
 };
 
 
@@ -281,15 +297,23 @@ public:
 
 protected:
     virtual void DrawInternal(svlSampleImage* bgimage, svlSample* input);
+    virtual bool PrepareDrawParallel(svlSample* input, unsigned int thread_count);
+    virtual void DrawInternalParallel(svlSampleImage* bgimage, svlSample* input, unsigned int videoch,
+                                      unsigned int thread_count, unsigned int thread_id);
 
 private:
+    void DrawImage(svlSampleImage* bgimage, svlImageRGB* ovrlimage, unsigned int videoch,
+                   unsigned int thread_count, unsigned int thread_id);
+
     svlBufferImage* Buffer;
+    svlImageRGB* PulledImage;
     vctInt2 Pos;
     unsigned char Alpha;
     bool QuadMappingEnabled;
     bool QuadMappingSet;
     vctInt2 QuadUL, QuadUR, QuadLL, QuadLR;
     svlDraw::Internals WarpInternals;
+    svlDraw::WarpMT WarpInternalsMT;
 };
 
 
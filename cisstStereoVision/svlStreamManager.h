@@ -35,6 +35,7 @@ class svlSyncPoint;
 class svlFilterBase;
 class svlFilterSourceBase;
 class svlStreamProc;
+class svlStreamProfiler;
 class osaThread;
 class osaCriticalSection;
 
@@ -61,6 +62,20 @@ public:
     int GetStreamStatus(void) const;
     void DisconnectAll(void);
 
+    /*! Enables timing instrumentation of the processing threads; takes
+        effect at the next Play().  Each thread keeps its last
+        `eventsperthread` events for the trace export. */
+    int EnableProfiling(bool enable = true, unsigned int eventsperthread = 100000);
+    bool IsProfilingEnabled(void) const;
+    /*! Profiler of the last run, null if profiling was not enabled.
+        The pointer is valid until the next Play() or
+        EnableProfiling(false); GetProfilingReport() and
+        SaveProfilingTrace() are safe to call from any thread. */
+    const svlStreamProfiler* GetProfiler(void) const;
+    void GetProfilingReport(std::string & report) const;
+    //! Chrome trace event format (chrome://tracing, Perfetto)
+    int SaveProfilingTrace(const std::string & filename) const;
+
     // Virtual methods from mtsComponent (these are temporary measures until 
     // ticket #67 is resolved)
     void Start(void) { Play(); }
@@ -79,6 +94,11 @@ private:
     bool StopThread;
     int StreamStatus;
 
+    svlStreamProfiler* Profiler;
+    osaCriticalSection* ProfilerCS;
+    bool ProfilingEnabled;
+    unsigned int ProfilingEvents;
+
     void InternalStop(unsigned int callingthreadID);
 
 protected:
@@ -86,6 +106,9 @@ protected:
     virtual void PlayCommand(void);
     virtual void InitializeCommand(void);
     virtual void SetSourceFilterCommand(const mtsStdString & source);
+    virtual void EnableProfilingCommand(const mtsBool & enable);
+    virtual void GetProfilingReportCommand(mtsStdString & report) const;
+    virtual void SaveProfilingTraceCommand(const mtsStdString & filename);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(svlStreamManager);
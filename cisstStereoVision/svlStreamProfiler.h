@@ -0,0 +1,163 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlStreamProfiler_h
+#define _svlStreamProfiler_h
+
+#include <cisstCommon/cmnGenericObject.h>
+#include <cisstCommon/cmnClassRegisterMacros.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
+#include <string>
+#include <vector>
+#include <iostream>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+
+/*************************************/
+/*** svlStreamProfiler class *********/
+/*************************************/
+
+/*!
+  Timing instrumentation of the stream processing threads, enabled
+  with svlStreamManager::EnableProfiling().
+
+  For each filter of the trunk, every processing thread records the
+  wall and CPU time spent in Process() and the time spent waiting at
+  the synchronization point after it.  Streams fed by a branch record
+  the usage of the branch sample queue as well.  Each thread writes
+  events into its own ring buffer without locking, the last events can
+  be exported in the Chrome trace event format (chrome://tracing,
+  Perfetto).  The running statistics are summarized per filter; they
+  are updated and read in a critical section so that they can be
+  queried while the stream is running.
+*/
+class CISST_EXPORT svlStreamProfiler : public cmnGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT)
+
+public:
+    typedef enum _EventType {
+        EventProcess = 0,
+        EventSync    = 1,
+        EventQueue   = 2
+    } EventType;
+
+    class CISST_EXPORT Event
+    {
+    public:
+        Event();
+
+        EventType Type;
+        unsigned int Filter;
+        unsigned int Frame;
+        //! Start time [s] relative to the start of profiling
+        double Start;
+        double Duration;
+        double CPUTime;
+        unsigned int QueueUsage;
+    };
+
+    class CISST_EXPORT Timer
+    {
+    public:
+        double Start;
+        double CPUStart;
+    };
+
+    class CISST_EXPORT FilterStatistics
+    {
+    public:
+        FilterStatistics();
+
+        std::string Name;
+        //! Number of frames processed
+        unsigned int Frames;
+        //! Average and maximum wall time spent in Process() by a thread [s]
+        double AverageTime;
+        double MaximumTime;
+        //! Average CPU time per frame, all threads together [s]
+        double AverageCPUTime;
+        //! Average and maximum time spent at the synchronization point by a thread [s]
+        double AverageSyncTime;
+        double MaximumSyncTime;
+    };
+
+    class CISST_EXPORT QueueStatistics
+    {
+    public:
+        QueueStatistics();
+
+        unsigned int Samples;
+        double AverageUsage;
+        unsigned int MaximumUsage;
+        unsigned int DroppedSamples;
+    };
+
+public:
+    svlStreamProfiler(unsigned int threadcount, const std::vector<std::string> & filternames, unsigned int eventsperthread);
+    virtual ~svlStreamProfiler();
+
+    unsigned int GetThreadCount() const;
+    unsigned int GetFilterCount() const;
+
+    //! Called by the processing threads
+    void StartEvent(Timer & timer, bool cputime = true) const;
+    void EndEvent(const Timer & timer, unsigned int threadid, unsigned int filterid, EventType type, unsigned int frame);
+    void RecordQueue(unsigned int frame, unsigned int usage, unsigned int dropped);
+
+    void GetStatistics(std::vector<FilterStatistics> & stats) const;
+    void GetQueueStatistics(QueueStatistics & stats) const;
+    //! Copies the events still stored in the ring buffer of the thread, oldest first
+    void GetEvents(unsigned int threadid, std::vector<Event> & events) const;
+
+    void Report(std::ostream & outputStream) const;
+    int SaveChromeTrace(const std::string & filename) const;
+
+    static double GetThreadCPUTime();
+
+private:
+    svlStreamProfiler();
+    svlStreamProfiler(const svlStreamProfiler & other);
+
+    class ThreadLog;
+
+    void AddEvent(ThreadLog & log, const Event & event);
+
+    std::vector<std::string> FilterNames;
+    std::vector<ThreadLog*> Threads;
+    unsigned int EventsPerThread;
+    double StartTime;
+
+    // Protects the statistics
+    mutable osaCriticalSection CS;
+
+    // Written by the first thread only
+    unsigned int QueueSamples;
+    double QueueUsageSum;
+    unsigned int QueueMaximum;
+    unsigned int QueueDropped;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION_EXPORT(svlStreamProfiler)
+
+#endif // _svlStreamProfiler_h
@@ -130,6 +130,10 @@ public:
     virtual int Read(svlProcInfo* procInfo, svlSampleImage &image, const unsigned int videoch, const bool noresize = false) = 0;
     virtual int Write(svlProcInfo* procInfo, const svlSampleImage &image, const unsigned int videoch) = 0;
 
+    //! Number of decoded frames kept in memory for random access playback; not supported by all codecs
+    virtual int SetFrameCacheSize(const unsigned int frames);
+    virtual unsigned int GetFrameCacheSize() const;
+
 public:
     virtual void SetExtension(const std::string & extension) = 0;
     virtual void SetEncoderID(const int & encoder_id) = 0;
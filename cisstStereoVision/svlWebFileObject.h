@@ -30,21 +30,31 @@
 #include <string>
 
 // Always the last cisst include
-#include <cisstCommon/cmnExport.h>
+#include <cisstStereoVision/svlExport.h>
 
 
-class svlWebFileObject : public svlWebObjectBase
+// Contents of a file in the working directory, created by
+// svlWebPublisher for each request of an unpublished object.
+class CISST_EXPORT svlWebFileObject : public svlWebObjectBase
 {
 friend class svlWebPublisher;
 
-private:
+public:
     svlWebFileObject(const std::string & name);
+    // Copies the file contents
+    svlWebFileObject(const svlWebFileObject & object);
     virtual ~svlWebFileObject();
     virtual svlWebFileObject* clone() const;
-    
+
+    // Loads the file, returns false if it can't be read or if its
+    // content type is not supported
     bool PrepareContents();
     virtual void Read(char*& data, int& datasize);
-    
+
+private:
+    svlWebFileObject();
+    svlWebFileObject & operator = (const svlWebFileObject & object);
+
     int FileSize;
     char* Buffer;
     int BufferSize;
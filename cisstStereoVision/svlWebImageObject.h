@@ -0,0 +1,69 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlWebImageObject_h
+#define _svlWebImageObject_h
+
+#include <cisstStereoVision/svlWebObjectBase.h>
+#include <cisstStereoVision/svlTypes.h>
+
+#include <string>
+
+// Always the last cisst include
+#include <cisstStereoVision/svlExport.h>
+
+
+// Publishes images as an MJPEG stream.  Each image is JPEG encoded once
+// in SetImage() and the same frame is sent to all viewers.  Requesting
+// "<name>?snapshot" returns the latest frame as a single JPEG image.
+class CISST_EXPORT svlWebImageObject : public svlWebObjectBase
+{
+public:
+    svlWebImageObject(const std::string & name);
+    svlWebImageObject(const svlWebImageObject & object);
+    virtual ~svlWebImageObject();
+    virtual svlWebImageObject* clone() const;
+
+    virtual void Read(char*& data, int& datasize);
+    virtual bool IsStream();
+    virtual bool ReadFrame(unsigned int & frameid, std::string & frame);
+
+    // JPEG quality [0, 100], -1 for the codec default
+    void SetQuality(const int quality);
+    int GetQuality() const;
+
+    // Shall be called by a single thread (e.g. a filter or callback of
+    // the stream producing the images)
+    int SetImage(const svlSampleImage & image, const unsigned int videoch = SVL_LEFT);
+    unsigned int GetFrameID();
+
+private:
+    svlWebImageObject();
+
+    std::string Frame;
+    std::string EncoderBuffer;
+    std::string Snapshot;
+    unsigned int FrameID;
+    int Quality;
+    svlSampleImageRGB* ConvertedImage;
+};
+
+#endif // _svlWebImageObject_h
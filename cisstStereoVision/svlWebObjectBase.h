@@ -30,7 +30,7 @@
 #include <string>
 
 // Always the last cisst include
-#include <cisstCommon/cmnExport.h>
+#include <cisstStereoVision/svlExport.h>
 
 
 class CISST_EXPORT svlWebObjectBase : public cmnGenericObject
@@ -41,6 +41,8 @@ friend class svlWebPublisher;
 
 public:
     svlWebObjectBase(const std::string & name);
+    // Copies are not published and have their own lock
+    svlWebObjectBase(const svlWebObjectBase & object);
     virtual ~svlWebObjectBase();
     virtual svlWebObjectBase* clone() const = 0;
 
@@ -54,11 +56,20 @@ public:
     bool IsWritable();
     bool IsTemporary();
 
+    // Stream objects are served as multipart streams by svlWebPublisher
+    virtual bool IsStream();
+    // Appends the latest frame to 'frame' if it is newer than 'frameid'
+    // and updates 'frameid'; returns false if there is no new frame
+    virtual bool ReadFrame(unsigned int & frameid, std::string & frame);
+    virtual const std::string & GetFrameContentType();
+
 protected:
     bool Readable;
     bool Writable;
 
     void SetContentType(const std::string & content_type);
+    // Wakes up the publisher serving the object (e.g. on new frames)
+    void NotifyPublisher();
 
 private:
     svlWebObjectBase();
@@ -67,6 +78,7 @@ private:
     std::string Name;
     std::string ContentType;
     bool Temporary;
+    svlWebPublisher* Publisher;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(svlWebObjectBase)
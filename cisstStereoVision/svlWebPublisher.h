@@ -32,17 +32,26 @@
 #include <string>
 
 // Always the last cisst include
-#include <cisstCommon/cmnExport.h>
+#include <cisstStereoVision/svlExport.h>
 
 
 class svlWebObjectBase;
 
+// HTTP/1.1 server publishing svlWebObjectBase objects.  A single thread
+// serves all clients with non-blocking sockets (epoll on Linux, select
+// elsewhere).  Connections are kept alive between requests; GET requests
+// to stream objects (e.g. svlWebImageObject) open a multipart MJPEG
+// stream that is updated whenever the object receives a new frame.
+// Streaming clients that can't keep up skip frames.
 class CISST_EXPORT svlWebPublisher : public cmnGenericObject
 {
     CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
 
+    class Connection;
+
     typedef std::pair<std::string, svlWebObjectBase*> _ObjectPair;
     typedef std::map<std::string, svlWebObjectBase*> _ObjectMap;
+    typedef std::map<int, Connection*> _ConnectionMap;
 
 public:
     enum RequestType { GET, POST };
@@ -52,6 +61,9 @@ public:
 
     unsigned int GetPort();
     bool IsFileServer();
+    // New connections are refused above this limit (default: 256)
+    void SetMaxConnections(unsigned int maxconnections);
+    unsigned int GetConnectionCount();
 
     int Start();
     void Stop();
@@ -63,6 +75,9 @@ public:
     svlWebObjectBase* GetObject(const std::string & objectname, RequestType request);
     void ReleaseObject(svlWebObjectBase* object);
 
+    // Wakes up the server thread; called by stream objects on new frames
+    void Notify();
+
     void* Proc(int param);
 private:
     svlWebPublisher();
@@ -71,14 +86,31 @@ private:
     osaCriticalSection CS;
     unsigned int Port;
     bool FileServer;
-    RequestType Request;
+    unsigned int MaxConnections;
 
     osaThread* ServerThread;
     osaThreadSignal ServerSignal;
     bool ServerInitSuccess;
+    bool KillServerThread;
+    unsigned int ConnectionCount;
+
+    // Accessed by the server thread only
+    int ServerSocket;
+    int Poller;
+    int WakeupPipe[2];
+    _ConnectionMap Connections;
+
+    void AcceptConnections();
+    void ReadConnection(Connection* connection);
+    void WriteConnection(Connection* connection);
+    void CloseConnection(Connection* connection);
+    bool HandleRequests(Connection* connection);
+    void HandleRequest(Connection* connection, RequestType request, const std::string & target, const std::string & body);
+    void SendResponse(Connection* connection, const std::string & status, const std::string & contenttype, const char* data, int datasize);
+    void UpdateStreams();
+    void UpdateEvents(Connection* connection);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(svlWebPublisher)
 
 #endif // _svlWebPublisher_h
-
@@ -31,7 +31,7 @@
 #include <string>
 
 // Always the last cisst include
-#include <cisstCommon/cmnExport.h>
+#include <cisstStereoVision/svlExport.h>
 
 
 class CISST_EXPORT svlWebXMLObject : public svlWebObjectBase
@@ -45,6 +45,7 @@ class CISST_EXPORT svlWebXMLObject : public svlWebObjectBase
 
 public:
     svlWebXMLObject(const std::string & name, bool readable, bool writable);
+    svlWebXMLObject(const svlWebXMLObject & object);
     virtual ~svlWebXMLObject();
     virtual svlWebXMLObject* clone() const;
 
@@ -0,0 +1,78 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include "svlWebFileObjectTest.h"
+
+#include <stdio.h>
+#include <string>
+
+
+void svlWebFileObjectTest::TestClone(void)
+{
+    // svlWebFileObject reads files relative to the working directory
+    const std::string name = "svlWebFileObjectTest.html";
+    const std::string contents = "<html><body>svlWebFileObjectTest</body></html>";
+    FILE * file = fopen(name.c_str(), "wb");
+    CPPUNIT_ASSERT(file);
+    fwrite(contents.data(), contents.size(), 1, file);
+    fclose(file);
+
+    svlWebFileObject * object = new svlWebFileObject(name);
+    CPPUNIT_ASSERT(object->PrepareContents());
+    CPPUNIT_ASSERT_EQUAL(std::string("text/html"), object->GetContentType());
+
+    svlWebFileObject * copy = object->clone();
+    CPPUNIT_ASSERT_EQUAL(object->GetName(), copy->GetName());
+    CPPUNIT_ASSERT_EQUAL(object->GetContentType(), copy->GetContentType());
+
+    char * data;
+    char * copyData;
+    int size, copySize;
+    object->Read(data, size);
+    copy->Read(copyData, copySize);
+    CPPUNIT_ASSERT(data != copyData);
+    CPPUNIT_ASSERT_EQUAL(contents, std::string(data, size));
+    CPPUNIT_ASSERT_EQUAL(contents, std::string(copyData, copySize));
+
+    // the copy remains valid after the original is released
+    delete object;
+    copy->Read(copyData, copySize);
+    CPPUNIT_ASSERT_EQUAL(contents, std::string(copyData, copySize));
+    delete copy;
+
+    remove(name.c_str());
+}
+
+
+void svlWebFileObjectTest::TestCloneEmpty(void)
+{
+    svlWebFileObject * object = new svlWebFileObject("svlWebFileObjectTestMissing.html");
+    CPPUNIT_ASSERT(!object->PrepareContents());
+    svlWebFileObject * copy = object->clone();
+    char * data;
+    int size;
+    copy->Read(data, size);
+    CPPUNIT_ASSERT_EQUAL(0, size);
+    delete object;
+    delete copy;
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(svlWebFileObjectTest);
@@ -0,0 +1,54 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#ifndef _svlWebFileObjectTest_h
+#define _svlWebFileObjectTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstStereoVision/svlWebFileObject.h>
+
+class svlWebFileObjectTest: public CppUnit::TestCase
+{
+    CPPUNIT_TEST_SUITE(svlWebFileObjectTest);
+
+    CPPUNIT_TEST(TestClone);
+    CPPUNIT_TEST(TestCloneEmpty);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! The clone has its own copy of the file contents, deleting both
+      objects must not release the same buffer twice */
+    void TestClone(void);
+
+    /*! Clone of an object whose file hasn't been loaded */
+    void TestCloneEmpty(void);
+};
+
+#endif // _svlWebFileObjectTest_h
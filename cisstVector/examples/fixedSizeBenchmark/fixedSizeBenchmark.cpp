@@ -0,0 +1,246 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstVector/vctFixedSizeMatrixTypes.h>
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <cisstVector/vctTransformationTypes.h>
+#include <cisstVector/vctRandomTransformations.h>
+#include <cisstVector/vctRandomFixedSizeVector.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstCommon/cmnPrintf.h>
+#include <iostream>
+#include <vector>
+
+/* Compare the small matrix products used by ProductOf and ApplyTo
+   (unrolled for 3x3 and 4x4) with the generic dot product engine.
+   Each operation is applied to an array of random rotations or
+   frames, the best time out of a few repetitions is kept.  Times are
+   in nanoseconds per operation. */
+
+const size_t NumberOfElements = 1000;
+const size_t NumberOfPasses = 2000;
+const size_t NumberOfRepetitions = 5;
+
+
+/* generic engine, i.e. ProductOf before specialization */
+template <class _outputType, class _input1Type, class _input2Type>
+inline void SimpleProduct(_outputType & output, const _input1Type & input1, const _input2Type & input2)
+{
+    typedef typename _input1Type::ConstRowRefType RowRefType;
+    typedef typename _input2Type::ConstColumnRefType ColumnRefType;
+    vctFixedSizeMatrixLoopEngines::
+        Product<typename vctBinaryOperations<typename _outputType::value_type, RowRefType, ColumnRefType>::DotProduct>::
+        Run(output, input1, input2);
+}
+
+
+/* matrix products, rotation in upper left corner of identity */
+template <class _elementType, vct::size_type _size>
+class MatrixProduct
+{
+public:
+    typedef vctFixedSizeMatrix<_elementType, _size, _size> MatrixType;
+    MatrixType Step;
+    std::vector<MatrixType> Inputs, Outputs;
+
+    static void Random(MatrixType & matrix) {
+        vctMatrixRotation3<_elementType> rotation;
+        vctRandom(rotation);
+        matrix = MatrixType::Eye();
+        for (vct::index_type row = 0; row < 3; ++row) {
+            for (vct::index_type col = 0; col < 3; ++col) {
+                matrix.Element(row, col) = rotation.Element(row, col);
+            }
+        }
+    }
+
+    MatrixProduct(void):
+        Inputs(NumberOfElements),
+        Outputs(NumberOfElements)
+    {
+        Random(Step);
+        for (size_t index = 0; index < NumberOfElements; ++index) {
+            Random(Inputs[index]);
+        }
+    }
+
+    inline void Simple(const size_t index) {
+        SimpleProduct(Outputs[index], Step, Inputs[index]);
+    }
+
+    inline void ProductOf(const size_t index) {
+        Outputs[index].ProductOf(Step, Inputs[index]);
+    }
+
+    double Result(void) const {
+        return Outputs[0].Element(0, 0);
+    }
+};
+
+
+/* rotation applied to vectors */
+template <class _elementType>
+class RotationApplyTo
+{
+public:
+    typedef vctFixedSizeVector<_elementType, 3> VectorType;
+    vctMatrixRotation3<_elementType> Step;
+    std::vector<VectorType> Inputs, Outputs;
+
+    RotationApplyTo(void):
+        Inputs(NumberOfElements),
+        Outputs(NumberOfElements)
+    {
+        vctRandom(Step);
+        for (size_t index = 0; index < NumberOfElements; ++index) {
+            vctRandom(Inputs[index], _elementType(-1), _elementType(1));
+        }
+    }
+
+    inline void Simple(const size_t index) {
+        const vctFixedSizeConstMatrixRef<_elementType, 3, 1, 1, 1> input(Inputs[index].Pointer());
+        vctFixedSizeMatrixRef<_elementType, 3, 1, 1, 1> output(Outputs[index].Pointer());
+        SimpleProduct(output, Step, input);
+    }
+
+    inline void ProductOf(const size_t index) {
+        Step.ApplyTo(Inputs[index], Outputs[index]);
+    }
+
+    double Result(void) const {
+        return Outputs[0].X();
+    }
+};
+
+
+/* frame composition, [R1*R2 | R1*p2 + p1] */
+template <class _frameType, vct::stride_type _rotationRowStride, vct::stride_type _translationStride>
+class FrameComposition
+{
+public:
+    typedef typename _frameType::value_type value_type;
+    _frameType Step;
+    std::vector<_frameType> Inputs, Outputs;
+
+    static void Random(_frameType & frame) {
+        vctMatrixRotation3<value_type> rotation;
+        vctRandom(rotation);
+        frame.Rotation().Assign(rotation);
+        vctFixedSizeVector<value_type, 3> translation;
+        vctRandom(translation, value_type(-1), value_type(1));
+        frame.Translation().Assign(translation);
+    }
+
+    FrameComposition(void):
+        Inputs(NumberOfElements),
+        Outputs(NumberOfElements)
+    {
+        Random(Step);
+        for (size_t index = 0; index < NumberOfElements; ++index) {
+            Random(Inputs[index]);
+        }
+    }
+
+    inline void Simple(const size_t index) {
+        _frameType & output = Outputs[index];
+        const _frameType & input = Inputs[index];
+        vctFixedSizeMatrixRef<value_type, 3, 3, _rotationRowStride, 1> outputRotation(output.Rotation().Pointer());
+        const vctFixedSizeConstMatrixRef<value_type, 3, 1, _translationStride, 1> inputTranslation(input.Translation().Pointer());
+        vctFixedSizeMatrixRef<value_type, 3, 1, _translationStride, 1> outputTranslation(output.Translation().Pointer());
+        SimpleProduct(outputTranslation, Step.Rotation(), inputTranslation);
+        output.Translation().Add(Step.Translation());
+        SimpleProduct(outputRotation, Step.Rotation(), input.Rotation());
+    }
+
+    inline void ProductOf(const size_t index) {
+        Step.ApplyTo(Inputs[index], Outputs[index]);
+    }
+
+    double Result(void) const {
+        return Outputs[0].Translation().X();
+    }
+};
+
+
+template <class _benchmarkType>
+void Benchmark(const char * name, const char * typeName)
+{
+    _benchmarkType benchmark;
+    osaStopwatch timer;
+    double timeSimple = 0.0, timeProductOf = 0.0, time, check = 0.0;
+    size_t repetition, pass, index;
+    for (repetition = 0; repetition < NumberOfRepetitions; ++repetition) {
+        timer.Reset();
+        timer.Start();
+        for (pass = 0; pass < NumberOfPasses; ++pass) {
+            for (index = 0; index < NumberOfElements; ++index) {
+                benchmark.Simple(index);
+            }
+        }
+        timer.Stop();
+        check -= benchmark.Result();
+        time = timer.GetElapsedTime();
+        if ((repetition == 0) || (time < timeSimple)) {
+            timeSimple = time;
+        }
+
+        timer.Reset();
+        timer.Start();
+        for (pass = 0; pass < NumberOfPasses; ++pass) {
+            for (index = 0; index < NumberOfElements; ++index) {
+                benchmark.ProductOf(index);
+            }
+        }
+        timer.Stop();
+        check += benchmark.Result();
+        time = timer.GetElapsedTime();
+        if ((repetition == 0) || (time < timeProductOf)) {
+            timeProductOf = time;
+        }
+    }
+    const double scale = 1.0e9 / (NumberOfPasses * NumberOfElements);
+    std::cout << cmnPrintf("%-22s%7s%12.2f%12.2f%10.2f")
+              << name << typeName << timeSimple * scale << timeProductOf * scale << timeSimple / timeProductOf;
+    // both implementations should compute the same results
+    if (check > 1.0e-3 || check < -1.0e-3) {
+        std::cout << " (results differ)";
+    }
+    std::cout << std::endl;
+}
+
+
+int main(void)
+{
+    std::cout << "Comparing small products, times are in nanoseconds per operation" << std::endl
+              << cmnPrintf("%-22s%7s%12s%12s%10s\n")
+              << "operation" << "type" << "simple" << "ProductOf" << "speedup";
+
+    Benchmark<MatrixProduct<double, 3> >("3x3 product", "double");
+    Benchmark<MatrixProduct<float, 3> >("3x3 product", "float");
+    Benchmark<MatrixProduct<double, 4> >("4x4 product", "double");
+    Benchmark<MatrixProduct<float, 4> >("4x4 product", "float");
+    Benchmark<RotationApplyTo<double> >("rotation ApplyTo", "double");
+    Benchmark<RotationApplyTo<float> >("rotation ApplyTo", "float");
+    Benchmark<FrameComposition<vctFrm3, 3, 1> >("frame composition", "double");
+    Benchmark<FrameComposition<vctFloatFrm3, 3, 1> >("frame composition", "float");
+    Benchmark<FrameComposition<vctFrm4x4, 4, 4> >("frame4x4 composition", "double");
+    Benchmark<FrameComposition<vctFloatFrm4x4, 4, 4> >("frame4x4 composition", "float");
+    return 0;
+}
@@ -0,0 +1,107 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  agent
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights
+  Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstVector/vctDynamicMatrix.h>
+#include <cisstVector/vctDynamicMatrixRef.h>
+#include <cisstVector/vctRandomDynamicMatrix.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstCommon/cmnPrintf.h>
+#include <iostream>
+
+/* Compare the matrix product used by ProductOf (cache blocked for
+   large float and double matrices) with the simple dot product
+   engine, for different sizes and storage orders. */
+
+template <class _elementType>
+void Benchmark(const size_t size, const bool columnMajor, const char * typeName)
+{
+    typedef _elementType value_type;
+    typedef vctDynamicMatrix<value_type> MatrixType;
+    typedef typename MatrixType::ConstRowRefType RowRefType;
+    typedef typename MatrixType::ConstColumnRefType ColumnRefType;
+
+    const bool storageOrder = columnMajor ? VCT_COL_MAJOR : VCT_ROW_MAJOR;
+    MatrixType input1(size, size, storageOrder);
+    MatrixType input2(size, size, storageOrder);
+    MatrixType simple(size, size, storageOrder);
+    MatrixType blocked(size, size, storageOrder);
+    vctRandom(input1, value_type(-1), value_type(1));
+    vctRandom(input2, value_type(-1), value_type(1));
+
+    // repeat small products to get a measurable time
+    size_t iterations = (200 * 200 * 200) / (size * size * size);
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    osaStopwatch timerSimple, timerBlocked;
+    timerSimple.Reset();
+    timerBlocked.Reset();
+    size_t iteration;
+
+    timerSimple.Start();
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        vctDynamicMatrixLoopEngines::
+            Product<typename vctBinaryOperations<value_type, RowRefType, ColumnRefType>::DotProduct>::
+            Run(simple, input1, input2);
+    }
+    timerSimple.Stop();
+
+    timerBlocked.Start();
+    for (iteration = 0; iteration < iterations; ++iteration) {
+        blocked.ProductOf(input1, input2);
+    }
+    timerBlocked.Stop();
+
+    const double timeSimple = timerSimple.GetElapsedTime() / iterations;
+    const double timeBlocked = timerBlocked.GetElapsedTime() / iterations;
+    const double operations = 2.0 * size * size * size;
+    std::cout << cmnPrintf("%7s%6d%6s%15.6f%15.6f%10.2f%10.2f\n")
+              << typeName
+              << static_cast<int>(size)
+              << (columnMajor ? "col" : "row")
+              << timeSimple
+              << timeBlocked
+              << (operations / timeBlocked) * 1.0e-9
+              << timeSimple / timeBlocked;
+    std::cout << std::flush;
+}
+
+
+int main(void)
+{
+    const size_t sizes[] = {8, 16, 32, 64, 128, 256, 512, 1024};
+    const size_t numberOfSizes = sizeof(sizes) / sizeof(size_t);
+
+    std::cout << "Comparing matrix products, times are in seconds per product" << std::endl
+              << cmnPrintf("%7s%6s%6s%15s%15s%10s%10s\n")
+              << "type" << "size" << "order" << "simple" << "ProductOf" << "GFlops" << "speedup";
+
+    size_t index;
+    for (index = 0; index < numberOfSizes; ++index) {
+        Benchmark<double>(sizes[index], false, "double");
+        Benchmark<double>(sizes[index], true, "double");
+    }
+    for (index = 0; index < numberOfSizes; ++index) {
+        Benchmark<float>(sizes[index], false, "float");
+        Benchmark<float>(sizes[index], true, "float");
+    }
+    return 0;
+}
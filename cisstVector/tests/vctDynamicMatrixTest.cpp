@@ -512,6 +512,38 @@ void vctDynamicMatrixTest::TestProductOperationsInt(void) {
 }
 
 
+template <class _elementType>
+void vctDynamicMatrixTest::TestProductOperationsLarge(void) {
+    // sizes not multiple of the blocks and tiles used by the blocked product
+    enum {ROWS = 71, COLS = 45, COMSIZE = 263};
+    typedef _elementType value_type;
+    vctDynamicMatrix<value_type> matrix1(ROWS, COMSIZE, VCT_ROW_MAJOR);
+    vctDynamicMatrix<value_type> matrix2(COMSIZE, COLS, VCT_COL_MAJOR);
+    vctDynamicMatrix<value_type> matrix3(ROWS, COLS, VCT_ROW_MAJOR);
+    vctRandom(matrix1, value_type(-1), value_type(1));
+    vctRandom(matrix2, value_type(-1), value_type(1));
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(matrix1, matrix2, matrix3);
+
+    matrix3.SetSize(ROWS, COLS, VCT_COL_MAJOR);
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(matrix1, matrix2, matrix3);
+
+    // strided references, including a transposed one
+    vctDynamicMatrix<value_type> parent1(COMSIZE + 3, ROWS + 5);
+    vctDynamicMatrix<value_type> parent3(ROWS + 4, COLS + 2, VCT_COL_MAJOR);
+    vctRandom(parent1, value_type(-1), value_type(1));
+    vctDynamicConstMatrixRef<value_type> reference1(parent1.TransposeRef(), 2, 1, ROWS, COMSIZE);
+    vctDynamicMatrixRef<value_type> reference3(parent3, 3, 1, ROWS, COLS);
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(reference1, matrix2, reference3);
+}
+
+void vctDynamicMatrixTest::TestProductOperationsLargeDouble(void) {
+    TestProductOperationsLarge<double>();
+}
+void vctDynamicMatrixTest::TestProductOperationsLargeFloat(void) {
+    TestProductOperationsLarge<float>();
+}
+
+
 
 template <class _elementType>
 void vctDynamicMatrixTest::TestMoMiOperations(void) {
@@ -79,6 +79,9 @@ class vctDynamicMatrixTest : public CppUnit::TestFixture
     CPPUNIT_TEST(TestProductOperationsFloat);
     CPPUNIT_TEST(TestProductOperationsInt);
 
+    CPPUNIT_TEST(TestProductOperationsLargeDouble);
+    CPPUNIT_TEST(TestProductOperationsLargeFloat);
+
     CPPUNIT_TEST(TestMoMiOperationsDouble);
     CPPUNIT_TEST(TestMoMiOperationsFloat);
     CPPUNIT_TEST(TestMoMiOperationsInt);
@@ -220,6 +223,13 @@ class vctDynamicMatrixTest : public CppUnit::TestFixture
     void TestProductOperationsFloat(void);
     void TestProductOperationsInt(void);
 
+    /*! Test Product operations on matrices large enough to use the
+      blocked product, with different storage orders and strides */
+    template<class _elementType>
+        void TestProductOperationsLarge(void);
+    void TestProductOperationsLargeDouble(void);
+    void TestProductOperationsLargeFloat(void);
+
     /*! Test MoMi operations */
     template<class _elementType>
         void TestMoMiOperations(void);
@@ -384,6 +384,50 @@ void vctFixedSizeMatrixTest::TestProductOperationsInt(void) {
 }
 
 
+template <class _elementType, vct::size_type _size>
+void vctFixedSizeMatrixTest::TestProductOperationsSmall(void) {
+    typedef _elementType value_type;
+    vctFixedSizeMatrix<value_type, _size, _size, VCT_ROW_MAJOR> matrix1, matrix3;
+    vctFixedSizeMatrix<value_type, _size, _size, VCT_COL_MAJOR> matrix2;
+    vctFixedSizeVector<value_type, _size> vector1, vector2;
+
+    vctRandom(matrix1, value_type(-10), value_type(10));
+    vctRandom(matrix2, value_type(-10), value_type(10));
+    vctRandom(vector1, value_type(-10), value_type(10));
+
+    // mixed storage orders
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(matrix1, matrix2, matrix3);
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(matrix2, matrix1, matrix3);
+    vctGenericMatrixTest::TestMatrixVectorProductOperations(matrix1, vector1, vector2);
+    vctGenericMatrixTest::TestMatrixVectorProductOperations(matrix2, vector1, vector2);
+    // transposed, i.e. non compact strides
+    vctGenericMatrixTest::TestMatrixMatrixProductOperations(matrix1.TransposeRef(), matrix2, matrix3);
+
+    // output can't share memory with either operand
+    vctGenericMatrixTest::TestMatrixMatrixProductExceptions(matrix1, matrix3);
+    bool gotException = false;
+    try {
+        matrix3.ProductOf(matrix3.TransposeRef(), matrix1);
+    } catch (std::runtime_error exception) {
+        gotException = true;
+    }
+    CPPUNIT_ASSERT(gotException);
+}
+
+void vctFixedSizeMatrixTest::TestProductOperationsSmallDouble(void) {
+    TestProductOperationsSmall<double, 3>();
+    TestProductOperationsSmall<double, 4>();
+}
+void vctFixedSizeMatrixTest::TestProductOperationsSmallFloat(void) {
+    TestProductOperationsSmall<float, 3>();
+    TestProductOperationsSmall<float, 4>();
+}
+void vctFixedSizeMatrixTest::TestProductOperationsSmallInt(void) {
+    TestProductOperationsSmall<int, 3>();
+    TestProductOperationsSmall<int, 4>();
+}
+
+
 
 template <class _elementType>
 void vctFixedSizeMatrixTest::TestMoMiOperations(void) {
@@ -77,6 +77,10 @@ class vctFixedSizeMatrixTest : public CppUnit::TestFixture
     CPPUNIT_TEST(TestProductOperationsFloat);
     CPPUNIT_TEST(TestProductOperationsInt);
 
+    CPPUNIT_TEST(TestProductOperationsSmallDouble);
+    CPPUNIT_TEST(TestProductOperationsSmallFloat);
+    CPPUNIT_TEST(TestProductOperationsSmallInt);
+
     CPPUNIT_TEST(TestMoMiOperationsDouble);
     CPPUNIT_TEST(TestMoMiOperationsFloat);
     CPPUNIT_TEST(TestMoMiOperationsInt);
@@ -210,6 +214,13 @@ class vctFixedSizeMatrixTest : public CppUnit::TestFixture
     void TestProductOperationsFloat(void);
     void TestProductOperationsInt(void);
 
+    /*! Test Product operations for 3x3 and 4x4 matrices (unrolled engine) */
+    template<class _elementType, vct::size_type _size>
+        void TestProductOperationsSmall(void);
+    void TestProductOperationsSmallDouble(void);
+    void TestProductOperationsSmallFloat(void);
+    void TestProductOperationsSmallInt(void);
+
     /*! Test MoMi operations */
     template<class _elementType>
         void TestMoMiOperations(void);
@@ -1310,6 +1310,11 @@ public:
         typedef vctDynamicConstMatrixBase<__matrixOwnerType2, _elementType> Input2MatrixType;
         typedef typename Input1MatrixType::ConstRowRefType Input1RowRefType;
         typedef typename Input2MatrixType::ConstColumnRefType Input2ColumnRefType;
+        // use the cache blocked product for large float or double matrices
+        if (vctDynamicMatrixLoopEngines::BlockedProduct::UseFor(*this, matrix1, matrix2)) {
+            vctDynamicMatrixLoopEngines::BlockedProduct::Run(*this, matrix1, matrix2);
+            return;
+        }
         vctDynamicMatrixLoopEngines::
             Product<typename vctBinaryOperations<value_type, Input1RowRefType, Input2ColumnRefType>::DotProduct>::
             Run((*this), matrix1, matrix2);
@@ -31,6 +31,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnThrow.h>
 #include <cisstVector/vctDynamicCompactLoopEngines.h>
 
+#include <vector>
+
 /*!
   \brief Container class for the dynamic matrix engines.
 
@@ -955,6 +957,241 @@ public:
     };  // Product class
 
 
+    /*! Cache blocked matrix product, i.e. output = input1 * input2.
+      This engine is used by vctDynamicMatrixBase::ProductOf for
+      float and double matrices when all dimensions are large enough
+      (see UseFor), the Product engine is used otherwise.
+
+      Blocks of both inputs are copied (packed) in contiguous buffers
+      so that the innermost loops access memory sequentially regardless
+      of the storage order and strides of the inputs (row or column
+      major, sub-matrices, transposed references...).  The innermost
+      kernel computes a ROW_TILE by COL_TILE tile of the output using
+      local accumulators, a fixed-size loop the compiler can keep in
+      registers and vectorize.  Blocks of input1 are COMMON_BLOCK by
+      ROW_BLOCK to stay in the L2 cache and blocks of input2 are
+      COMMON_BLOCK by COL_BLOCK.  The buffer used to pack the blocks
+      is allocated once per product and sized for the actual block
+      dimensions.
+
+      The results can differ from the Product engine by the rounding
+      errors since the order of the additions differs. */
+    class BlockedProduct {
+    public:
+        enum {
+            ROW_TILE = 4,
+            COL_TILE = 4,
+            ROW_BLOCK = 64,
+            COMMON_BLOCK = 256,
+            COL_BLOCK = 1024,
+            MINIMUM_SIZE = 32
+        };
+
+        /*! Element types for which the blocked product is used */
+        //@{
+        template <class _elementType>
+        inline static bool IsEnabledFor(const _elementType * CMN_UNUSED(dummy)) {
+            return false;
+        }
+        inline static bool IsEnabledFor(const float * CMN_UNUSED(dummy)) {
+            return true;
+        }
+        inline static bool IsEnabledFor(const double * CMN_UNUSED(dummy)) {
+            return true;
+        }
+        //@}
+
+        /*! Check if the blocked product should be used, i.e. element
+          type is supported and all dimensions are at least
+          MINIMUM_SIZE. */
+        template <class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+        inline static bool UseFor(const _outputMatrixType & outputMatrix,
+                                  const _input1MatrixType & input1Matrix,
+                                  const _input2MatrixType & CMN_UNUSED(input2Matrix))
+        {
+            typedef typename _outputMatrixType::value_type value_type;
+            return (IsEnabledFor(static_cast<const value_type *>(0))
+                    && (outputMatrix.rows() >= MINIMUM_SIZE)
+                    && (outputMatrix.cols() >= MINIMUM_SIZE)
+                    && (input1Matrix.cols() >= MINIMUM_SIZE));
+        }
+
+        template <class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+        static void Run(_outputMatrixType & outputMatrix,
+                        const _input1MatrixType & input1Matrix,
+                        const _input2MatrixType & input2Matrix)
+        {
+            typedef typename _outputMatrixType::size_type size_type;
+
+            const size_type rows = outputMatrix.rows();
+            const size_type cols = outputMatrix.cols();
+            const size_type common = input1Matrix.cols();
+            // check sizes
+            if ((rows != input1Matrix.rows())
+                || (cols != input2Matrix.cols())
+                || (common != input2Matrix.rows()))
+            {
+                ThrowSizeMismatchException();
+            }
+            if ((outputMatrix.Pointer() == input1Matrix.Pointer()) ||
+                (outputMatrix.Pointer() == input2Matrix.Pointer())) {
+                ThrowSharedPointersException();
+            }
+
+            // buffer for the packed blocks of both inputs, reused for
+            // all the blocks
+            const size_t rowsPacked = RoundUp(Minimum(rows, ROW_BLOCK), ROW_TILE);
+            const size_t colsPacked = RoundUp(Minimum(cols, COL_BLOCK), COL_TILE);
+            const size_t commonPacked = Minimum(common, COMMON_BLOCK);
+            std::vector<typename _outputMatrixType::value_type> packed((rowsPacked + colsPacked) * commonPacked);
+            RunRows(outputMatrix.Pointer(), outputMatrix.row_stride(), outputMatrix.col_stride(),
+                    input1Matrix.Pointer(), input1Matrix.row_stride(), input1Matrix.col_stride(),
+                    input2Matrix.Pointer(), input2Matrix.row_stride(), input2Matrix.col_stride(),
+                    rows, cols, common,
+                    &(packed[0]), &(packed[rowsPacked * commonPacked]));
+        }
+
+    protected:
+        inline static size_t Minimum(const size_t value1, const size_t value2) {
+            return (value1 < value2) ? value1 : value2;
+        }
+
+        inline static size_t RoundUp(const size_t value, const size_t multiple) {
+            return ((value + multiple - 1) / multiple) * multiple;
+        }
+
+        /*! Compute the product from raw pointers and strides.  packed1 and
+          packed2 must be large enough for a block of input1 and input2
+          respectively. */
+        template <class _elementType>
+        static void RunRows(_elementType * output,
+                            const ptrdiff_t outputRowStride, const ptrdiff_t outputColStride,
+                            const _elementType * input1,
+                            const ptrdiff_t input1RowStride, const ptrdiff_t input1ColStride,
+                            const _elementType * input2,
+                            const ptrdiff_t input2RowStride, const ptrdiff_t input2ColStride,
+                            const size_t rows, const size_t cols, const size_t common,
+                            _elementType * packed1, _elementType * packed2)
+        {
+            size_t colStart, commonStart, rowStart;
+            size_t nbCols, nbCommon, nbRows;
+            size_t rowTile, colTile;
+
+            for (colStart = 0; colStart < cols; colStart += COL_BLOCK) {
+                nbCols = Minimum(cols - colStart, COL_BLOCK);
+                for (commonStart = 0; commonStart < common; commonStart += COMMON_BLOCK) {
+                    nbCommon = Minimum(common - commonStart, COMMON_BLOCK);
+                    PackColumns(packed2,
+                                input2 + static_cast<ptrdiff_t>(commonStart) * input2RowStride
+                                + static_cast<ptrdiff_t>(colStart) * input2ColStride,
+                                input2RowStride, input2ColStride, nbCommon, nbCols);
+                    for (rowStart = 0; rowStart < rows; rowStart += ROW_BLOCK) {
+                        nbRows = Minimum(rows - rowStart, ROW_BLOCK);
+                        PackRows(packed1,
+                                 input1 + static_cast<ptrdiff_t>(rowStart) * input1RowStride
+                                 + static_cast<ptrdiff_t>(commonStart) * input1ColStride,
+                                 input1RowStride, input1ColStride, nbRows, nbCommon);
+                        for (colTile = 0; colTile < nbCols; colTile += COL_TILE) {
+                            for (rowTile = 0; rowTile < nbRows; rowTile += ROW_TILE) {
+                                Kernel(packed1 + rowTile * nbCommon,
+                                       packed2 + colTile * nbCommon,
+                                       nbCommon,
+                                       output
+                                       + static_cast<ptrdiff_t>(rowStart + rowTile) * outputRowStride
+                                       + static_cast<ptrdiff_t>(colStart + colTile) * outputColStride,
+                                       outputRowStride, outputColStride,
+                                       Minimum(nbRows - rowTile, ROW_TILE),
+                                       Minimum(nbCols - colTile, COL_TILE),
+                                       (commonStart != 0));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /*! Copy a block of input1 by panels of ROW_TILE rows.  Each
+          panel stores ROW_TILE consecutive elements for each index
+          in the common dimension, missing rows are padded with
+          zeros. */
+        template <class _elementType>
+        static void PackRows(_elementType * packed, const _elementType * input,
+                             const ptrdiff_t rowStride, const ptrdiff_t colStride,
+                             const size_t rows, const size_t common)
+        {
+            size_t row, index, tileRow;
+            const _elementType * inputPointer;
+            for (row = 0; row < rows; row += ROW_TILE) {
+                for (index = 0; index < common; ++index) {
+                    inputPointer = input + static_cast<ptrdiff_t>(row) * rowStride + static_cast<ptrdiff_t>(index) * colStride;
+                    for (tileRow = 0; tileRow < ROW_TILE; ++tileRow, ++packed) {
+                        *packed = ((row + tileRow) < rows) ? inputPointer[static_cast<ptrdiff_t>(tileRow) * rowStride] : _elementType(0);
+                    }
+                }
+            }
+        }
+
+        /*! Copy a block of input2 by panels of COL_TILE columns, see
+          PackRows. */
+        template <class _elementType>
+        static void PackColumns(_elementType * packed, const _elementType * input,
+                                const ptrdiff_t rowStride, const ptrdiff_t colStride,
+                                const size_t common, const size_t cols)
+        {
+            size_t col, index, tileCol;
+            const _elementType * inputPointer;
+            for (col = 0; col < cols; col += COL_TILE) {
+                for (index = 0; index < common; ++index) {
+                    inputPointer = input + static_cast<ptrdiff_t>(index) * rowStride + static_cast<ptrdiff_t>(col) * colStride;
+                    for (tileCol = 0; tileCol < COL_TILE; ++tileCol, ++packed) {
+                        *packed = ((col + tileCol) < cols) ? inputPointer[static_cast<ptrdiff_t>(tileCol) * colStride] : _elementType(0);
+                    }
+                }
+            }
+        }
+
+        /*! Compute a ROW_TILE by COL_TILE tile of the output from two
+          packed panels.  Only the first rows and cols elements of the
+          tile are stored (edges of the output).  If accumulate is
+          true the tile is added to the output, otherwise the output
+          is overwritten. */
+        template <class _elementType>
+        static void Kernel(const _elementType * panel1, const _elementType * panel2,
+                           const size_t common,
+                           _elementType * output,
+                           const ptrdiff_t outputRowStride, const ptrdiff_t outputColStride,
+                           const size_t rows, const size_t cols,
+                           const bool accumulate)
+        {
+            _elementType tile[ROW_TILE * COL_TILE];
+            size_t index, row, col;
+            for (index = 0; index < ROW_TILE * COL_TILE; ++index) {
+                tile[index] = _elementType(0);
+            }
+            for (index = 0; index < common; ++index,
+                     panel1 += ROW_TILE, panel2 += COL_TILE) {
+                for (row = 0; row < ROW_TILE; ++row) {
+                    const _elementType value1 = panel1[row];
+                    for (col = 0; col < COL_TILE; ++col) {
+                        tile[row * COL_TILE + col] += value1 * panel2[col];
+                    }
+                }
+            }
+            _elementType * outputPointer;
+            for (row = 0; row < rows; ++row) {
+                outputPointer = output + static_cast<ptrdiff_t>(row) * outputRowStride;
+                for (col = 0; col < cols; ++col, outputPointer += outputColStride) {
+                    if (accumulate) {
+                        *outputPointer += tile[row * COL_TILE + col];
+                    } else {
+                        *outputPointer = tile[row * COL_TILE + col];
+                    }
+                }
+            }
+        }
+    };  // BlockedProduct class
+
+
     /*! A specialized engine for computing the minimum and maximum
       elements of a matrix in one pass.  This implementation is more
       efficient than computing them separately.
@@ -1249,14 +1249,8 @@ class vctFixedSizeMatrixBase : public vctFixedSizeConstMatrixBase
                        _elementType, __input1DataPtrType> & input1Matrix,
                        const vctFixedSizeConstMatrixBase<__input1Cols, _cols, __input2RowStride, __input2ColStride,
                        _elementType, __input2DataPtrType> & input2Matrix) {
-        typedef vctFixedSizeConstMatrixBase<_rows, __input1Cols, __input1RowStride, __input1ColStride,
-            _elementType, __input1DataPtrType> Input1MatrixType;
-        typedef vctFixedSizeConstMatrixBase<__input1Cols, _cols, __input2RowStride, __input2ColStride,
-            _elementType, __input2DataPtrType> Input2MatrixType;
-        typedef typename Input1MatrixType::ConstRowRefType Input1RowRefType;
-        typedef typename Input2MatrixType::ConstColumnRefType Input2ColumnRefType;
-        vctFixedSizeMatrixLoopEngines::
-            Product<typename vctBinaryOperations<value_type, Input1RowRefType, Input2ColumnRefType>::DotProduct>::
+        // unrolled engine for 3x3 and 4x4, generic Product engine otherwise
+        vctFixedSizeMatrixLoopEngines::SmallProduct<_rows, __input1Cols, _cols>::
             Run((*this), input1Matrix, input2Matrix);
     }
 
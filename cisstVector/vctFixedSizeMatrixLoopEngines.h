@@ -27,6 +27,8 @@ http://www.cisst.org/cisst/license.txt.
   \brief Declaration of vctFixedSizeMatrixLoopEngines
  */
 
+#include <cisstVector/vctBinaryOperations.h>
+
 /*!
   \brief Container class for the matrix engines.
 
@@ -753,6 +755,41 @@ public:
         }  // Run method
     };  // Product class
 
+
+    /*! Engine for the product of small fixed size matrices.  The
+      generic version uses the Product engine, i.e. row and column
+      references and a dot product per output element.
+
+      For the sizes used by rotations and homogeneous transformations
+      (3x3 and 4x4 products, 3x3 and 4x4 matrix-vector products),
+      this class is specialized (see the end of this file).  The
+      specializations load the right operand in local variables and
+      compute each output row as a linear combination of the right
+      operand rows.  The code is written for any element type and
+      doesn't use a specific instruction set but the independent
+      operations can be mapped to SIMD instructions by the compiler.
+      As for the Product engine, an exception is thrown if the output
+      has the same base pointer as one of the inputs.
+
+      The sizes are template parameters so the selection is performed
+      at compilation time by vctFixedSizeMatrixBase::ProductOf.
+    */
+    template <vct::size_type _rows, vct::size_type _common, vct::size_type _cols>
+    class SmallProduct {
+    public:
+        template<class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+        static inline void Run(_outputMatrixType & outputMatrix,
+                               const _input1MatrixType & input1Matrix,
+                               const _input2MatrixType & input2Matrix)
+        {
+            typedef typename _input1MatrixType::ConstRowRefType Input1RowRefType;
+            typedef typename _input2MatrixType::ConstColumnRefType Input2ColumnRefType;
+            typedef typename _outputMatrixType::value_type value_type;
+            Product<typename vctBinaryOperations<value_type, Input1RowRefType, Input2ColumnRefType>::DotProduct>::
+                Run(outputMatrix, input1Matrix, input2Matrix);
+        }
+    };  // SmallProduct class
+
     /*! A specialized engine for computing the minimum and maximum
       elements of a matrix in one pass.  This implementation is more
       efficient than computing them separately.
@@ -863,5 +900,124 @@ public:
 };
 
 
+#ifndef DOXYGEN
+
+/* Specializations of the SmallProduct engine, see
+   vctFixedSizeMatrixLoopEngines::SmallProduct. */
+template <>
+class vctFixedSizeMatrixLoopEngines::SmallProduct<3, 3, 3> {
+public:
+    template<class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+    static inline void Run(_outputMatrixType & outputMatrix,
+                           const _input1MatrixType & input1Matrix,
+                           const _input2MatrixType & input2Matrix)
+    {
+        typedef typename _outputMatrixType::value_type value_type;
+        if ((outputMatrix.Pointer() == input1Matrix.Pointer()) ||
+            (outputMatrix.Pointer() == input2Matrix.Pointer())) {
+            vctFixedSizeMatrixLoopEngines::ThrowSharedPointersException();
+        }
+        const value_type
+            b00 = input2Matrix.Element(0, 0), b01 = input2Matrix.Element(0, 1), b02 = input2Matrix.Element(0, 2),
+            b10 = input2Matrix.Element(1, 0), b11 = input2Matrix.Element(1, 1), b12 = input2Matrix.Element(1, 2),
+            b20 = input2Matrix.Element(2, 0), b21 = input2Matrix.Element(2, 1), b22 = input2Matrix.Element(2, 2);
+        value_type a0, a1, a2;
+        for (vct::index_type row = 0; row < 3; ++row) {
+            a0 = input1Matrix.Element(row, 0);
+            a1 = input1Matrix.Element(row, 1);
+            a2 = input1Matrix.Element(row, 2);
+            outputMatrix.Element(row, 0) = a0 * b00 + a1 * b10 + a2 * b20;
+            outputMatrix.Element(row, 1) = a0 * b01 + a1 * b11 + a2 * b21;
+            outputMatrix.Element(row, 2) = a0 * b02 + a1 * b12 + a2 * b22;
+        }
+    }
+};
+
+
+template <>
+class vctFixedSizeMatrixLoopEngines::SmallProduct<4, 4, 4> {
+public:
+    template<class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+    static inline void Run(_outputMatrixType & outputMatrix,
+                           const _input1MatrixType & input1Matrix,
+                           const _input2MatrixType & input2Matrix)
+    {
+        typedef typename _outputMatrixType::value_type value_type;
+        if ((outputMatrix.Pointer() == input1Matrix.Pointer()) ||
+            (outputMatrix.Pointer() == input2Matrix.Pointer())) {
+            vctFixedSizeMatrixLoopEngines::ThrowSharedPointersException();
+        }
+        const value_type
+            b00 = input2Matrix.Element(0, 0), b01 = input2Matrix.Element(0, 1), b02 = input2Matrix.Element(0, 2), b03 = input2Matrix.Element(0, 3),
+            b10 = input2Matrix.Element(1, 0), b11 = input2Matrix.Element(1, 1), b12 = input2Matrix.Element(1, 2), b13 = input2Matrix.Element(1, 3),
+            b20 = input2Matrix.Element(2, 0), b21 = input2Matrix.Element(2, 1), b22 = input2Matrix.Element(2, 2), b23 = input2Matrix.Element(2, 3),
+            b30 = input2Matrix.Element(3, 0), b31 = input2Matrix.Element(3, 1), b32 = input2Matrix.Element(3, 2), b33 = input2Matrix.Element(3, 3);
+        value_type a0, a1, a2, a3;
+        for (vct::index_type row = 0; row < 4; ++row) {
+            a0 = input1Matrix.Element(row, 0);
+            a1 = input1Matrix.Element(row, 1);
+            a2 = input1Matrix.Element(row, 2);
+            a3 = input1Matrix.Element(row, 3);
+            outputMatrix.Element(row, 0) = a0 * b00 + a1 * b10 + a2 * b20 + a3 * b30;
+            outputMatrix.Element(row, 1) = a0 * b01 + a1 * b11 + a2 * b21 + a3 * b31;
+            outputMatrix.Element(row, 2) = a0 * b02 + a1 * b12 + a2 * b22 + a3 * b32;
+            outputMatrix.Element(row, 3) = a0 * b03 + a1 * b13 + a2 * b23 + a3 * b33;
+        }
+    }
+};
+
+
+template <>
+class vctFixedSizeMatrixLoopEngines::SmallProduct<3, 3, 1> {
+public:
+    template<class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+    static inline void Run(_outputMatrixType & outputMatrix,
+                           const _input1MatrixType & input1Matrix,
+                           const _input2MatrixType & input2Matrix)
+    {
+        typedef typename _outputMatrixType::value_type value_type;
+        if ((outputMatrix.Pointer() == input1Matrix.Pointer()) ||
+            (outputMatrix.Pointer() == input2Matrix.Pointer())) {
+            vctFixedSizeMatrixLoopEngines::ThrowSharedPointersException();
+        }
+        const value_type
+            b0 = input2Matrix.Element(0, 0),
+            b1 = input2Matrix.Element(1, 0),
+            b2 = input2Matrix.Element(2, 0);
+        outputMatrix.Element(0, 0) = input1Matrix.Element(0, 0) * b0 + input1Matrix.Element(0, 1) * b1 + input1Matrix.Element(0, 2) * b2;
+        outputMatrix.Element(1, 0) = input1Matrix.Element(1, 0) * b0 + input1Matrix.Element(1, 1) * b1 + input1Matrix.Element(1, 2) * b2;
+        outputMatrix.Element(2, 0) = input1Matrix.Element(2, 0) * b0 + input1Matrix.Element(2, 1) * b1 + input1Matrix.Element(2, 2) * b2;
+    }
+};
+
+
+template <>
+class vctFixedSizeMatrixLoopEngines::SmallProduct<4, 4, 1> {
+public:
+    template<class _outputMatrixType, class _input1MatrixType, class _input2MatrixType>
+    static inline void Run(_outputMatrixType & outputMatrix,
+                           const _input1MatrixType & input1Matrix,
+                           const _input2MatrixType & input2Matrix)
+    {
+        typedef typename _outputMatrixType::value_type value_type;
+        if ((outputMatrix.Pointer() == input1Matrix.Pointer()) ||
+            (outputMatrix.Pointer() == input2Matrix.Pointer())) {
+            vctFixedSizeMatrixLoopEngines::ThrowSharedPointersException();
+        }
+        const value_type
+            b0 = input2Matrix.Element(0, 0),
+            b1 = input2Matrix.Element(1, 0),
+            b2 = input2Matrix.Element(2, 0),
+            b3 = input2Matrix.Element(3, 0);
+        outputMatrix.Element(0, 0) = input1Matrix.Element(0, 0) * b0 + input1Matrix.Element(0, 1) * b1 + input1Matrix.Element(0, 2) * b2 + input1Matrix.Element(0, 3) * b3;
+        outputMatrix.Element(1, 0) = input1Matrix.Element(1, 0) * b0 + input1Matrix.Element(1, 1) * b1 + input1Matrix.Element(1, 2) * b2 + input1Matrix.Element(1, 3) * b3;
+        outputMatrix.Element(2, 0) = input1Matrix.Element(2, 0) * b0 + input1Matrix.Element(2, 1) * b1 + input1Matrix.Element(2, 2) * b2 + input1Matrix.Element(2, 3) * b3;
+        outputMatrix.Element(3, 0) = input1Matrix.Element(3, 0) * b0 + input1Matrix.Element(3, 1) * b1 + input1Matrix.Element(3, 2) * b2 + input1Matrix.Element(3, 3) * b3;
+    }
+};
+
+#endif // DOXYGEN
+
+
 #endif  // _vctFixedSizeMatrixLoopEngines_h
 
@@ -158,13 +158,10 @@ public:
     ApplyTo(const vctFixedSizeConstVectorBase<DIMENSION, __stride1, value_type, __dataPtrType1> & input,
             vctFixedSizeVectorBase<DIMENSION, __stride2, value_type, __dataPtrType2> & output) const {
         CMN_ASSERT(input.Pointer() != output.Pointer());
-        // Implementation note: We think working on a local copy of the input
-        // is faster than working on the members, because of fewer indirections,
-        // especially when combined with the dot product operation.
-        const vctFixedSizeVector<value_type, 3> inputCopy( input[0], input[1], input[2] );
-        output[0] = vctDotProduct( this->Row(0), inputCopy );
-        output[1] = vctDotProduct( this->Row(1), inputCopy );
-        output[2] = vctDotProduct( this->Row(2), inputCopy );
+        // Implementation note: the matrix-vector product is unrolled
+        // for 3x3 matrices and copies the input vector in local
+        // variables first, see vctFixedSizeMatrixLoopEngines::SmallProduct.
+        output.ProductOf(*this, input);
     }
 
 